@@ -17,6 +17,7 @@
 
 #include <cstdint>
 #include <cstring>
+#include <limits>
 #include <memory>
 #include <string>
 #include <vector>
@@ -310,6 +311,24 @@ class TestStringArray : public ::testing::Test {
       ASSERT_OK(st2);
       ASSERT_OK(st3);
     }
+
+    // Longer strings, validated in bulk
+    const std::string value = std::string(40, 'x') + "ambiguë";
+    const auto n = static_cast<offset_type>(value.size());
+    ASSERT_OK(ValidateFull(3, {0, n, 2 * n, 3 * n}, value + value + value));
+    // Truncated sequence in the last string
+    auto st4 = ValidateFull(3, {0, n, 2 * n, 3 * n - 1}, value + value + value);
+    // Valid data, but the first string ends in the middle of a character
+    auto st5 = ValidateFull(2, {0, n - 1, 2 * n}, value + value);
+    if (T::is_utf8) {
+      EXPECT_RAISES_WITH_MESSAGE_THAT(
+          Invalid, ::testing::HasSubstr("Invalid UTF8 sequence at string index 2"), st4);
+      EXPECT_RAISES_WITH_MESSAGE_THAT(
+          Invalid, ::testing::HasSubstr("Invalid UTF8 sequence at string index 0"), st5);
+    } else {
+      ASSERT_OK(st4);
+      ASSERT_OK(st5);
+    }
   }
 
  protected:
@@ -780,6 +799,106 @@ TEST(TestChunkedStringBuilder, BasicOperation) {
   }
 }
 
+// ----------------------------------------------------------------------
+// ChunkedBaseBinaryBuilder tests
+
+template <typename T>
+class TestChunkedBaseBinaryBuilder : public ::testing::Test {
+ public:
+  using BuilderType = internal::ChunkedBaseBinaryBuilder<T>;
+  using ArrayType = typename TypeTraits<T>::ArrayType;
+
+  void TestBasics() {
+    // Chunks hold at most 4 values and 10 bytes of data
+    BuilderType builder(/*max_chunk_length=*/4, /*max_chunk_value_length=*/10);
+    for (const char* value : {"a", "bb", "ccc", "dddd", "e", "", "ff", "ggg", "hhhh"}) {
+      ASSERT_OK(builder.Append(value));
+    }
+    ASSERT_OK(builder.AppendNull());
+    ASSERT_OK(builder.Append("0123456789abc"));
+    ASSERT_OK(builder.AppendNull());
+    ASSERT_EQ(12, builder.length());
+    ASSERT_EQ(33, builder.value_data_length());
+
+    ASSERT_OK_AND_ASSIGN(auto out, builder.Finish());
+    ASSERT_OK(out->ValidateFull());
+    ASSERT_TRUE(out->type()->Equals(TypeTraits<T>::type_singleton()));
+    AssertChunkedEqual(*out, {ArrayFromJSON(out->type(), R"(["a", "bb", "ccc", "dddd"])"),
+                              ArrayFromJSON(out->type(), R"(["e", "", "ff", "ggg"])"),
+                              ArrayFromJSON(out->type(), R"(["hhhh", null])"),
+                              ArrayFromJSON(out->type(), R"(["0123456789abc", null])")});
+
+    // The builder can be reused
+    ASSERT_EQ(0, builder.length());
+    ASSERT_OK_AND_ASSIGN(out, builder.Finish());
+    ASSERT_EQ(1, out->num_chunks());
+    ASSERT_EQ(0, out->length());
+  }
+
+  void TestMemoryUsage() {
+    ProxyMemoryPool pool(default_memory_pool());
+    constexpr int64_t kChunkValueLength = 1000;
+    BuilderType builder(/*max_chunk_length=*/100, kChunkValueLength, &pool);
+    const std::string value(10, 'x');
+    for (int i = 0; i < 250; ++i) {
+      ASSERT_OK(builder.Append(value));
+    }
+    ASSERT_OK_AND_ASSIGN(auto out, builder.Finish());
+    ASSERT_EQ(3, out->num_chunks());
+    ASSERT_EQ(250, out->length());
+    // Each chunk's buffers are allocated once, at their final capacity
+    const int64_t max_chunk_size = kChunkValueLength + 101 * 8 + 64 * 3;
+    ASSERT_LE(pool.max_memory(), 3 * max_chunk_size);
+  }
+
+  void TestReserveHints() {
+    BuilderType builder(/*max_chunk_length=*/1000, /*max_chunk_value_length=*/10000);
+    ASSERT_OK(builder.Reserve(3));
+    ASSERT_OK(builder.ReserveData(6));
+    for (const char* value : {"ab", "cd", "ef"}) {
+      ASSERT_OK(builder.Append(value));
+    }
+    // Appending beyond the hints starts a new chunk, the first one being full
+    ASSERT_OK(builder.Append("g"));
+    ASSERT_OK_AND_ASSIGN(auto out, builder.Finish());
+    ASSERT_OK(out->ValidateFull());
+    ASSERT_EQ(2, out->num_chunks());
+    const auto& first = checked_cast<const ArrayType&>(*out->chunk(0));
+    ASSERT_EQ(3, first.length());
+    ASSERT_EQ(6, first.value_data()->size());
+  }
+
+  void TestReserveNoData() {
+    // A hint of no data is honored, rather than allocating a full chunk
+    ProxyMemoryPool pool(default_memory_pool());
+    BuilderType builder(/*max_chunk_length=*/1000,
+                        /*max_chunk_value_length=*/std::numeric_limits<int64_t>::max(),
+                        &pool);
+    ASSERT_OK(builder.Reserve(3));
+    ASSERT_OK(builder.ReserveData(0));
+    ASSERT_OK(builder.AppendNull());
+    ASSERT_OK(builder.Append(""));
+    ASSERT_OK(builder.AppendNull());
+    ASSERT_LT(pool.max_memory(), 1024);
+    // A value beyond the hint still gets room
+    ASSERT_OK(builder.Append("abc"));
+    ASSERT_OK_AND_ASSIGN(auto out, builder.Finish());
+    ASSERT_OK(out->ValidateFull());
+    AssertChunkedEqual(*out, {ArrayFromJSON(out->type(), R"([null, "", null])"),
+                              ArrayFromJSON(out->type(), R"(["abc"])")});
+  }
+};
+
+TYPED_TEST_SUITE(TestChunkedBaseBinaryBuilder, StringTypes);
+
+TYPED_TEST(TestChunkedBaseBinaryBuilder, Basics) { this->TestBasics(); }
+
+TYPED_TEST(TestChunkedBaseBinaryBuilder, MemoryUsage) { this->TestMemoryUsage(); }
+
+TYPED_TEST(TestChunkedBaseBinaryBuilder, ReserveHints) { this->TestReserveHints(); }
+
+TYPED_TEST(TestChunkedBaseBinaryBuilder, ReserveNoData) { this->TestReserveNoData(); }
+
 // ----------------------------------------------------------------------
 // ArrayDataVisitor<binary-like> tests
 
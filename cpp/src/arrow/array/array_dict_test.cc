@@ -22,6 +22,7 @@
 #include <string>
 #include <vector>
 
+#include <gmock/gmock-matchers.h>
 #include <gtest/gtest.h>
 
 #include "arrow/array.h"
@@ -1081,6 +1082,30 @@ TEST(TestDictionary, Validate) {
   // Only checking index type for now
   ASSERT_OK(arr->ValidateFull());
 
+  // Out-of-bounds indices, spanning several blocks of values.  Values
+  // under nulls are ignored.
+  std::vector<bool> is_valid(1000, true);
+  std::vector<int16_t> indices_values(1000, 1);
+  is_valid[100] = false;
+  indices_values[100] = 3;
+  ArrayFromVector<Int16Type, int16_t>(is_valid, indices_values, &indices);
+  arr = std::make_shared<DictionaryArray>(dict_type, indices, dict);
+  ASSERT_OK(arr->ValidateFull());
+  indices_values[600] = 3;
+  ArrayFromVector<Int16Type, int16_t>(is_valid, indices_values, &indices);
+  arr = std::make_shared<DictionaryArray>(dict_type, indices, dict);
+  EXPECT_RAISES_WITH_MESSAGE_THAT(
+      Invalid,
+      ::testing::HasSubstr("Value at position 600 out of bounds: 3 "
+                           "(should be in [0, 2])"),
+      arr->ValidateFull());
+  indices_values[600] = -1;
+  ArrayFromVector<Int16Type>(indices_values, &indices);
+  arr = std::make_shared<DictionaryArray>(dict_type, indices, dict);
+  EXPECT_RAISES_WITH_MESSAGE_THAT(
+      Invalid, ::testing::HasSubstr("Value at position 100 out of bounds: 3"),
+      arr->ValidateFull());
+
   // ARROW-7008: Invalid dict was not being validated
   std::vector<std::shared_ptr<Buffer>> buffers = {nullptr, nullptr, nullptr};
   auto invalid_data = std::make_shared<ArrayData>(utf8(), 0, buffers);
@@ -17,6 +17,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <array>
 #include <cstddef>
 #include <cstdint>
@@ -33,8 +34,11 @@
 #include "arrow/array/data.h"
 #include "arrow/buffer.h"
 #include "arrow/buffer_builder.h"
+#include "arrow/chunked_array.h"
+#include "arrow/result.h"
 #include "arrow/status.h"
 #include "arrow/type.h"
+#include "arrow/type_traits.h"
 #include "arrow/util/macros.h"
 #include "arrow/util/string_view.h"  // IWYU pragma: export
 #include "arrow/util/visibility.h"
@@ -627,6 +631,146 @@ class ARROW_EXPORT ChunkedStringBuilder : public ChunkedBinaryBuilder {
   Status Finish(ArrayVector* out) override;
 };
 
+/// \brief Builder of ChunkedArrays of binary-like values made of
+/// fixed-capacity chunks
+///
+/// BaseBinaryBuilder grows its buffers by reallocation, which copies the data
+/// appended so far and temporarily needs twice its size in memory.  Instead,
+/// the buffers of each chunk are allocated once, with room for at most
+/// max_chunk_length values and max_chunk_value_length bytes of data, and a new
+/// chunk is started when they are full.  A single value larger than
+/// max_chunk_value_length gets a chunk of its own.
+///
+/// Reserve() and ReserveData() tell how many values and bytes of data are
+/// still to be appended, so that chunks are not allocated larger than needed.
+/// Once ReserveData() was called, chunks only get room for the data it announced
+/// (even none at all), plus any value which doesn't fit.
+template <typename TYPE>
+class ChunkedBaseBinaryBuilder {
+ public:
+  using TypeClass = TYPE;
+  using offset_type = typename TypeClass::offset_type;
+  using BuilderType = typename TypeTraits<TYPE>::BuilderType;
+
+  ChunkedBaseBinaryBuilder(int64_t max_chunk_length, int64_t max_chunk_value_length,
+                           MemoryPool* pool = default_memory_pool())
+      : max_chunk_length_(std::max<int64_t>(
+            1, std::min(max_chunk_length, BuilderType::memory_limit()))),
+        max_chunk_value_length_(
+            std::min(max_chunk_value_length, BuilderType::memory_limit())),
+        builder_(pool) {}
+
+  Status Append(const uint8_t* value, offset_type length) {
+    if (ARROW_PREDICT_FALSE(builder_.length() == chunk_capacity_ ||
+                            builder_.value_data_length() + length >
+                                chunk_value_capacity_)) {
+      ARROW_RETURN_NOT_OK(NextChunk(length));
+    }
+    builder_.UnsafeAppend(value, length);
+    return Status::OK();
+  }
+
+  Status Append(util::string_view value) {
+    return Append(reinterpret_cast<const uint8_t*>(value.data()),
+                  static_cast<offset_type>(value.size()));
+  }
+
+  Status AppendNull() {
+    if (ARROW_PREDICT_FALSE(builder_.length() == chunk_capacity_)) {
+      ARROW_RETURN_NOT_OK(NextChunk(0));
+    }
+    builder_.UnsafeAppendNull();
+    return Status::OK();
+  }
+
+  /// \brief Hint that `additional_length` more values are to be appended
+  Status Reserve(int64_t additional_length) {
+    expected_length_ = length() + additional_length;
+    return Status::OK();
+  }
+
+  /// \brief Hint that `additional_value_length` more bytes of data are to be
+  /// appended
+  Status ReserveData(int64_t additional_value_length) {
+    expected_value_length_ = value_data_length() + additional_value_length;
+    return Status::OK();
+  }
+
+  /// \brief The number of values appended so far, over all chunks
+  int64_t length() const { return finished_length_ + builder_.length(); }
+
+  /// \brief The number of bytes of data appended so far, over all chunks
+  int64_t value_data_length() const {
+    return finished_value_length_ + builder_.value_data_length();
+  }
+
+  Status Finish(std::shared_ptr<ChunkedArray>* out) {
+    if (builder_.length() > 0 || chunks_.empty()) {
+      ARROW_RETURN_NOT_OK(FinishChunk());
+    }
+    *out = std::make_shared<ChunkedArray>(std::move(chunks_), builder_.type());
+    chunks_.clear();
+    finished_length_ = finished_value_length_ = 0;
+    expected_length_ = 0;
+    expected_value_length_ = -1;
+    chunk_capacity_ = chunk_value_capacity_ = 0;
+    return Status::OK();
+  }
+
+  Result<std::shared_ptr<ChunkedArray>> Finish() {
+    std::shared_ptr<ChunkedArray> out;
+    ARROW_RETURN_NOT_OK(Finish(&out));
+    return out;
+  }
+
+ protected:
+  Status FinishChunk() {
+    finished_length_ += builder_.length();
+    finished_value_length_ += builder_.value_data_length();
+    std::shared_ptr<Array> chunk;
+    ARROW_RETURN_NOT_OK(builder_.Finish(&chunk));
+    chunks_.push_back(std::move(chunk));
+    return Status::OK();
+  }
+
+  // Start a new chunk with room for at least a value of `value_length` bytes
+  Status NextChunk(int64_t value_length) {
+    if (builder_.length() > 0) {
+      ARROW_RETURN_NOT_OK(FinishChunk());
+    }
+    chunk_capacity_ = max_chunk_length_;
+    if (expected_length_ > length()) {
+      chunk_capacity_ = std::min(chunk_capacity_, expected_length_ - length());
+    }
+    chunk_value_capacity_ = max_chunk_value_length_;
+    if (expected_value_length_ >= 0) {
+      // The hint is authoritative, even if no more data is expected
+      chunk_value_capacity_ = std::min(
+          chunk_value_capacity_,
+          std::max<int64_t>(0, expected_value_length_ - value_data_length()));
+    }
+    chunk_value_capacity_ = std::max(chunk_value_capacity_, value_length);
+    ARROW_RETURN_NOT_OK(builder_.Resize(chunk_capacity_));
+    return builder_.ReserveData(chunk_value_capacity_);
+  }
+
+  const int64_t max_chunk_length_;
+  const int64_t max_chunk_value_length_;
+  // The capacity of the current chunk
+  int64_t chunk_capacity_ = 0;
+  int64_t chunk_value_capacity_ = 0;
+  // Totals over the finished chunks
+  int64_t finished_length_ = 0;
+  int64_t finished_value_length_ = 0;
+  // Totals expected once all values are appended, as hinted by Reserve() and
+  // ReserveData() (-1 if ReserveData() wasn't called)
+  int64_t expected_length_ = 0;
+  int64_t expected_value_length_ = -1;
+
+  BuilderType builder_;
+  ArrayVector chunks_;
+};
+
 }  // namespace internal
 
 }  // namespace arrow
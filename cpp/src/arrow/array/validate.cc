@@ -17,6 +17,8 @@
 
 #include "arrow/array/validate.h"
 
+#include <algorithm>
+#include <limits>
 #include <vector>
 
 #include "arrow/array.h"  // IWYU pragma: keep
@@ -24,6 +26,7 @@
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
 #include "arrow/util/bit_block_counter.h"
+#include "arrow/util/bit_run_reader.h"
 #include "arrow/util/bit_util.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/int_util_internal.h"
@@ -388,6 +391,11 @@ Status ValidateArray(const Array& array) { return ValidateArray(*array.data());
 
 namespace {
 
+// Number of values checked branch-free before testing for failure.
+// Checks accumulate into an int rather than a bool, as compilers don't
+// vectorize boolean reductions.
+constexpr int64_t kValidationBlockSize = 256;
+
 struct UTF8DataValidator {
   const ArrayData& data;
 
@@ -398,23 +406,57 @@ struct UTF8DataValidator {
 
   template <typename StringType>
   enable_if_string<StringType, Status> Visit(const StringType&) {
-    util::InitializeUTF8();
+    using offset_type = typename StringType::offset_type;
 
-    int64_t i = 0;
-    return VisitArrayDataInline<StringType>(
-        data,
-        [&](util::string_view v) {
-          if (ARROW_PREDICT_FALSE(!util::ValidateUTF8(v))) {
-            return Status::Invalid("Invalid UTF8 sequence at string index ", i);
+    util::InitializeUTF8();
+    if (data.length == 0) {
+      return Status::OK();
+    }
+    const offset_type* offsets = data.GetValues<offset_type>(1);
+    const uint8_t* values = data.GetValues<uint8_t>(2, /*absolute_offset=*/0);
+
+    // Validate each run of non-null strings as a single UTF8 buffer, and only
+    // look for the offending string if that fails
+    return VisitSetBitRuns(
+        data.buffers[0], data.offset, data.length, [&](int64_t position, int64_t length) {
+          if (ARROW_PREDICT_TRUE(ValidateRun(offsets + position, length, values))) {
+            return Status::OK();
+          }
+          for (int64_t i = position; i < position + length; ++i) {
+            if (ARROW_PREDICT_FALSE(!util::ValidateUTF8(
+                    values + offsets[i], static_cast<int64_t>(offsets[i + 1]) -
+                                             static_cast<int64_t>(offsets[i])))) {
+              return Status::Invalid("Invalid UTF8 sequence at string index ", i);
+            }
           }
-          ++i;
-          return Status::OK();
-        },
-        [&]() {
-          ++i;
           return Status::OK();
         });
   }
+
+  // The concatenation of consecutive strings is valid UTF8 and each string
+  // starts on a character boundary iff all strings are valid UTF8.
+  // A false result doesn't necessarily mean invalid data, only that the
+  // strings have to be validated one by one.
+  template <typename offset_type>
+  static bool ValidateRun(const offset_type* offsets, int64_t length,
+                          const uint8_t* values) {
+    const offset_type begin = offsets[0];
+    const offset_type end = offsets[length];
+    if (begin >= end) {
+      return false;
+    }
+    int invalid = 0;
+    offset_type prev_offset = begin;
+    for (int64_t i = 1; i < length; ++i) {
+      const offset_type offset = offsets[i];
+      invalid |= (offset < prev_offset) | (offset > end);
+      prev_offset = offset;
+      // Branch-free check that the string doesn't start with a continuation byte
+      const offset_type start = (offset > begin && offset < end) ? offset : begin;
+      invalid |= (values[start] & 0xc0) == 0x80;
+    }
+    return !invalid && util::ValidateUTF8Buffer(values + begin, end - begin);
+  }
 };
 
 struct BoundsChecker {
@@ -431,22 +473,44 @@ struct BoundsChecker {
   enable_if_integer<IntegerType, Status> Visit(const IntegerType&) {
     using c_type = typename IntegerType::c_type;
 
-    int64_t i = 0;
-    return VisitArrayDataInline<IntegerType>(
-        data,
-        [&](c_type value) {
-          const auto v = static_cast<int64_t>(value);
-          if (ARROW_PREDICT_FALSE(v < min_value || v > max_value)) {
-            return Status::Invalid("Value at position ", i, " out of bounds: ", v,
-                                   " (should be in [", min_value, ", ", max_value, "])");
+    const c_type* values = data.GetValues<c_type>(1);
+    const uint8_t* bitmap = data.buffers[0] ? data.buffers[0]->data() : nullptr;
+    auto IsOutOfBounds = [&](c_type value) -> bool {
+      const auto v = static_cast<int64_t>(value);
+      return (v < min_value) | (v > max_value);
+    };
+    auto IsOutOfBoundsMaybeNull = [&](int64_t i) -> bool {
+      return BitUtil::GetBit(bitmap, data.offset + i) & IsOutOfBounds(values[i]);
+    };
+
+    // Boundscheck blocks of values branch-free, and only look for the
+    // offending value if a block has one
+    OptionalBitBlockCounter bit_counter(bitmap, data.offset, data.length);
+    int64_t position = 0;
+    while (position < data.length) {
+      const BitBlockCount block = bit_counter.NextBlock();
+      int block_out_of_bounds = 0;
+      if (block.AllSet()) {
+        for (int64_t i = position; i < position + block.length; ++i) {
+          block_out_of_bounds |= IsOutOfBounds(values[i]);
+        }
+      } else if (!block.NoneSet()) {
+        for (int64_t i = position; i < position + block.length; ++i) {
+          block_out_of_bounds |= IsOutOfBoundsMaybeNull(i);
+        }
+      }
+      if (ARROW_PREDICT_FALSE(block_out_of_bounds)) {
+        for (int64_t i = position; i < position + block.length; ++i) {
+          if (block.AllSet() ? IsOutOfBounds(values[i]) : IsOutOfBoundsMaybeNull(i)) {
+            return Status::Invalid("Value at position ", i, " out of bounds: ",
+                                   static_cast<int64_t>(values[i]), " (should be in [",
+                                   min_value, ", ", max_value, "])");
           }
-          ++i;
-          return Status::OK();
-        },
-        [&]() {
-          ++i;
-          return Status::OK();
-        });
+        }
+      }
+      position += block.length;
+    }
+    return Status::OK();
   }
 };
 
@@ -510,12 +574,28 @@ struct ValidateArrayFullImpl {
 
     const int8_t* type_codes = data.GetValues<int8_t>(1);
 
-    for (int64_t i = 0; i < data.length; ++i) {
-      // Note that union arrays never have top-level nulls
-      const int32_t code = type_codes[i];
-      if (code < 0 || child_ids[code] == UnionType::kInvalidChildId) {
-        return Status::Invalid("Union value at position ", i, " has invalid type id ",
-                               code);
+    // Map all 256 byte values (including negative ones) to their validity
+    // as a type code, for a branch-free lookup
+    uint8_t code_is_valid[256] = {};
+    for (int code = 0; code <= UnionType::kMaxTypeCode; ++code) {
+      code_is_valid[code] = child_ids[code] != UnionType::kInvalidChildId;
+    }
+    for (int64_t block_start = 0; block_start < data.length;
+         block_start += kValidationBlockSize) {
+      const int64_t block_end = std::min(block_start + kValidationBlockSize, data.length);
+      int block_invalid = 0;
+      for (int64_t i = block_start; i < block_end; ++i) {
+        // Note that union arrays never have top-level nulls
+        block_invalid |= !code_is_valid[static_cast<uint8_t>(type_codes[i])];
+      }
+      if (ARROW_PREDICT_FALSE(block_invalid)) {
+        for (int64_t i = block_start; i < block_end; ++i) {
+          const int32_t code = type_codes[i];
+          if (code < 0 || child_ids[code] == UnionType::kInvalidChildId) {
+            return Status::Invalid("Union value at position ", i,
+                                   " has invalid type id ", code);
+          }
+        }
       }
     }
 
@@ -528,18 +608,31 @@ struct ValidateArrayFullImpl {
 
       // Check offsets are in bounds
       const int32_t* offsets = data.GetValues<int32_t>(2);
-      for (int64_t i = 0; i < data.length; ++i) {
-        const int32_t code = type_codes[i];
-        const int32_t offset = offsets[i];
-        if (offset < 0) {
-          return Status::Invalid("Union value at position ", i, " has negative offset ",
-                                 offset);
+      for (int64_t block_start = 0; block_start < data.length;
+           block_start += kValidationBlockSize) {
+        const int64_t block_end =
+            std::min(block_start + kValidationBlockSize, data.length);
+        int block_invalid = 0;
+        for (int64_t i = block_start; i < block_end; ++i) {
+          const int64_t offset = offsets[i];
+          block_invalid |= (offset < 0) | (offset >= child_lengths[type_codes[i]]);
         }
-        if (offset >= child_lengths[code]) {
-          return Status::Invalid("Union value at position ", i,
-                                 " has offset larger "
-                                 "than child length (",
-                                 offset, " >= ", child_lengths[code], ")");
+        if (ARROW_PREDICT_TRUE(!block_invalid)) {
+          continue;
+        }
+        for (int64_t i = block_start; i < block_end; ++i) {
+          const int32_t code = type_codes[i];
+          const int32_t offset = offsets[i];
+          if (offset < 0) {
+            return Status::Invalid("Union value at position ", i,
+                                   " has negative offset ", offset);
+          }
+          if (offset >= child_lengths[code]) {
+            return Status::Invalid("Union value at position ", i,
+                                   " has offset larger "
+                                   "than child length (",
+                                   offset, " >= ", child_lengths[code], ")");
+          }
         }
       }
     }
@@ -601,22 +694,41 @@ struct ValidateArrayFullImpl {
       return Status::Invalid("Non-empty array but offsets are null");
     }
 
-    auto prev_offset = offsets[0];
-    if (prev_offset < 0) {
+    if (offsets[0] < 0) {
       return Status::Invalid("Offset invariant failure: array starts at negative offset ",
-                             prev_offset);
-    }
-    for (int64_t i = 1; i <= data.length; ++i) {
-      const auto current_offset = offsets[i];
-      if (current_offset < prev_offset) {
-        return Status::Invalid("Offset invariant failure: non-monotonic offset at slot ",
-                               i, ": ", current_offset, " < ", prev_offset);
+                             offsets[0]);
+    }
+    // Offsets can't exceed the limit if it is out of their range
+    const auto limit = static_cast<offset_type>(std::min<int64_t>(
+        offset_limit, std::numeric_limits<offset_type>::max()));
+
+    // Check blocks of offsets branch-free (which the compiler can vectorize),
+    // and only look for the offending offset if a block is invalid
+    for (int64_t block_start = 1; block_start <= data.length;
+         block_start += kValidationBlockSize) {
+      const int64_t block_end =
+          std::min(block_start + kValidationBlockSize, data.length + 1);
+      int block_invalid = 0;
+      for (int64_t i = block_start; i < block_end; ++i) {
+        block_invalid |= (offsets[i] < offsets[i - 1]) | (offsets[i] > limit);
       }
-      if (current_offset > offset_limit) {
-        return Status::Invalid("Offset invariant failure: offset for slot ", i,
-                               " out of bounds: ", current_offset, " > ", offset_limit);
+      if (ARROW_PREDICT_TRUE(!block_invalid)) {
+        continue;
+      }
+      for (int64_t i = block_start; i < block_end; ++i) {
+        const auto prev_offset = offsets[i - 1];
+        const auto current_offset = offsets[i];
+        if (current_offset < prev_offset) {
+          return Status::Invalid(
+              "Offset invariant failure: non-monotonic offset at slot ", i, ": ",
+              current_offset, " < ", prev_offset);
+        }
+        if (current_offset > offset_limit) {
+          return Status::Invalid("Offset invariant failure: offset for slot ", i,
+                                 " out of bounds: ", current_offset, " > ",
+                                 offset_limit);
+        }
       }
-      prev_offset = current_offset;
     }
     return Status::OK();
   }
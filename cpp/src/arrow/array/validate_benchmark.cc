@@ -0,0 +1,184 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "arrow/array.h"
+#include "arrow/array/builder_binary.h"
+#include "arrow/record_batch.h"
+#include "arrow/table.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
+#include "arrow/util/benchmark_util.h"
+#include "arrow/util/logging.h"
+
+namespace arrow {
+
+constexpr auto kSeed = 0x94378165;
+constexpr int64_t kNumItems = 1 << 20;
+
+static void ValidateSetArgs(benchmark::internal::Benchmark* bench) {
+  bench->Unit(benchmark::kMicrosecond);
+  // 0 is treated as "no nulls"
+  for (const auto inverse_null_proportion : std::vector<ArgsType>({0, 100, 2})) {
+    bench->Args({static_cast<ArgsType>(kNumItems), inverse_null_proportion});
+  }
+}
+
+static void BenchmarkValidateFull(const Array& array, benchmark::State& state) {
+  for (auto _ : state) {
+    ABORT_NOT_OK(array.ValidateFull());
+  }
+}
+
+static void ValidateFullString(benchmark::State& state) {
+  RegressionArgs args(state, /*size_is_bytes=*/false);
+
+  auto rng = random::RandomArrayGenerator(kSeed);
+  auto array =
+      rng.String(args.size, /*min_length=*/0, /*max_length=*/32, args.null_proportion);
+
+  BenchmarkValidateFull(*array, state);
+}
+
+static void ValidateFullStringNonAscii(benchmark::State& state) {
+  RegressionArgs args(state, /*size_is_bytes=*/false);
+
+  // Mix of 1- to 4-byte UTF8 characters
+  const std::vector<std::string> words = {"Voix",   "ambiguë", "d’un",  "cœur",
+                                          "いろは", "😀",      "naïve", "test"};
+  auto rng = random::RandomArrayGenerator(kSeed);
+  auto word_indices = std::static_pointer_cast<Int32Array>(
+      rng.Int32(args.size * 4, 0, static_cast<int32_t>(words.size() - 1), 0.0));
+  auto null_bitmap = rng.NullBitmap(args.size, args.null_proportion);
+
+  StringBuilder builder;
+  ABORT_NOT_OK(builder.Reserve(args.size));
+  for (int64_t i = 0; i < args.size; ++i) {
+    if (!BitUtil::GetBit(null_bitmap->data(), i)) {
+      ABORT_NOT_OK(builder.AppendNull());
+      continue;
+    }
+    std::string value;
+    for (int64_t j = 0; j < 4; ++j) {
+      value += words[word_indices->Value(i * 4 + j)];
+    }
+    ABORT_NOT_OK(builder.Append(value));
+  }
+  std::shared_ptr<Array> array;
+  ABORT_NOT_OK(builder.Finish(&array));
+
+  BenchmarkValidateFull(*array, state);
+}
+
+static void ValidateFullListOfInt32(benchmark::State& state) {
+  RegressionArgs args(state, /*size_is_bytes=*/false);
+
+  auto rng = random::RandomArrayGenerator(kSeed);
+  auto values = rng.Int32(args.size * 10, 0, 100, args.null_proportion);
+  auto array = rng.List(*values, /*size=*/args.size, args.null_proportion,
+                        /*force_empty_nulls=*/true);
+
+  BenchmarkValidateFull(*array, state);
+}
+
+static void ValidateFullDictionary(benchmark::State& state) {
+  RegressionArgs args(state, /*size_is_bytes=*/false);
+
+  auto rng = random::RandomArrayGenerator(kSeed);
+  auto dict = rng.String(1000, /*min_length=*/0, /*max_length=*/15, 0.0);
+  auto indices = rng.Int32(args.size, 0, 999, args.null_proportion);
+  auto array = *DictionaryArray::FromArrays(dictionary(int32(), utf8()), indices, dict);
+
+  BenchmarkValidateFull(*array, state);
+}
+
+static void ValidateFullDenseUnion(benchmark::State& state) {
+  // dense_union<int32, utf8>
+  RegressionArgs args(state, /*size_is_bytes=*/false);
+
+  auto rng = random::RandomArrayGenerator(kSeed);
+  auto values1 = rng.Int32(args.size, 0, 100, args.null_proportion);
+  auto values2 =
+      rng.String(args.size, /*min_length=*/0, /*max_length=*/15, args.null_proportion);
+  auto array = rng.DenseUnion({values1, values2}, args.size);
+
+  BenchmarkValidateFull(*array, state);
+}
+
+static std::shared_ptr<Table> MakeValidationTable(int64_t num_rows, int num_chunks) {
+  auto rng = random::RandomArrayGenerator(kSeed);
+  std::vector<std::shared_ptr<Field>> fields;
+  std::vector<std::shared_ptr<ChunkedArray>> columns;
+  for (int i = 0; i < 8; ++i) {
+    ArrayVector chunks;
+    for (int j = 0; j < num_chunks; ++j) {
+      chunks.push_back(rng.String(num_rows / num_chunks, /*min_length=*/0,
+                                  /*max_length=*/32, /*null_probability=*/0.01));
+    }
+    fields.push_back(field("f" + std::to_string(i), utf8()));
+    columns.push_back(std::make_shared<ChunkedArray>(std::move(chunks)));
+  }
+  return Table::Make(schema(std::move(fields)), std::move(columns));
+}
+
+static void ValidateFullRecordBatch(benchmark::State& state) {
+  // 8 string columns
+  const bool use_threads = state.range(0) != 0;
+  auto table = MakeValidationTable(kNumItems, /*num_chunks=*/1);
+  auto batch = *TableBatchReader(*table).Next();
+
+  for (auto _ : state) {
+    ABORT_NOT_OK(batch->ValidateFull(use_threads));
+  }
+  state.SetItemsProcessed(state.iterations() * batch->num_rows() * batch->num_columns());
+}
+
+static void ValidateFullTable(benchmark::State& state) {
+  // 8 string columns of 16 chunks each
+  const bool use_threads = state.range(0) != 0;
+  auto table = MakeValidationTable(kNumItems, /*num_chunks=*/16);
+
+  for (auto _ : state) {
+    ABORT_NOT_OK(table->ValidateFull(use_threads));
+  }
+  state.SetItemsProcessed(state.iterations() * table->num_rows() * table->num_columns());
+}
+
+BENCHMARK(ValidateFullString)->Apply(ValidateSetArgs);
+BENCHMARK(ValidateFullStringNonAscii)->Apply(ValidateSetArgs);
+BENCHMARK(ValidateFullListOfInt32)->Apply(ValidateSetArgs);
+BENCHMARK(ValidateFullDictionary)->Apply(ValidateSetArgs);
+BENCHMARK(ValidateFullDenseUnion)->Apply(ValidateSetArgs);
+BENCHMARK(ValidateFullRecordBatch)
+    ->ArgName("use_threads")
+    ->Arg(0)
+    ->Arg(1)
+    ->Unit(benchmark::kMicrosecond)
+    ->UseRealTime();
+BENCHMARK(ValidateFullTable)
+    ->ArgName("use_threads")
+    ->Arg(0)
+    ->Arg(1)
+    ->Unit(benchmark::kMicrosecond)
+    ->UseRealTime();
+
+}  // namespace arrow
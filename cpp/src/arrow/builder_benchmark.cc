@@ -26,6 +26,7 @@
 #include "benchmark/benchmark.h"
 
 #include "arrow/builder.h"
+#include "arrow/chunked_array.h"
 #include "arrow/memory_pool.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/util/bit_util.h"
@@ -125,9 +126,16 @@ static void BuildBooleanArrayNoNulls(
   state.SetBytesProcessed(state.iterations() * kBytesProcessed);
 }
 
+// Report the peak memory used while building, to be compared with the
+// kBytesProcessPerRound * kRounds bytes of data built
+static void SetPeakMemory(benchmark::State& state, const ProxyMemoryPool& pool) {
+  state.counters["peak_memory"] = static_cast<double>(pool.max_memory());
+}
+
 static void BuildBinaryArray(benchmark::State& state) {  // NOLINT non-const reference
+  ProxyMemoryPool pool(default_memory_pool());
   for (auto _ : state) {
-    BinaryBuilder builder;
+    BinaryBuilder builder(&pool);
 
     for (int64_t i = 0; i < kRounds * kNumberOfElements; i++) {
       ABORT_NOT_OK(builder.Append(kBinaryView));
@@ -138,6 +146,7 @@ static void BuildBinaryArray(benchmark::State& state) {  // NOLINT non-const ref
   }
 
   state.SetBytesProcessed(state.iterations() * kBytesProcessed);
+  SetPeakMemory(state, pool);
 }
 
 static void BuildChunkedBinaryArray(
@@ -145,8 +154,9 @@ static void BuildChunkedBinaryArray(
   // 1MB chunks
   const int32_t kChunkSize = 1 << 20;
 
+  ProxyMemoryPool pool(default_memory_pool());
   for (auto _ : state) {
-    internal::ChunkedBinaryBuilder builder(kChunkSize);
+    internal::ChunkedBinaryBuilder builder(kChunkSize, &pool);
 
     for (int64_t i = 0; i < kRounds * kNumberOfElements; i++) {
       ABORT_NOT_OK(builder.Append(kBinaryView));
@@ -157,6 +167,49 @@ static void BuildChunkedBinaryArray(
   }
 
   state.SetBytesProcessed(state.iterations() * kBytesProcessed);
+  SetPeakMemory(state, pool);
+}
+
+template <typename Type>
+static void BuildChunkedBaseBinaryArray(
+    benchmark::State& state) {  // NOLINT non-const reference
+  // Chunks of at most 64MB of data, allocated at once
+  const int64_t kChunkValueLength = 1 << 26;
+  const int64_t kChunkLength = kChunkValueLength / kBinaryView.size();
+
+  ProxyMemoryPool pool(default_memory_pool());
+  for (auto _ : state) {
+    internal::ChunkedBaseBinaryBuilder<Type> builder(kChunkLength, kChunkValueLength,
+                                                     &pool);
+
+    for (int64_t i = 0; i < kRounds * kNumberOfElements; i++) {
+      ABORT_NOT_OK(builder.Append(kBinaryView));
+    }
+
+    std::shared_ptr<ChunkedArray> out;
+    ABORT_NOT_OK(builder.Finish(&out));
+  }
+
+  state.SetBytesProcessed(state.iterations() * kBytesProcessed);
+  SetPeakMemory(state, pool);
+}
+
+static void BuildLargeBinaryArray(
+    benchmark::State& state) {  // NOLINT non-const reference
+  ProxyMemoryPool pool(default_memory_pool());
+  for (auto _ : state) {
+    LargeBinaryBuilder builder(&pool);
+
+    for (int64_t i = 0; i < kRounds * kNumberOfElements; i++) {
+      ABORT_NOT_OK(builder.Append(kBinaryView));
+    }
+
+    std::shared_ptr<Array> out;
+    ABORT_NOT_OK(builder.Finish(&out));
+  }
+
+  state.SetBytesProcessed(state.iterations() * kBytesProcessed);
+  SetPeakMemory(state, pool);
 }
 
 static void BuildFixedSizeBinaryArray(
@@ -440,6 +493,9 @@ BENCHMARK(BuildAdaptiveIntNoNullsScalarAppend);
 
 BENCHMARK(BuildBinaryArray);
 BENCHMARK(BuildChunkedBinaryArray);
+BENCHMARK_TEMPLATE(BuildChunkedBaseBinaryArray, BinaryType);
+BENCHMARK(BuildLargeBinaryArray);
+BENCHMARK_TEMPLATE(BuildChunkedBaseBinaryArray, LargeBinaryType);
 BENCHMARK(BuildFixedSizeBinaryArray);
 BENCHMARK(BuildDecimalArray);
 
@@ -69,6 +69,69 @@ Result<std::shared_ptr<Array>> SortIndices(const Datum& datum, const SortOptions
   return result.make_array();
 }
 
+Result<std::shared_ptr<ListArray>> PartitionIndices(const Datum& partition_ids,
+                                                    const PartitionOptions& options,
+                                                    ExecContext* ctx) {
+  ARROW_ASSIGN_OR_RAISE(
+      Datum result, CallFunction("partition_indices", {partition_ids}, &options, ctx));
+  return checked_pointer_cast<ListArray>(result.make_array());
+}
+
+Result<std::shared_ptr<ListArray>> HashPartitionIndices(const std::vector<Datum>& keys,
+                                                        const PartitionOptions& options,
+                                                        ExecContext* ctx) {
+  ARROW_ASSIGN_OR_RAISE(Datum result,
+                        CallFunction("hash_partition_indices", keys, &options, ctx));
+  return checked_pointer_cast<ListArray>(result.make_array());
+}
+
+namespace {
+
+Result<RecordBatchVector> TakePartitions(const RecordBatch& batch,
+                                         const ListArray& indices, ExecContext* ctx) {
+  // Gather the rows of all partitions at once, then slice each partition out
+  ArrayVector columns(batch.num_columns());
+  for (int i = 0; i < batch.num_columns(); ++i) {
+    ARROW_ASSIGN_OR_RAISE(columns[i], Take(*batch.column(i), *indices.values(),
+                                           TakeOptions::NoBoundsCheck(), ctx));
+  }
+  auto taken = RecordBatch::Make(batch.schema(), indices.values()->length(),
+                                 std::move(columns));
+  RecordBatchVector partitions(indices.length());
+  for (int64_t i = 0; i < indices.length(); ++i) {
+    partitions[i] = taken->Slice(indices.value_offset(i), indices.value_length(i));
+  }
+  return partitions;
+}
+
+}  // namespace
+
+Result<RecordBatchVector> Partition(const RecordBatch& batch, const Datum& partition_ids,
+                                    const PartitionOptions& options, ExecContext* ctx) {
+  if (partition_ids.length() != batch.num_rows()) {
+    return Status::Invalid("Partition ids have length ", partition_ids.length(),
+                           ", expected ", batch.num_rows());
+  }
+  ARROW_ASSIGN_OR_RAISE(auto indices, PartitionIndices(partition_ids, options, ctx));
+  return TakePartitions(batch, *indices, ctx);
+}
+
+Result<RecordBatchVector> HashPartition(const RecordBatch& batch,
+                                        const std::vector<std::string>& key_names,
+                                        const PartitionOptions& options,
+                                        ExecContext* ctx) {
+  std::vector<Datum> keys;
+  for (const auto& name : key_names) {
+    auto column = batch.GetColumnByName(name);
+    if (column == nullptr) {
+      return Status::Invalid("No column named '", name, "' in record batch");
+    }
+    keys.emplace_back(std::move(column));
+  }
+  ARROW_ASSIGN_OR_RAISE(auto indices, HashPartitionIndices(keys, options, ctx));
+  return TakePartitions(batch, *indices, ctx);
+}
+
 Result<std::shared_ptr<Array>> Unique(const Datum& value, ExecContext* ctx) {
   ARROW_ASSIGN_OR_RAISE(Datum result, CallFunction("unique", {value}, ctx));
   return result.make_array();
@@ -78,6 +141,10 @@ Result<Datum> DictionaryEncode(const Datum& value, ExecContext* ctx) {
   return CallFunction("dictionary_encode", {value}, ctx);
 }
 
+Result<Datum> Hash64(const std::vector<Datum>& values, ExecContext* ctx) {
+  return CallFunction("hash64", values, ctx);
+}
+
 const char kValuesFieldName[] = "values";
 const char kCountsFieldName[] = "counts";
 const int32_t kValuesFieldIndex = 0;
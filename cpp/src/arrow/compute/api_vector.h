@@ -18,6 +18,8 @@
 #pragma once
 
 #include <memory>
+#include <string>
+#include <vector>
 
 #include "arrow/compute/function.h"
 #include "arrow/datum.h"
@@ -98,6 +100,14 @@ struct ARROW_EXPORT PartitionNthOptions : public FunctionOptions {
   int64_t pivot;
 };
 
+/// \brief Options for splitting rows into partitions
+struct ARROW_EXPORT PartitionOptions : public FunctionOptions {
+  explicit PartitionOptions(int32_t num_partitions) : num_partitions(num_partitions) {}
+
+  /// The number of partitions, strictly positive
+  int32_t num_partitions;
+};
+
 /// @}
 
 /// \brief Filter with a boolean selection filter
@@ -251,6 +261,81 @@ ARROW_EXPORT
 Result<std::shared_ptr<Array>> SortIndices(const Datum& datum, const SortOptions& options,
                                            ExecContext* ctx = NULLPTR);
 
+/// \brief Compute the indices of the rows of each partition
+///
+/// Return a list array with, for each partition, the indices of the rows whose
+/// partition id is that partition, in increasing order.  The rows of a chunked
+/// array are numbered across chunks.
+///
+/// For example given partition_ids = [1, 0, 1, 2, 1] and 4 partitions, the
+/// output will be [[1], [0, 2, 4], [3], []].
+///
+/// \param[in] partition_ids integer array-like, without nulls, with values
+/// lower than options.num_partitions
+/// \param[in] options the number of partitions
+/// \param[in] ctx the function execution context, optional
+/// \return a list<uint64> array with options.num_partitions lists
+///
+/// \since 4.0.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Result<std::shared_ptr<ListArray>> PartitionIndices(const Datum& partition_ids,
+                                                    const PartitionOptions& options,
+                                                    ExecContext* ctx = NULLPTR);
+
+/// \brief Compute the indices of the rows of each partition, by hash of keys
+///
+/// Like PartitionIndices, with the partition of each row derived from the
+/// hash of its keys (see Hash64), so that equal keys end up in the same
+/// partition.
+///
+/// \param[in] keys array-like key columns, all of the same length
+/// \param[in] options the number of partitions
+/// \param[in] ctx the function execution context, optional
+/// \return a list<uint64> array with options.num_partitions lists
+///
+/// \since 4.0.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Result<std::shared_ptr<ListArray>> HashPartitionIndices(const std::vector<Datum>& keys,
+                                                        const PartitionOptions& options,
+                                                        ExecContext* ctx = NULLPTR);
+
+/// \brief Split a record batch into partitions given the partition id of each row
+///
+/// The rows of all partitions are gathered with a single Take, each output
+/// batch being a slice of the result.  Rows keep their relative order within
+/// each partition.
+///
+/// \param[in] batch the record batch to split
+/// \param[in] partition_ids integer array, see PartitionIndices
+/// \param[in] options the number of partitions
+/// \param[in] ctx the function execution context, optional
+/// \return options.num_partitions record batches, some of them possibly empty
+///
+/// \since 4.0.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Result<RecordBatchVector> Partition(const RecordBatch& batch, const Datum& partition_ids,
+                                    const PartitionOptions& options,
+                                    ExecContext* ctx = NULLPTR);
+
+/// \brief Split a record batch into partitions by hash of some of its columns
+///
+/// \param[in] batch the record batch to split
+/// \param[in] key_names the names of the key columns
+/// \param[in] options the number of partitions
+/// \param[in] ctx the function execution context, optional
+/// \return options.num_partitions record batches, some of them possibly empty
+///
+/// \since 4.0.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Result<RecordBatchVector> HashPartition(const RecordBatch& batch,
+                                        const std::vector<std::string>& key_names,
+                                        const PartitionOptions& options,
+                                        ExecContext* ctx = NULLPTR);
+
 /// \brief Compute unique elements from an array-like object
 ///
 /// Note if a null occurs in the input it will NOT be included in the output.
@@ -298,6 +383,23 @@ Result<std::shared_ptr<StructArray>> ValueCounts(const Datum& value,
 ARROW_EXPORT
 Result<Datum> DictionaryEncode(const Datum& data, ExecContext* ctx = NULLPTR);
 
+/// \brief Compute the 64-bit hashes of the rows of one or more array-like objects
+///
+/// Equal rows hash to the same value, whatever the layout of the data (offsets,
+/// chunks or dictionaries), so the hashes can be used to partition data.  The
+/// hashes of the values of each row are combined in order.  Nulls hash to a
+/// fixed value.  For floating point values, -0.0 and 0.0 hash alike, and so do
+/// all NaNs.
+///
+/// \param[in] values array-like inputs of any type, all of the same length
+/// \param[in] ctx the function execution context, optional
+/// \return a UInt64 array-like with the hash of each row
+///
+/// \since 4.0.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Result<Datum> Hash64(const std::vector<Datum>& values, ExecContext* ctx = NULLPTR);
+
 // ----------------------------------------------------------------------
 // Deprecated functions
 
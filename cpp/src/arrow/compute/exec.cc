@@ -512,6 +512,7 @@ class ScalarExecutor : public KernelExecutorImpl<ScalarKernel> {
     RETURN_NOT_OK(PrepareExecute(args));
     ExecBatch batch;
     while (batch_iterator_->Next(&batch)) {
+      RETURN_NOT_OK(exec_context()->stop_token().Poll());
       RETURN_NOT_OK(ExecuteBatch(batch, listener));
     }
     if (preallocate_contiguous_) {
@@ -708,6 +709,7 @@ class VectorExecutor : public KernelExecutorImpl<VectorKernel> {
     ExecBatch batch;
     if (kernel_->can_execute_chunkwise) {
       while (batch_iterator_->Next(&batch)) {
+        RETURN_NOT_OK(exec_context()->stop_token().Poll());
         RETURN_NOT_OK(ExecuteBatch(batch, listener));
       }
     } else {
@@ -814,6 +816,7 @@ class ScalarAggExecutor : public KernelExecutorImpl<ScalarAggregateKernel> {
 
     ExecBatch batch;
     while (batch_iterator_->Next(&batch)) {
+      RETURN_NOT_OK(exec_context()->stop_token().Poll());
       // TODO: implement parallelism
       if (batch.length > 0) {
         RETURN_NOT_OK(Consume(batch));
@@ -32,6 +32,7 @@
 #include "arrow/memory_pool.h"
 #include "arrow/result.h"
 #include "arrow/type_fwd.h"
+#include "arrow/util/cancel.h"
 #include "arrow/util/macros.h"
 #include "arrow/util/visibility.h"
 
@@ -65,6 +66,15 @@ class ARROW_EXPORT ExecContext {
   /// default_memory_pool().
   MemoryPool* memory_pool() const { return pool_; }
 
+  /// \brief The MemoryPool used for scratch allocations, which don't outlive the
+  /// function call or kernel batch which made them (for example, intermediate
+  /// selection indices). Defaults to memory_pool().
+  MemoryPool* scratch_pool() const { return scratch_pool_ ? scratch_pool_ : pool_; }
+
+  /// \brief Set the MemoryPool used for scratch allocations, typically an
+  /// ArenaMemoryPool reset by the caller between batches.
+  void set_scratch_pool(MemoryPool* pool) { scratch_pool_ = pool; }
+
   ::arrow::internal::CpuInfo* cpu_info() const;
 
   /// \brief The FunctionRegistry for looking up functions by name and
@@ -111,9 +121,20 @@ class ARROW_EXPORT ExecContext {
   /// set_preallocate_contiguous() for more information.
   bool preallocate_contiguous() const { return preallocate_contiguous_; }
 
+  /// \brief Set a token allowing to cancel function execution. The token is
+  /// polled between execution batches; if a stop was requested, execution
+  /// fails with the error given to StopSource::RequestStop().
+  void set_stop_token(StopToken stop_token) { stop_token_ = std::move(stop_token); }
+
+  /// \brief The token allowing to cancel function execution, by default a token
+  /// which is never stopped.
+  const StopToken& stop_token() const { return stop_token_; }
+
  private:
   MemoryPool* pool_;
+  MemoryPool* scratch_pool_ = NULLPTR;
   FunctionRegistry* func_registry_;
+  StopToken stop_token_;
   int64_t exec_chunksize_ = std::numeric_limits<int64_t>::max();
   bool preallocate_contiguous_ = true;
   bool use_threads_ = true;
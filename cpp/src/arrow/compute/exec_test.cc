@@ -39,6 +39,7 @@
 #include "arrow/type.h"
 #include "arrow/util/bit_util.h"
 #include "arrow/util/bitmap_ops.h"
+#include "arrow/util/cancel.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/cpu_info.h"
 #include "arrow/util/logging.h"
@@ -832,6 +833,25 @@ TEST_F(TestCallScalarFunction, BasicNonStandardCases) {
   CheckFunction("test_nopre_validity_or_data");
 }
 
+TEST_F(TestCallScalarFunction, Cancellation) {
+  auto arr = GetUInt8Array(1000, /*null_prob=*/0.2);
+  std::vector<Datum> args = {Datum(arr)};
+
+  ResetContexts();
+  StopSource stop_source;
+  exec_ctx_->set_stop_token(stop_source.token());
+  exec_ctx_->set_exec_chunksize(100);
+  ASSERT_OK(CallFunction("test_copy", args, exec_ctx_.get()));
+
+  stop_source.RequestStop();
+  ASSERT_RAISES(Cancelled, CallFunction("test_copy", args, exec_ctx_.get()));
+  exec_ctx_->set_preallocate_contiguous(false);
+  ASSERT_RAISES(Cancelled, CallFunction("test_nopre_data", args, exec_ctx_.get()));
+
+  stop_source.Reset();
+  ASSERT_OK(CallFunction("test_copy", args, exec_ctx_.get()));
+}
+
 TEST_F(TestCallScalarFunction, StatefulKernel) {
   auto input = ArrayFromJSON(int32(), "[1, 2, 3, null, 5]");
   auto multiplier = std::make_shared<Int32Scalar>(2);
@@ -20,6 +20,7 @@
 #include "arrow/array/array_base.h"
 #include "arrow/compute/api.h"
 #include "arrow/memory_pool.h"
+#include "arrow/record_batch.h"
 #include "arrow/scalar.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/random.h"
@@ -174,11 +175,41 @@ void BM_ExecuteScalarKernelOnScalar(benchmark::State& state) {
   state.SetItemsProcessed(state.iterations() * N);
 }
 
+void BM_FilterRecordBatchScratch(benchmark::State& state) {
+  // Filter many small batches, optionally allocating the intermediate selection
+  // indices from an arena reset after each batch
+  const bool use_arena = state.range(0) != 0;
+  const int64_t length = 4096;
+  random::RandomArrayGenerator rag(kSeed);
+  auto batch = RecordBatch::Make(
+      schema({field("a", int64()), field("b", float64()), field("c", list(int32()))}),
+      length,
+      {rag.Int64(length, 0, 1 << 20, 0.1), rag.Float64(length, 0, 1, 0.1),
+       rag.List(*rag.Int32(length * 4, 0, 100), length, 0.1)});
+  auto filter = rag.Boolean(length, 0.5, 0.1);
+
+  ArenaMemoryPool arena;
+  ExecContext exec_context;
+  if (use_arena) {
+    exec_context.set_scratch_pool(&arena);
+  }
+  for (auto _ : state) {
+    ABORT_NOT_OK(
+        Filter(batch, filter, FilterOptions::Defaults(), &exec_context).status());
+    if (use_arena) {
+      arena.Reset();
+    }
+  }
+
+  state.SetItemsProcessed(state.iterations() * length);
+}
+
 BENCHMARK(BM_CastDispatch);
 BENCHMARK(BM_CastDispatchBaseline);
 BENCHMARK(BM_AddDispatch);
 BENCHMARK(BM_ExecuteScalarFunctionOnScalar);
 BENCHMARK(BM_ExecuteScalarKernelOnScalar);
+BENCHMARK(BM_FilterRecordBatchScratch)->ArgName("arena")->Arg(0)->Arg(1);
 
 }  // namespace compute
 }  // namespace arrow
@@ -49,6 +49,10 @@ Result<std::shared_ptr<ResizableBuffer>> KernelContext::Allocate(int64_t nbytes)
   return AllocateResizableBuffer(nbytes, exec_ctx_->memory_pool());
 }
 
+Result<std::shared_ptr<ResizableBuffer>> KernelContext::AllocateScratch(int64_t nbytes) {
+  return AllocateResizableBuffer(nbytes, exec_ctx_->scratch_pool());
+}
+
 Result<std::shared_ptr<ResizableBuffer>> KernelContext::AllocateBitmap(int64_t num_bits) {
   const int64_t nbytes = BitUtil::BytesForBits(num_bits);
   ARROW_ASSIGN_OR_RAISE(std::shared_ptr<ResizableBuffer> result,
@@ -94,6 +94,14 @@ class ARROW_EXPORT KernelContext {
   /// MemoryPool contained in the ExecContext used to create the KernelContext.
   MemoryPool* memory_pool() { return exec_ctx_->memory_pool(); }
 
+  /// \brief The memory pool to use for scratch allocations, which must not
+  /// outlive the current batch. See ExecContext::scratch_pool().
+  MemoryPool* scratch_pool() { return exec_ctx_->scratch_pool(); }
+
+  /// \brief Allocate a scratch buffer from the context's scratch pool. The
+  /// contents are not initialized.
+  Result<std::shared_ptr<ResizableBuffer>> AllocateScratch(int64_t nbytes);
+
  private:
   ExecContext* exec_ctx_;
   Status status_;
@@ -15,8 +15,12 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <algorithm>
+#include <cmath>
 #include <cstring>
+#include <limits>
 #include <mutex>
+#include <vector>
 
 #include "arrow/array/array_base.h"
 #include "arrow/array/array_dict.h"
@@ -27,8 +31,11 @@
 #include "arrow/compute/api_vector.h"
 #include "arrow/compute/kernels/common.h"
 #include "arrow/result.h"
+#include "arrow/util/bit_run_reader.h"
+#include "arrow/util/bitmap_reader.h"
 #include "arrow/util/hashing.h"
 #include "arrow/util/make_unique.h"
+#include "arrow/visitor_inline.h"
 
 namespace arrow {
 
@@ -627,6 +634,318 @@ void AddHashKernels(VectorFunction* func, VectorKernel base, OutputType out_ty)
   }
 }
 
+// ----------------------------------------------------------------------
+// Row-wise hashing of one or more columns (hash64)
+
+// The hash of null values, at any nesting level
+constexpr uint64_t kNullHash = 0x3c6ef372fe94f82bULL;
+// The initial hash of lists, before combining the hashes of their elements
+constexpr uint64_t kListSeed = 0x510e527fade682d1ULL;
+
+// As in boost::hash_combine, with a 64-bit constant
+inline uint64_t CombineHashes(uint64_t h, uint64_t value_hash) {
+  return h ^ (value_hash + 0x9e3779b97f4a7c15ULL + (h << 6) + (h >> 2));
+}
+
+template <int kByteWidth>
+inline uint64_t HashBytes(const uint8_t* value) {
+  return XXH3_64bits(value, kByteWidth);
+}
+
+// Compute the hashes of the values of an array into `out`.  Equal values hash
+// to the same value, whatever their position and the layout of the array
+// (offset, chunking, dictionary).  The values of nested types are hashed
+// recursively.
+class ArrayHasher {
+ public:
+  static Status Hash(const ArrayData& data, MemoryPool* pool, uint64_t* out) {
+    ArrayHasher hasher(data, pool, out);
+    RETURN_NOT_OK(VisitTypeInline(*data.type, &hasher));
+    hasher.HashNulls();
+    return Status::OK();
+  }
+
+  static Result<std::shared_ptr<Buffer>> Hash(const ArrayData& data, MemoryPool* pool) {
+    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Buffer> hashes,
+                          AllocateBuffer(data.length * sizeof(uint64_t), pool));
+    RETURN_NOT_OK(Hash(data, pool, reinterpret_cast<uint64_t*>(hashes->mutable_data())));
+    return std::move(hashes);
+  }
+
+  Status Visit(const NullType&) {
+    std::fill(out_, out_ + data_.length, kNullHash);
+    return Status::OK();
+  }
+
+  Status Visit(const BooleanType&) {
+    const uint8_t false_value = 0, true_value = 1;
+    const uint64_t hashes[2] = {HashBytes<1>(&false_value), HashBytes<1>(&true_value)};
+    const uint8_t* bitmap = data_.buffers[1]->data();
+    for (int64_t i = 0; i < data_.length; ++i) {
+      out_[i] = hashes[BitUtil::GetBit(bitmap, data_.offset + i)];
+    }
+    return Status::OK();
+  }
+
+  // Integers, temporal types, decimals, fixed size binary...
+  Status Visit(const FixedWidthType& type) {
+    switch (type.bit_width()) {
+      case 8:
+        return HashFixedWidth<1>();
+      case 16:
+        return HashFixedWidth<2>();
+      case 32:
+        return HashFixedWidth<4>();
+      case 64:
+        return HashFixedWidth<8>();
+      case 128:
+        return HashFixedWidth<16>();
+      default:
+        break;
+    }
+    const int byte_width = type.bit_width() / 8;
+    const uint8_t* values = data_.GetValues<uint8_t>(1, data_.offset * byte_width);
+    for (int64_t i = 0; i < data_.length; ++i) {
+      out_[i] = XXH3_64bits(values + i * byte_width, byte_width);
+    }
+    return Status::OK();
+  }
+
+  template <typename Type>
+  enable_if_physical_floating_point<Type, Status> Visit(const Type&) {
+    using T = typename Type::c_type;
+    const T* values = data_.GetValues<T>(1);
+    uint64_t* out = out_;
+    for (int64_t i = 0, length = data_.length; i < length; ++i) {
+      // Values comparing equal must hash equal: normalize -0.0 and NaNs
+      // (written so as to compile without branches)
+      T value = values[i] == 0 ? 0 : values[i];
+      value = value != value ? std::numeric_limits<T>::quiet_NaN() : value;
+      out[i] = HashBytes<sizeof(T)>(reinterpret_cast<const uint8_t*>(&value));
+    }
+    return Status::OK();
+  }
+
+  template <typename Type>
+  enable_if_base_binary<Type, Status> Visit(const Type&) {
+    using offset_type = typename Type::offset_type;
+    static const uint8_t kEmpty = 0;
+    const offset_type* offsets = data_.GetValues<offset_type>(1);
+    const uint8_t* values =
+        data_.buffers[2] != nullptr ? data_.buffers[2]->data() : &kEmpty;
+    for (int64_t i = 0; i < data_.length; ++i) {
+      out_[i] = XXH3_64bits(values + offsets[i], offsets[i + 1] - offsets[i]);
+    }
+    return Status::OK();
+  }
+
+  Status Visit(const DictionaryType& type) {
+    // Hash the dictionary values once, then look up the hash of each index
+    ARROW_ASSIGN_OR_RAISE(auto dictionary_hashes, Hash(*data_.dictionary, pool_));
+    const auto hashes = reinterpret_cast<const uint64_t*>(dictionary_hashes->data());
+    switch (type.index_type()->id()) {
+      case Type::INT8:
+      case Type::UINT8:
+        return HashIndices<uint8_t>(hashes);
+      case Type::INT16:
+      case Type::UINT16:
+        return HashIndices<uint16_t>(hashes);
+      case Type::INT32:
+      case Type::UINT32:
+        return HashIndices<uint32_t>(hashes);
+      case Type::INT64:
+      case Type::UINT64:
+        return HashIndices<uint64_t>(hashes);
+      default:
+        return Status::TypeError("Invalid dictionary index type: ", *type.index_type());
+    }
+  }
+
+  Status Visit(const StructType& type) {
+    std::fill(out_, out_ + data_.length, kListSeed);
+    for (const auto& child : data_.child_data) {
+      ARROW_ASSIGN_OR_RAISE(auto child_hashes,
+                            Hash(*child->Slice(data_.offset, data_.length), pool_));
+      const auto hashes = reinterpret_cast<const uint64_t*>(child_hashes->data());
+      for (int64_t i = 0; i < data_.length; ++i) {
+        out_[i] = CombineHashes(out_[i], hashes[i]);
+      }
+    }
+    return Status::OK();
+  }
+
+  // List and map
+  Status Visit(const ListType&) { return HashLists(data_.GetValues<int32_t>(1)); }
+
+  Status Visit(const LargeListType&) { return HashLists(data_.GetValues<int64_t>(1)); }
+
+  Status Visit(const FixedSizeListType& type) {
+    const int64_t list_size = type.list_size();
+    std::vector<int64_t> offsets(data_.length + 1);
+    for (int64_t i = 0; i <= data_.length; ++i) {
+      offsets[i] = (data_.offset + i) * list_size;
+    }
+    return HashLists(offsets.data());
+  }
+
+  Status Visit(const SparseUnionType& type) {
+    // All children are as long as the union
+    std::vector<std::shared_ptr<Buffer>> child_hashes;
+    for (const auto& child : data_.child_data) {
+      ARROW_ASSIGN_OR_RAISE(auto hashes,
+                            Hash(*child->Slice(data_.offset, data_.length), pool_));
+      child_hashes.push_back(std::move(hashes));
+    }
+    const int8_t* type_codes = data_.GetValues<int8_t>(1);
+    for (int64_t i = 0; i < data_.length; ++i) {
+      const int8_t code = type_codes[i];
+      const auto hashes = reinterpret_cast<const uint64_t*>(
+          child_hashes[type.child_ids()[code]]->data());
+      out_[i] = CombineHashes(HashBytes<1>(reinterpret_cast<const uint8_t*>(&code)),
+                              hashes[i]);
+    }
+    return Status::OK();
+  }
+
+  Status Visit(const DenseUnionType& type) {
+    std::vector<std::shared_ptr<Buffer>> child_hashes;
+    for (const auto& child : data_.child_data) {
+      ARROW_ASSIGN_OR_RAISE(auto hashes, Hash(*child, pool_));
+      child_hashes.push_back(std::move(hashes));
+    }
+    const int8_t* type_codes = data_.GetValues<int8_t>(1);
+    const int32_t* value_offsets = data_.GetValues<int32_t>(2);
+    for (int64_t i = 0; i < data_.length; ++i) {
+      const int8_t code = type_codes[i];
+      const auto hashes = reinterpret_cast<const uint64_t*>(
+          child_hashes[type.child_ids()[code]]->data());
+      out_[i] = CombineHashes(HashBytes<1>(reinterpret_cast<const uint8_t*>(&code)),
+                              hashes[value_offsets[i]]);
+    }
+    return Status::OK();
+  }
+
+  Status Visit(const ExtensionType& type) {
+    ArrayData storage(data_);
+    storage.type = type.storage_type();
+    return Hash(storage, pool_, out_);
+  }
+
+  Status Visit(const DataType& type) {
+    return Status::NotImplemented("Hashing values of type ", type);
+  }
+
+ private:
+  ArrayHasher(const ArrayData& data, MemoryPool* pool, uint64_t* out)
+      : data_(data), pool_(pool), out_(out) {}
+
+  template <int kByteWidth>
+  Status HashFixedWidth() {
+    const uint8_t* values = data_.GetValues<uint8_t>(1, data_.offset * kByteWidth);
+    uint64_t* out = out_;
+    for (int64_t i = 0, length = data_.length; i < length; ++i) {
+      out[i] = HashBytes<kByteWidth>(values + i * kByteWidth);
+    }
+    return Status::OK();
+  }
+
+  template <typename IndexCType>
+  Status HashIndices(const uint64_t* dictionary_hashes) {
+    const IndexCType* indices = data_.GetValues<IndexCType>(1);
+    // The indices of null values may be out of bounds
+    ::arrow::internal::VisitSetBitRunsVoid(
+        data_.buffers[0], data_.offset, data_.length,
+        [&](int64_t position, int64_t length) {
+          for (int64_t i = position; i < position + length; ++i) {
+            out_[i] = dictionary_hashes[indices[i]];
+          }
+        });
+    return Status::OK();
+  }
+
+  template <typename OffsetType>
+  Status HashLists(const OffsetType* offsets) {
+    const OffsetType values_offset = offsets[0];
+    ARROW_ASSIGN_OR_RAISE(
+        auto value_hashes,
+        Hash(*data_.child_data[0]->Slice(values_offset,
+                                         offsets[data_.length] - values_offset),
+             pool_));
+    const auto hashes =
+        reinterpret_cast<const uint64_t*>(value_hashes->data()) - values_offset;
+    for (int64_t i = 0; i < data_.length; ++i) {
+      uint64_t h = kListSeed;
+      for (OffsetType j = offsets[i]; j < offsets[i + 1]; ++j) {
+        h = CombineHashes(h, hashes[j]);
+      }
+      out_[i] = h;
+    }
+    return Status::OK();
+  }
+
+  // Null values hash to kNullHash, whatever their type and underlying values
+  void HashNulls() {
+    if (data_.buffers[0] == nullptr || data_.GetNullCount() == 0) {
+      return;
+    }
+    uint64_t* out = out_;
+    const int64_t length = data_.length;
+    ::arrow::internal::BitmapUInt64Reader reader(data_.buffers[0]->data(), data_.offset,
+                                                 length);
+    for (int64_t position = 0; position < length; position += 64) {
+      uint64_t nulls = ~reader.NextWord();
+      if (length - position < 64) {
+        nulls &= BitUtil::LeastSignificantBitMask(length - position);
+      }
+      for (; nulls != 0; nulls &= nulls - 1) {
+        out[position + BitUtil::CountTrailingZeros(nulls)] = kNullHash;
+      }
+    }
+  }
+
+  const ArrayData& data_;
+  MemoryPool* pool_;
+  uint64_t* out_;
+};
+
+Status Hash64Batch(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
+  ARROW_ASSIGN_OR_RAISE(auto hashes, ctx->Allocate(batch.length * sizeof(uint64_t)));
+  auto out_hashes = reinterpret_cast<uint64_t*>(hashes->mutable_data());
+  std::shared_ptr<Buffer> column_hashes;
+  for (int i = 0; i < batch.num_values(); ++i) {
+    std::shared_ptr<ArrayData> column;
+    if (batch[i].is_scalar()) {
+      ARROW_ASSIGN_OR_RAISE(auto array, MakeArrayFromScalar(*batch[i].scalar(),
+                                                            batch.length,
+                                                            ctx->memory_pool()));
+      column = array->data();
+    } else {
+      column = batch[i].array();
+    }
+    if (i == 0) {
+      RETURN_NOT_OK(ArrayHasher::Hash(*column, ctx->memory_pool(), out_hashes));
+      continue;
+    }
+    // Combine the hashes of the next key columns
+    if (column_hashes == nullptr) {
+      ARROW_ASSIGN_OR_RAISE(column_hashes,
+                            ctx->Allocate(batch.length * sizeof(uint64_t)));
+    }
+    auto next_hashes = reinterpret_cast<uint64_t*>(column_hashes->mutable_data());
+    RETURN_NOT_OK(ArrayHasher::Hash(*column, ctx->memory_pool(), next_hashes));
+    for (int64_t j = 0; j < batch.length; ++j) {
+      out_hashes[j] = CombineHashes(out_hashes[j], next_hashes[j]);
+    }
+  }
+  *out = ArrayData::Make(uint64(), batch.length, {nullptr, std::move(hashes)},
+                         /*null_count=*/0);
+  return Status::OK();
+}
+
+void Hash64Exec(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
+  KERNEL_RETURN_IF_ERROR(ctx, Hash64Batch(ctx, batch, out));
+}
+
 const FunctionDoc unique_doc(
     "Compute unique elements",
     ("Return an array with distinct values.  Nulls in the input are ignored."),
@@ -643,6 +962,15 @@ const FunctionDoc dictionary_encode_doc(
     "Dictionary-encode array",
     ("Return a dictionary-encoded version of the input array."), {"array"});
 
+const FunctionDoc hash64_doc(
+    "Compute the hashes of rows",
+    ("Return a uint64 array with the hash of each row of the given arrays.\n"
+     "The hash of a row combines the hashes of its values in the arrays, in\n"
+     "order.  Equal rows hash to the same value, regardless of the layout of\n"
+     "the arrays, so the hashes are suitable for partitioning data.\n"
+     "Null values hash to a fixed value.  Nested types are hashed recursively."),
+    {"*arrays"});
+
 }  // namespace
 
 void RegisterVectorHash(FunctionRegistry* registry) {
@@ -699,6 +1027,20 @@ void RegisterVectorHash(FunctionRegistry* registry) {
   // a no-op
 
   DCHECK_OK(registry->AddFunction(std::move(dict_encode)));
+
+  // ----------------------------------------------------------------------
+  // hash64
+
+  auto hash64 =
+      std::make_shared<VectorFunction>("hash64", Arity::VarArgs(1), &hash64_doc);
+  VectorKernel hash64_kernel;
+  hash64_kernel.signature =
+      KernelSignature::Make({InputType()}, uint64(), /*is_varargs=*/true);
+  hash64_kernel.exec = Hash64Exec;
+  hash64_kernel.null_handling = NullHandling::OUTPUT_NOT_NULL;
+  hash64_kernel.mem_allocation = MemAllocation::NO_PREALLOCATE;
+  DCHECK_OK(hash64->AddKernel(std::move(hash64_kernel)));
+  DCHECK_OK(registry->AddFunction(std::move(hash64)));
 }
 
 }  // namespace internal
@@ -164,6 +164,17 @@ void BenchUnique(benchmark::State& state, const ParamType& params) {
   params.SetMetadata(state);
 }
 
+template <typename ParamType>
+void BenchValueCounts(benchmark::State& state, const ParamType& params) {
+  std::shared_ptr<Array> arr;
+  params.GenerateTestData(&arr);
+
+  while (state.KeepRunning()) {
+    ABORT_NOT_OK(ValueCounts(arr).status());
+  }
+  params.SetMetadata(state);
+}
+
 template <typename ParamType>
 void BenchDictionaryEncode(benchmark::State& state, const ParamType& params) {
   std::shared_ptr<Array> arr;
@@ -225,6 +236,91 @@ static void UniqueString100bytes(benchmark::State& state) {
   BenchUnique(state, HashParams<StringType>{general_bench_cases[state.range(0)], 100});
 }
 
+// clang-format off
+// From a hash table fitting in L1 cache to one larger than the last level cache
+std::vector<HashBenchCase> cardinality_bench_cases = {
+  {kHashBenchmarkLength, 16, 0},
+  {kHashBenchmarkLength, 1 << 10, 0},
+  {kHashBenchmarkLength, 1 << 16, 0},
+  {kHashBenchmarkLength, 1 << 20, 0},
+  {kHashBenchmarkLength, 1 << 22, 0},
+};
+// clang-format on
+
+static void UniqueInt32Cardinality(benchmark::State& state) {
+  BenchUnique(state, HashParams<Int32Type>{cardinality_bench_cases[state.range(0)]});
+}
+
+static void UniqueInt64Cardinality(benchmark::State& state) {
+  BenchUnique(state, HashParams<Int64Type>{cardinality_bench_cases[state.range(0)]});
+}
+
+static void UniqueString10bytesCardinality(benchmark::State& state) {
+  BenchUnique(state,
+              HashParams<StringType>{cardinality_bench_cases[state.range(0)], 10});
+}
+
+static void ValueCountsInt64Cardinality(benchmark::State& state) {
+  BenchValueCounts(state, HashParams<Int64Type>{cardinality_bench_cases[state.range(0)]});
+}
+
+static void DictionaryEncodeInt64Cardinality(benchmark::State& state) {
+  BenchDictionaryEncode(state,
+                        HashParams<Int64Type>{cardinality_bench_cases[state.range(0)]});
+}
+
+static void DictionaryEncodeString10bytesCardinality(benchmark::State& state) {
+  BenchDictionaryEncode(
+      state, HashParams<StringType>{cardinality_bench_cases[state.range(0)], 10});
+}
+
+template <typename ParamType>
+void BenchHash64(benchmark::State& state, const ParamType& params, int num_columns = 1) {
+  std::vector<Datum> columns;
+  for (int i = 0; i < num_columns; ++i) {
+    std::shared_ptr<Array> arr;
+    params.GenerateTestData(&arr);
+    columns.emplace_back(arr);
+  }
+  while (state.KeepRunning()) {
+    ABORT_NOT_OK(Hash64(columns).status());
+  }
+  params.SetMetadata(state);
+  state.SetBytesProcessed(state.bytes_processed() * num_columns);
+}
+
+// clang-format off
+std::vector<HashBenchCase> hash64_bench_cases = {
+  {kHashBenchmarkLength, 100000, 0},
+  {kHashBenchmarkLength, 100000, 0.1},
+};
+// clang-format on
+
+static void Hash64Int32(benchmark::State& state) {
+  BenchHash64(state, HashParams<Int32Type>{hash64_bench_cases[state.range(0)]});
+}
+
+static void Hash64Int64(benchmark::State& state) {
+  BenchHash64(state, HashParams<Int64Type>{hash64_bench_cases[state.range(0)]});
+}
+
+static void Hash64Double(benchmark::State& state) {
+  BenchHash64(state, HashParams<DoubleType>{hash64_bench_cases[state.range(0)]});
+}
+
+static void Hash64TwoInt64Columns(benchmark::State& state) {
+  BenchHash64(state, HashParams<Int64Type>{hash64_bench_cases[state.range(0)]},
+              /*num_columns=*/2);
+}
+
+static void Hash64String10bytes(benchmark::State& state) {
+  BenchHash64(state, HashParams<StringType>{hash64_bench_cases[state.range(0)], 10});
+}
+
+static void Hash64String100bytes(benchmark::State& state) {
+  BenchHash64(state, HashParams<StringType>{hash64_bench_cases[state.range(0)], 100});
+}
+
 void HashSetArgs(benchmark::internal::Benchmark* bench) {
   for (int i = 0; i < static_cast<int>(general_bench_cases.size()); ++i) {
     bench->Arg(i);
@@ -246,5 +342,31 @@ void UInt8SetArgs(benchmark::internal::Benchmark* bench) {
 
 BENCHMARK(UniqueUInt8)->Apply(UInt8SetArgs);
 
+void CardinalityArgs(benchmark::internal::Benchmark* bench) {
+  for (int i = 0; i < static_cast<int>(cardinality_bench_cases.size()); ++i) {
+    bench->Arg(i);
+  }
+}
+
+BENCHMARK(UniqueInt32Cardinality)->Apply(CardinalityArgs);
+BENCHMARK(UniqueInt64Cardinality)->Apply(CardinalityArgs);
+BENCHMARK(UniqueString10bytesCardinality)->Apply(CardinalityArgs);
+BENCHMARK(ValueCountsInt64Cardinality)->Apply(CardinalityArgs);
+BENCHMARK(DictionaryEncodeInt64Cardinality)->Apply(CardinalityArgs);
+BENCHMARK(DictionaryEncodeString10bytesCardinality)->Apply(CardinalityArgs);
+
+void Hash64Args(benchmark::internal::Benchmark* bench) {
+  for (int i = 0; i < static_cast<int>(hash64_bench_cases.size()); ++i) {
+    bench->Arg(i);
+  }
+}
+
+BENCHMARK(Hash64Int32)->Apply(Hash64Args);
+BENCHMARK(Hash64Int64)->Apply(Hash64Args);
+BENCHMARK(Hash64Double)->Apply(Hash64Args);
+BENCHMARK(Hash64TwoInt64Columns)->Apply(Hash64Args);
+BENCHMARK(Hash64String10bytes)->Apply(Hash64Args);
+BENCHMARK(Hash64String100bytes)->Apply(Hash64Args);
+
 }  // namespace compute
 }  // namespace arrow
@@ -16,9 +16,11 @@
 // under the License.
 
 #include <algorithm>
+#include <cmath>
 #include <cstdint>
 #include <cstdio>
 #include <functional>
+#include <limits>
 #include <locale>
 #include <memory>
 #include <stdexcept>
@@ -30,6 +32,7 @@
 
 #include "arrow/array.h"
 #include "arrow/array/builder_decimal.h"
+#include "arrow/array/concatenate.h"
 #include "arrow/buffer.h"
 #include "arrow/chunked_array.h"
 #include "arrow/status.h"
@@ -49,6 +52,7 @@
 namespace arrow {
 
 using internal::checked_cast;
+using internal::checked_pointer_cast;
 
 namespace compute {
 
@@ -678,5 +682,147 @@ TEST_F(TestHashKernel, ChunkedArrayZeroChunk) {
                      *result_datum.chunked_array());
 }
 
+// ----------------------------------------------------------------------
+// hash64 tests
+
+std::shared_ptr<UInt64Array> HashRows(const std::vector<Datum>& values) {
+  EXPECT_OK_AND_ASSIGN(Datum result, Hash64(values));
+  std::shared_ptr<Array> hashes;
+  if (result.kind() == Datum::CHUNKED_ARRAY) {
+    EXPECT_OK_AND_ASSIGN(hashes, Concatenate(result.chunked_array()->chunks()));
+  } else {
+    hashes = result.make_array();
+  }
+  EXPECT_EQ(hashes->type_id(), Type::UINT64);
+  EXPECT_EQ(hashes->null_count(), 0);
+  return checked_pointer_cast<UInt64Array>(hashes);
+}
+
+// Check that two values hash alike if and only if they are equal
+void CheckHash64(const std::shared_ptr<Array>& array) {
+  SCOPED_TRACE(array->type()->ToString());
+  auto hashes = HashRows({array});
+  ASSERT_EQ(hashes->length(), array->length());
+  for (int64_t i = 0; i < array->length(); ++i) {
+    for (int64_t j = 0; j < array->length(); ++j) {
+      const bool equal = array->RangeEquals(i, i + 1, j, array);
+      ASSERT_EQ(equal, hashes->Value(i) == hashes->Value(j)) << "at " << i << ", " << j;
+    }
+  }
+
+  // The hashes don't depend on the array offset
+  auto sliced = HashRows({array->Slice(1)});
+  AssertArraysEqual(*hashes->Slice(1), *sliced);
+}
+
+TEST(TestHash64, Primitives) {
+  CheckHash64(ArrayFromJSON(null(), "[null, null]"));
+  CheckHash64(ArrayFromJSON(boolean(), "[true, false, null, true, false, null]"));
+  for (const auto& type : {int8(), uint8(), int16(), uint16(), int32(), uint32(),
+                           int64(), uint64(), date32(), timestamp(TimeUnit::MILLI)}) {
+    CheckHash64(ArrayFromJSON(type, "[1, 2, 0, null, 2, 100, 1, null, 0]"));
+  }
+  CheckHash64(ArrayFromJSON(float64(), "[1.5, 0.0, null, 1.5, -2.5, 0.0, -2.5]"));
+  CheckHash64(ArrayFromJSON(decimal128(5, 2), R"(["1.23", "-1.23", null, "1.23"])"));
+  CheckHash64(ArrayFromJSON(decimal256(5, 2), R"(["1.23", "-1.23", null, "1.23"])"));
+  CheckHash64(ArrayFromJSON(fixed_size_binary(3), R"(["abc", "abd", null, "abc"])"));
+  for (const auto& type : {utf8(), binary(), large_utf8(), large_binary()}) {
+    CheckHash64(ArrayFromJSON(
+        type, R"(["", "a", null, "", "a", "long enough to exceed 16 bytes", null,
+                  "long enough to exceed 16 bytes!"])"));
+  }
+}
+
+TEST(TestHash64, FloatingPoint) {
+  for (const auto& type : {float32(), float64()}) {
+    // NaN and infinity can't be given as JSON
+    auto values = ArrayFromJSON(type, "[0.0, -0.0, 1.0, 0.0, 1.0]");
+    auto hashes = HashRows({values});
+    ASSERT_EQ(hashes->Value(0), hashes->Value(1));
+    ASSERT_NE(hashes->Value(0), hashes->Value(2));
+  }
+  DoubleBuilder builder;
+  ASSERT_OK(builder.Append(std::nan("1")));
+  ASSERT_OK(builder.Append(-std::nan("2")));
+  ASSERT_OK(builder.Append(std::numeric_limits<double>::infinity()));
+  ASSERT_OK_AND_ASSIGN(auto values, builder.Finish());
+  auto hashes = HashRows({values});
+  ASSERT_EQ(hashes->Value(0), hashes->Value(1));
+  ASSERT_NE(hashes->Value(0), hashes->Value(2));
+}
+
+TEST(TestHash64, Nested) {
+  CheckHash64(
+      ArrayFromJSON(list(int32()), "[[1, 2], [], null, [1, 2], [2, 1], [1, null], [1]]"));
+  CheckHash64(ArrayFromJSON(large_list(utf8()),
+                            R"([["a", "b"], [], null, ["a", "b"], ["ab"], ["a"]])"));
+  CheckHash64(ArrayFromJSON(fixed_size_list(int16(), 2),
+                            "[[1, 2], null, [1, 2], [2, 1], [1, null], [null, 1]]"));
+  CheckHash64(ArrayFromJSON(map(utf8(), int32()),
+                            R"([[["a", 1], ["b", 2]], [], null, [["a", 1], ["b", 2]],
+                                [["a", 2]]])"));
+  CheckHash64(ArrayFromJSON(struct_({field("a", int32()), field("b", utf8())}),
+                            R"([{"a": 1, "b": "x"}, {"a": 1, "b": "y"}, null,
+                                {"a": 1, "b": "x"}, {"a": null, "b": "x"}])"));
+  CheckHash64(ArrayFromJSON(list(struct_({field("a", int8())})),
+                            R"([[{"a": 1}], [{"a": 2}, null], [{"a": 1}], [null]])"));
+
+  auto union_fields = {field("a", int8()), field("b", int8())};
+  CheckHash64(ArrayFromJSON(sparse_union(union_fields, {4, 8}),
+                            "[[4, 1], [8, 1], [4, 1], [4, 2], [8, 1], [4, null]]"));
+  CheckHash64(ArrayFromJSON(dense_union(union_fields, {4, 8}),
+                            "[[4, 1], [8, 1], [4, 1], [4, 2], [8, 1], [4, null]]"));
+}
+
+TEST(TestHash64, Layout) {
+  // The hashes only depend on the values, not on their physical layout
+  auto values = ArrayFromJSON(utf8(), R"(["a", "b", null, "a", "c", "b"])");
+  auto expected = HashRows({values});
+
+  auto chunked = std::make_shared<ChunkedArray>(
+      ArrayVector{values->Slice(0, 2), values->Slice(2, 0), values->Slice(2)});
+  AssertArraysEqual(*expected, *HashRows({chunked}));
+
+  auto dict_type = dictionary(int8(), utf8());
+  auto dict = ArrayFromJSON(utf8(), R"(["c", "b", "a"])");
+  auto indices = ArrayFromJSON(int8(), "[2, 1, null, 2, 0, 1]");
+  ASSERT_OK_AND_ASSIGN(auto dict_values,
+                       DictionaryArray::FromArrays(dict_type, indices, dict));
+  AssertArraysEqual(*expected, *HashRows({dict_values}));
+
+  // Null indices may be out of bounds
+  indices = ArrayFromJSON(int8(), "[2, 1, 100, 2, 0, 1]");
+  indices->data()->buffers[0] =
+      ArrayFromJSON(int8(), "[2, 1, null, 2, 0, 1]")->data()->buffers[0];
+  indices->data()->null_count = 1;
+  dict_values = std::make_shared<DictionaryArray>(dict_type, indices, dict);
+  AssertArraysEqual(*expected, *HashRows({dict_values}));
+}
+
+TEST(TestHash64, MultipleColumns) {
+  auto a = ArrayFromJSON(int32(), "[1, 1, 2, 1, null, null]");
+  auto b = ArrayFromJSON(utf8(), R"(["x", "y", "x", "x", "x", null])");
+  auto hashes = HashRows({a, b});
+  ASSERT_EQ(hashes->Value(0), hashes->Value(3));
+  ASSERT_NE(hashes->Value(0), hashes->Value(1));
+  ASSERT_NE(hashes->Value(0), hashes->Value(2));
+  ASSERT_NE(hashes->Value(4), hashes->Value(5));
+
+  // Hashes of the columns are combined in order
+  auto swapped =
+      HashRows({ArrayFromJSON(int32(), "[1, 2]"), ArrayFromJSON(int32(), "[2, 1]")});
+  ASSERT_NE(swapped->Value(0), swapped->Value(1));
+  ASSERT_NE(hashes->Value(0), HashRows({a})->Value(0));
+
+  // Scalars are broadcast
+  auto with_scalar = HashRows({a, Datum(std::make_shared<StringScalar>("x"))});
+  ASSERT_EQ(with_scalar->Value(0), hashes->Value(0));
+  ASSERT_EQ(with_scalar->Value(2), hashes->Value(2));
+  ASSERT_EQ(with_scalar->Value(4), hashes->Value(4));
+
+  ASSERT_RAISES(Invalid, Hash64({}));
+  ASSERT_RAISES(Invalid, Hash64({a, ArrayFromJSON(int32(), "[1]")}));
+}
+
 }  // namespace compute
 }  // namespace arrow
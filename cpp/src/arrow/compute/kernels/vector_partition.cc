@@ -0,0 +1,332 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Vector kernels splitting rows into partitions
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+#include "arrow/compute/api_vector.h"
+#include "arrow/compute/kernels/common.h"
+#include "arrow/result.h"
+#include "arrow/util/macros.h"
+#include "arrow/util/simd.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+
+namespace compute {
+namespace internal {
+
+namespace {
+
+// Scattering row indices to many partitions means writing to as many distant
+// locations of the output, each write missing the cache (and the TLB) once
+// there are too many partitions for the hardware to track their output
+// streams.  Instead, the indices of each partition are then gathered in a
+// small cache-resident buffer, which is flushed to the output one full cache
+// line at a time, bypassing the cache when possible ("software
+// write-combining").  With few partitions, scattering directly is faster.
+constexpr int64_t kWriteCombiningLength = 64 / sizeof(uint64_t);
+constexpr int64_t kMaxDirectScatterPartitions = 32;
+
+// The partition of a row given its partition id
+struct PartitionFromId {
+  template <typename CType>
+  uint64_t operator()(CType id) const {
+    // Negative ids become huge and fail the bounds check
+    return static_cast<uint64_t>(id);
+  }
+};
+
+// The partition of a row given its hash: the high 32 bits of the hash are
+// scaled to [0, num_partitions), so that a power of two number of partitions
+// uses the high bits of the hash as a radix
+struct PartitionFromHash {
+  uint64_t num_partitions;
+
+  uint64_t operator()(uint64_t hash) const {
+    return ((hash >> 32) * num_partitions) >> 32;
+  }
+};
+
+Status CheckNumPartitions(int64_t num_partitions) {
+  if (num_partitions < 1) {
+    return Status::Invalid("Number of partitions must be strictly positive, got ",
+                           num_partitions);
+  }
+  return Status::OK();
+}
+
+ArrayDataVector GetChunks(const Datum& datum) {
+  ArrayDataVector chunks;
+  if (datum.kind() == Datum::CHUNKED_ARRAY) {
+    for (const auto& chunk : datum.chunked_array()->chunks()) {
+      chunks.push_back(chunk->data());
+    }
+  } else {
+    chunks.push_back(datum.array());
+  }
+  return chunks;
+}
+
+// Write a full write-combining line to its aligned location in the output
+inline void WriteLine(const uint64_t* line, uint64_t* out) {
+#if defined(ARROW_HAVE_SSE4_2)
+  for (int64_t i = 0; i < kWriteCombiningLength; i += 2) {
+    _mm_stream_si128(reinterpret_cast<__m128i*>(out + i),
+                     _mm_load_si128(reinterpret_cast<const __m128i*>(line + i)));
+  }
+#else
+  std::memcpy(out, line, kWriteCombiningLength * sizeof(uint64_t));
+#endif
+}
+
+// Scatter the row indices of each partition, starting at `positions`, through
+// a write-combining line per partition
+template <typename CType, typename GetPartition>
+Status ScatterWriteCombining(const ArrayDataVector& chunks, int64_t num_partitions,
+                             const int32_t* offsets, const GetPartition& get_partition,
+                             int64_t* positions, uint64_t* indices, MemoryPool* pool) {
+  ARROW_ASSIGN_OR_RAISE(
+      std::unique_ptr<Buffer> lines_buffer,
+      AllocateBuffer(num_partitions * kWriteCombiningLength * sizeof(uint64_t), pool));
+  auto lines = reinterpret_cast<uint64_t*>(lines_buffer->mutable_data());
+
+  // Write the indices buffered for `partition` at output positions
+  // [max(begin, partition start), end).  A partition's first and last cache
+  // lines may be shared with its neighbours, which must not be overwritten.
+  auto write_partial_line = [&](int64_t partition, int64_t begin, int64_t end) {
+    begin = std::max<int64_t>(begin, offsets[partition]);
+    std::memcpy(indices + begin,
+                lines + partition * kWriteCombiningLength + begin % kWriteCombiningLength,
+                (end - begin) * sizeof(uint64_t));
+  };
+
+  // Positions in the output are mapped to the same slots in the line, so that
+  // a full line is written to an aligned output cache line
+  uint64_t row = 0;
+  for (const auto& chunk : chunks) {
+    const CType* ids = chunk->GetValues<CType>(1);
+    for (int64_t i = 0; i < chunk->length; ++i, ++row) {
+      const uint64_t partition = get_partition(ids[i]);
+      const int64_t position = positions[partition]++;
+      const int64_t slot = position % kWriteCombiningLength;
+      uint64_t* line = lines + partition * kWriteCombiningLength;
+      line[slot] = row;
+      if (slot == kWriteCombiningLength - 1) {
+        const int64_t begin = position - slot;
+        if (ARROW_PREDICT_TRUE(begin >= offsets[partition])) {
+          WriteLine(line, indices + begin);
+        } else {
+          write_partial_line(partition, begin, position + 1);
+        }
+      }
+    }
+  }
+#if defined(ARROW_HAVE_SSE4_2)
+  _mm_sfence();
+#endif
+  for (int64_t partition = 0; partition < num_partitions; ++partition) {
+    const int64_t position = positions[partition];
+    if (position % kWriteCombiningLength != 0) {
+      write_partial_line(partition, position - position % kWriteCombiningLength,
+                         position);
+    }
+  }
+  return Status::OK();
+}
+
+// Compute the list of row indices of each partition, given the partition ids
+// (or hashes) of the rows in `chunks`.  Rows are numbered across chunks, and
+// the indices of each partition are in increasing order.
+//
+// This is done in two passes: the first one counts the rows of each partition
+// to find where its indices start in the output, the second one scatters the
+// row indices.
+template <typename CType, typename GetPartition>
+Result<std::shared_ptr<ArrayData>> PartitionIndices(const ArrayDataVector& chunks,
+                                                    int64_t num_partitions,
+                                                    const GetPartition& get_partition,
+                                                    MemoryPool* pool) {
+  int64_t length = 0;
+  for (const auto& chunk : chunks) {
+    if (chunk->GetNullCount() != 0) {
+      return Status::Invalid("Partition ids must not be null");
+    }
+    length += chunk->length;
+  }
+  if (length > std::numeric_limits<int32_t>::max()) {
+    return Status::CapacityError("Cannot partition more than 2^31 - 1 rows at once");
+  }
+
+  ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Buffer> offsets_buffer,
+                        AllocateBuffer((num_partitions + 1) * sizeof(int32_t), pool));
+  auto offsets = reinterpret_cast<int32_t*>(offsets_buffer->mutable_data());
+  std::fill(offsets, offsets + num_partitions + 1, 0);
+  for (const auto& chunk : chunks) {
+    const CType* ids = chunk->GetValues<CType>(1);
+    for (int64_t i = 0; i < chunk->length; ++i) {
+      const uint64_t partition = get_partition(ids[i]);
+      if (ARROW_PREDICT_FALSE(partition >= static_cast<uint64_t>(num_partitions))) {
+        using PrintType = typename std::conditional<std::is_signed<CType>::value,
+                                                    int64_t, uint64_t>::type;
+        return Status::Invalid("Partition id ", static_cast<PrintType>(ids[i]),
+                               " out of bounds for ",
+                               num_partitions, " partitions");
+      }
+      ++offsets[partition + 1];
+    }
+  }
+  for (int64_t partition = 0; partition < num_partitions; ++partition) {
+    offsets[partition + 1] += offsets[partition];
+  }
+
+  ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Buffer> indices_buffer,
+                        AllocateBuffer(length * sizeof(uint64_t), pool));
+  auto indices = reinterpret_cast<uint64_t*>(indices_buffer->mutable_data());
+  std::vector<int64_t> positions(offsets, offsets + num_partitions);
+  if (num_partitions <= kMaxDirectScatterPartitions) {
+    uint64_t row = 0;
+    for (const auto& chunk : chunks) {
+      const CType* ids = chunk->GetValues<CType>(1);
+      for (int64_t i = 0; i < chunk->length; ++i, ++row) {
+        indices[positions[get_partition(ids[i])]++] = row;
+      }
+    }
+  } else {
+    RETURN_NOT_OK(ScatterWriteCombining<CType>(chunks, num_partitions, offsets,
+                                               get_partition, positions.data(), indices,
+                                               pool));
+  }
+
+  auto values = ArrayData::Make(uint64(), length, {nullptr, std::move(indices_buffer)},
+                                /*null_count=*/0);
+  return ArrayData::Make(list(uint64()), num_partitions,
+                         {nullptr, std::move(offsets_buffer)}, {std::move(values)},
+                         /*null_count=*/0);
+}
+
+Result<std::shared_ptr<ArrayData>> PartitionIndicesFromIds(const Datum& ids,
+                                                           int64_t num_partitions,
+                                                           MemoryPool* pool) {
+  const auto chunks = GetChunks(ids);
+  switch (ids.type()->id()) {
+    case Type::INT8:
+      return PartitionIndices<int8_t>(chunks, num_partitions, PartitionFromId{}, pool);
+    case Type::INT16:
+      return PartitionIndices<int16_t>(chunks, num_partitions, PartitionFromId{}, pool);
+    case Type::INT32:
+      return PartitionIndices<int32_t>(chunks, num_partitions, PartitionFromId{}, pool);
+    case Type::INT64:
+      return PartitionIndices<int64_t>(chunks, num_partitions, PartitionFromId{}, pool);
+    case Type::UINT8:
+      return PartitionIndices<uint8_t>(chunks, num_partitions, PartitionFromId{}, pool);
+    case Type::UINT16:
+      return PartitionIndices<uint16_t>(chunks, num_partitions, PartitionFromId{}, pool);
+    case Type::UINT32:
+      return PartitionIndices<uint32_t>(chunks, num_partitions, PartitionFromId{}, pool);
+    case Type::UINT64:
+      return PartitionIndices<uint64_t>(chunks, num_partitions, PartitionFromId{}, pool);
+    default:
+      return Status::NotImplemented("partition_indices not implemented for partition ids",
+                                    " of type ", *ids.type());
+  }
+}
+
+Result<int64_t> GetNumPartitions(const char* func_name, const FunctionOptions* options) {
+  if (options == nullptr) {
+    return Status::Invalid(func_name, " requires PartitionOptions");
+  }
+  const int64_t num_partitions =
+      checked_cast<const PartitionOptions&>(*options).num_partitions;
+  RETURN_NOT_OK(CheckNumPartitions(num_partitions));
+  return num_partitions;
+}
+
+const FunctionDoc partition_indices_doc(
+    "Compute the indices of the rows of each partition",
+    ("Return a list array with, for each partition, the indices of the rows\n"
+     "whose partition id is that partition, in increasing order.\n"
+     "Partition ids must be non-null and lower than the number of partitions\n"
+     "given in PartitionOptions.  Taking the flattened list values from the\n"
+     "partitioned data groups its rows by partition in a single pass."),
+    {"partition_ids"}, "PartitionOptions");
+
+const FunctionDoc hash_partition_indices_doc(
+    "Compute the indices of the rows of each partition, by hash of key columns",
+    ("Like partition_indices, but the partition of a row is derived from the\n"
+     "hash of its values in the given key columns, as computed by hash64.\n"
+     "The number of partitions must be given in PartitionOptions."),
+    {"*keys"}, "PartitionOptions");
+
+// Both functions are meta functions, as they must produce num_partitions lists
+// even for empty inputs, which the vector kernel executor skips altogether.
+class PartitionIndicesMetaFunction : public MetaFunction {
+ public:
+  PartitionIndicesMetaFunction()
+      : MetaFunction("partition_indices", Arity::Unary(), &partition_indices_doc) {}
+
+  Result<Datum> ExecuteImpl(const std::vector<Datum>& args,
+                            const FunctionOptions* options,
+                            ExecContext* ctx) const override {
+    ARROW_ASSIGN_OR_RAISE(const int64_t num_partitions,
+                          GetNumPartitions("partition_indices", options));
+    if (!args[0].is_arraylike()) {
+      return Status::TypeError("partition_indices expects array-like partition ids");
+    }
+    ARROW_ASSIGN_OR_RAISE(auto indices, PartitionIndicesFromIds(args[0], num_partitions,
+                                                                ctx->memory_pool()));
+    return Datum(std::move(indices));
+  }
+};
+
+class HashPartitionIndicesMetaFunction : public MetaFunction {
+ public:
+  HashPartitionIndicesMetaFunction()
+      : MetaFunction("hash_partition_indices", Arity::VarArgs(1),
+                     &hash_partition_indices_doc) {}
+
+  Result<Datum> ExecuteImpl(const std::vector<Datum>& args,
+                            const FunctionOptions* options,
+                            ExecContext* ctx) const override {
+    ARROW_ASSIGN_OR_RAISE(const int64_t num_partitions,
+                          GetNumPartitions("hash_partition_indices", options));
+    ARROW_ASSIGN_OR_RAISE(Datum hashes, CallFunction("hash64", args, ctx));
+    const PartitionFromHash get_partition{static_cast<uint64_t>(num_partitions)};
+    ARROW_ASSIGN_OR_RAISE(auto indices,
+                          PartitionIndices<uint64_t>(GetChunks(hashes), num_partitions,
+                                                     get_partition, ctx->memory_pool()));
+    return Datum(std::move(indices));
+  }
+};
+
+}  // namespace
+
+void RegisterVectorPartition(FunctionRegistry* registry) {
+  DCHECK_OK(registry->AddFunction(std::make_shared<PartitionIndicesMetaFunction>()));
+  DCHECK_OK(registry->AddFunction(std::make_shared<HashPartitionIndicesMetaFunction>()));
+}
+
+}  // namespace internal
+}  // namespace compute
+}  // namespace arrow
@@ -17,8 +17,12 @@
 
 #include "benchmark/benchmark.h"
 
-#include "arrow/compute/api_vector.h"
+#include <cstdint>
+#include <limits>
+
+#include "arrow/compute/api.h"
 #include "arrow/compute/kernels/test_util.h"
+#include "arrow/record_batch.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/random.h"
 #include "arrow/util/benchmark_util.h"
@@ -55,5 +59,70 @@ BENCHMARK(NthToIndicesInt64)
     ->MinTime(1.0)
     ->Unit(benchmark::TimeUnit::kNanosecond);
 
+static constexpr int64_t kPartitionRows = 1 << 20;
+
+static void PartitionArgs(benchmark::internal::Benchmark* bench) {
+  bench->ArgName("num_partitions")->RangeMultiplier(4)->Range(2, 1024);
+}
+
+static void PartitionIndicesInt32(benchmark::State& state) {
+  const auto num_partitions = static_cast<int32_t>(state.range(0));
+  auto rand = random::RandomArrayGenerator(kSeed);
+  auto ids = rand.Int32(kPartitionRows, 0, num_partitions - 1, /*null_probability=*/0);
+
+  const PartitionOptions options(num_partitions);
+  for (auto _ : state) {
+    ABORT_NOT_OK(PartitionIndices(ids, options).status());
+  }
+  state.SetItemsProcessed(state.iterations() * kPartitionRows);
+}
+
+static std::shared_ptr<RecordBatch> MakePartitionBatch() {
+  auto rand = random::RandomArrayGenerator(kSeed);
+  auto schema = ::arrow::schema(
+      {field("key", int64()), field("value", float64()), field("name", utf8())});
+  return RecordBatch::Make(
+      schema, kPartitionRows,
+      {rand.Int64(kPartitionRows, 0, kPartitionRows / 4, /*null_probability=*/0),
+       rand.Float64(kPartitionRows, -1.0, 1.0, /*null_probability=*/0.1),
+       rand.String(kPartitionRows, 4, 12, /*null_probability=*/0.1)});
+}
+
+static void HashPartitionRecordBatch(benchmark::State& state) {
+  const auto num_partitions = static_cast<int32_t>(state.range(0));
+  auto batch = MakePartitionBatch();
+
+  const PartitionOptions options(num_partitions);
+  for (auto _ : state) {
+    ABORT_NOT_OK(HashPartition(*batch, {"key"}, options).status());
+  }
+  state.SetItemsProcessed(state.iterations() * kPartitionRows);
+}
+
+// Baseline: one filter call, hence one pass over the data, per partition
+static void HashPartitionRecordBatchByFilter(benchmark::State& state) {
+  const auto num_partitions = static_cast<int32_t>(state.range(0));
+  auto batch = MakePartitionBatch();
+
+  const Datum divisor(std::numeric_limits<uint64_t>::max() / num_partitions + 1);
+  for (auto _ : state) {
+    auto hashes = Hash64({batch->column(0)}).ValueOrDie();
+    auto ids = CallFunction("divide", {hashes, divisor}).ValueOrDie();
+    for (int32_t partition = 0; partition < num_partitions; ++partition) {
+      const Datum partition_id(static_cast<uint64_t>(partition));
+      auto mask = CallFunction("equal", {ids, partition_id}).ValueOrDie();
+      ABORT_NOT_OK(Filter(batch, mask).status());
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * kPartitionRows);
+}
+
+BENCHMARK(PartitionIndicesInt32)->Apply(PartitionArgs);
+BENCHMARK(HashPartitionRecordBatch)->Apply(PartitionArgs);
+BENCHMARK(HashPartitionRecordBatchByFilter)
+    ->ArgName("num_partitions")
+    ->RangeMultiplier(4)
+    ->Range(2, 32);
+
 }  // namespace compute
 }  // namespace arrow
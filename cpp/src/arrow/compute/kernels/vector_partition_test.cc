@@ -0,0 +1,196 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <set>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/array.h"
+#include "arrow/compute/api.h"
+#include "arrow/compute/kernels/test_util.h"
+#include "arrow/record_batch.h"
+#include "arrow/result.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
+#include "arrow/util/checked_cast.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+
+namespace compute {
+
+void CheckPartitionIndices(const Datum& partition_ids, int32_t num_partitions,
+                           const std::string& expected) {
+  ASSERT_OK_AND_ASSIGN(auto actual,
+                       PartitionIndices(partition_ids, PartitionOptions(num_partitions)));
+  ASSERT_OK(actual->ValidateFull());
+  AssertArraysEqual(*ArrayFromJSON(list(uint64()), expected), *actual,
+                    /*verbose=*/true);
+}
+
+TEST(TestPartitionIndices, Basics) {
+  for (auto ty :
+       {int8(), uint8(), int16(), uint16(), int32(), uint32(), int64(), uint64()}) {
+    SCOPED_TRACE(ty->ToString());
+    CheckPartitionIndices(ArrayFromJSON(ty, "[]"), 2, "[[], []]");
+    CheckPartitionIndices(ArrayFromJSON(ty, "[0, 0, 0]"), 1, "[[0, 1, 2]]");
+    CheckPartitionIndices(ArrayFromJSON(ty, "[1, 0, 1, 2, 1]"), 4,
+                          "[[1], [0, 2, 4], [3], []]");
+    CheckPartitionIndices(ArrayFromJSON(ty, "[1, 0, 1, 2, 1]")->Slice(1), 3,
+                          "[[0], [1, 3], [2]]");
+  }
+}
+
+TEST(TestPartitionIndices, ChunkedArray) {
+  auto ids = ChunkedArrayFromJSON(int32(), {"[2, 0]", "[]", "[1, 2, 0]"});
+  CheckPartitionIndices(ids, 3, "[[1, 4], [2], [0, 3]]");
+}
+
+TEST(TestPartitionIndices, ManyPartitions) {
+  // Exercise partitions spanning several write-combining lines, as well as
+  // partitions sharing output cache lines with their neighbours
+  auto rand = random::RandomArrayGenerator(0x5487655);
+  for (int32_t num_partitions : {1, 3, 17, 100, 1000}) {
+    SCOPED_TRACE(num_partitions);
+    auto ids = std::static_pointer_cast<Int32Array>(
+        rand.Int32(1000, 0, num_partitions - 1, /*null_probability=*/0));
+    ASSERT_OK_AND_ASSIGN(auto actual,
+                         PartitionIndices(ids, PartitionOptions(num_partitions)));
+    ASSERT_OK(actual->ValidateFull());
+    ASSERT_EQ(num_partitions, actual->length());
+    ASSERT_EQ(ids->length(), actual->values()->length());
+
+    auto indices = std::static_pointer_cast<UInt64Array>(actual->values());
+    for (int32_t partition = 0; partition < num_partitions; ++partition) {
+      std::vector<uint64_t> expected;
+      for (int64_t i = 0; i < ids->length(); ++i) {
+        if (ids->Value(i) == partition) {
+          expected.push_back(static_cast<uint64_t>(i));
+        }
+      }
+      std::vector<uint64_t> partition_indices(
+          indices->raw_values() + actual->value_offset(partition),
+          indices->raw_values() + actual->value_offset(partition + 1));
+      ASSERT_EQ(expected, partition_indices) << "for partition " << partition;
+    }
+  }
+}
+
+TEST(TestPartitionIndices, Errors) {
+  PartitionOptions options(3);
+  ASSERT_RAISES(Invalid, PartitionIndices(ArrayFromJSON(int8(), "[0, 3]"), options));
+  ASSERT_RAISES(Invalid, PartitionIndices(ArrayFromJSON(int8(), "[0, -1]"), options));
+  ASSERT_RAISES(Invalid, PartitionIndices(ArrayFromJSON(int8(), "[0, null]"), options));
+  ASSERT_RAISES(Invalid,
+                PartitionIndices(ArrayFromJSON(int8(), "[0]"), PartitionOptions(0)));
+  ASSERT_RAISES(NotImplemented,
+                PartitionIndices(ArrayFromJSON(float64(), "[0]"), options));
+}
+
+TEST(TestHashPartitionIndices, Basics) {
+  auto keys = ArrayFromJSON(utf8(), R"(["a", "b", "a", null, "c", "b", null, "a"])");
+  for (int32_t num_partitions : {1, 2, 5}) {
+    SCOPED_TRACE(num_partitions);
+    ASSERT_OK_AND_ASSIGN(auto actual,
+                         HashPartitionIndices({keys}, PartitionOptions(num_partitions)));
+    ASSERT_OK(actual->ValidateFull());
+    ASSERT_EQ(num_partitions, actual->length());
+    ASSERT_EQ(keys->length(), actual->values()->length());
+
+    // Equal keys end up in the same partition
+    std::vector<int32_t> partition_of_row(keys->length(), -1);
+    auto indices = std::static_pointer_cast<UInt64Array>(actual->values());
+    for (int32_t partition = 0; partition < num_partitions; ++partition) {
+      for (int32_t i = actual->value_offset(partition);
+           i < actual->value_offset(partition + 1); ++i) {
+        ASSERT_EQ(-1, partition_of_row[indices->Value(i)]);
+        partition_of_row[indices->Value(i)] = partition;
+      }
+    }
+    ASSERT_EQ(partition_of_row[0], partition_of_row[2]);
+    ASSERT_EQ(partition_of_row[0], partition_of_row[7]);
+    ASSERT_EQ(partition_of_row[1], partition_of_row[5]);
+    ASSERT_EQ(partition_of_row[3], partition_of_row[6]);
+  }
+
+  ASSERT_RAISES(Invalid, HashPartitionIndices({keys}, PartitionOptions(-1)));
+  ASSERT_RAISES(Invalid, CallFunction("hash_partition_indices", {keys}));
+}
+
+TEST(TestPartition, RecordBatch) {
+  auto schema = ::arrow::schema({field("a", int32()), field("b", utf8())});
+  auto batch = RecordBatchFromJSON(schema, R"([
+    [1, "x"], [2, "y"], [3, "x"], [4, null], [5, "y"]
+  ])");
+
+  auto ids = ArrayFromJSON(int8(), "[2, 0, 2, 0, 0]");
+  ASSERT_OK_AND_ASSIGN(auto partitions, Partition(*batch, ids, PartitionOptions(3)));
+  ASSERT_EQ(3, partitions.size());
+  AssertBatchesEqual(*RecordBatchFromJSON(schema, R"([[2, "y"], [4, null], [5, "y"]])"),
+                     *partitions[0]);
+  AssertBatchesEqual(*RecordBatchFromJSON(schema, "[]"), *partitions[1]);
+  AssertBatchesEqual(*RecordBatchFromJSON(schema, R"([[1, "x"], [3, "x"]])"),
+                     *partitions[2]);
+
+  ASSERT_RAISES(Invalid,
+                Partition(*batch, ArrayFromJSON(int8(), "[0, 0]"), PartitionOptions(3)));
+}
+
+TEST(TestPartition, HashPartitionRecordBatch) {
+  auto schema = ::arrow::schema({field("a", int32()), field("b", utf8())});
+  auto batch = RecordBatchFromJSON(schema, R"([
+    [1, "x"], [2, "y"], [3, "x"], [4, null], [5, "y"], [6, "x"], [7, null]
+  ])");
+
+  ASSERT_OK_AND_ASSIGN(auto partitions,
+                       HashPartition(*batch, {"b"}, PartitionOptions(4)));
+  ASSERT_EQ(4, partitions.size());
+  // All rows with the same key are in the same partition
+  std::map<std::string, int64_t> rows_per_key;
+  int64_t num_rows = 0;
+  for (const auto& partition : partitions) {
+    ASSERT_OK(partition->ValidateFull());
+    std::set<std::string> keys;
+    const auto& column = checked_cast<const StringArray&>(*partition->column(1));
+    for (int64_t i = 0; i < column.length(); ++i) {
+      keys.insert(column.IsNull(i) ? "null" : column.GetString(i));
+    }
+    for (const auto& key : keys) {
+      ASSERT_EQ(0, rows_per_key.count(key)) << "key " << key << " in two partitions";
+      rows_per_key[key] = 0;
+    }
+    for (int64_t i = 0; i < column.length(); ++i) {
+      ++rows_per_key[column.IsNull(i) ? "null" : column.GetString(i)];
+    }
+    num_rows += partition->num_rows();
+  }
+  ASSERT_EQ(batch->num_rows(), num_rows);
+  ASSERT_EQ(3, rows_per_key["x"]);
+  ASSERT_EQ(2, rows_per_key["y"]);
+  ASSERT_EQ(2, rows_per_key["null"]);
+
+  ASSERT_RAISES(Invalid, HashPartition(*batch, {"c"}, PartitionOptions(4)));
+}
+
+}  // namespace compute
+}  // namespace arrow
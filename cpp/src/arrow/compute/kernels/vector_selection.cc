@@ -23,11 +23,13 @@
 #include "arrow/array/array_binary.h"
 #include "arrow/array/array_dict.h"
 #include "arrow/array/array_nested.h"
+#include "arrow/array/builder_binary.h"
 #include "arrow/array/builder_primitive.h"
 #include "arrow/array/concatenate.h"
 #include "arrow/buffer_builder.h"
 #include "arrow/chunked_array.h"
 #include "arrow/compute/api_vector.h"
+#include "arrow/compute/cast.h"
 #include "arrow/compute/kernels/common.h"
 #include "arrow/compute/kernels/util_internal.h"
 #include "arrow/extension_type.h"
@@ -1605,7 +1607,7 @@ struct ListImpl : public Selection<ListImpl<Type>, Type> {
   ListImpl(KernelContext* ctx, const ExecBatch& batch, int64_t output_length, Datum* out)
       : Base(ctx, batch, output_length, out),
         offset_builder(ctx->memory_pool()),
-        child_index_builder(ctx->memory_pool()) {}
+        child_index_builder(ctx->scratch_pool()) {}
 
   template <typename Adapter>
   Status GenerateOutput() {
@@ -1663,7 +1665,8 @@ struct FSLImpl : public Selection<FSLImpl, FixedSizeListType> {
   LIFT_BASE_MEMBERS();
 
   FSLImpl(KernelContext* ctx, const ExecBatch& batch, int64_t output_length, Datum* out)
-      : Base(ctx, batch, output_length, out), child_index_builder(ctx->memory_pool()) {}
+      : Base(ctx, batch, output_length, out),
+        child_index_builder(ctx->scratch_pool()) {}
 
   template <typename Adapter>
   Status GenerateOutput() {
@@ -1746,7 +1749,7 @@ void StructFilter(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
   KERNEL_RETURN_IF_ERROR(
       ctx,
       GetTakeIndices(*batch[1].array(), FilterState::Get(ctx).null_selection_behavior,
-                     ctx->memory_pool())
+                     ctx->scratch_pool())
           .Value(&indices));
 
   Datum result;
@@ -1769,12 +1772,13 @@ Result<std::shared_ptr<RecordBatch>> FilterRecordBatch(const RecordBatch& batch,
     return Status::Invalid("Filter inputs must all be the same length");
   }
 
-  // Convert filter to selection vector/indices and use Take
+  // Convert filter to selection vector/indices and use Take.  The indices don't
+  // outlive this call.
   const auto& filter_opts = *static_cast<const FilterOptions*>(options);
   ARROW_ASSIGN_OR_RAISE(
       std::shared_ptr<ArrayData> indices,
       GetTakeIndices(*filter.array(), filter_opts.null_selection_behavior,
-                     ctx->memory_pool()));
+                     ctx->scratch_pool()));
   std::vector<std::shared_ptr<Array>> columns(batch.num_columns());
   for (int i = 0; i < batch.num_columns(); ++i) {
     ARROW_ASSIGN_OR_RAISE(Datum out, Take(batch.column(i)->data(), Datum(indices),
@@ -1830,7 +1834,7 @@ Result<std::shared_ptr<Table>> FilterTable(const Table& table, const Datum& filt
     ARROW_ASSIGN_OR_RAISE(
         const auto indices,
         GetTakeIndices(filter_chunk, filter_opts.null_selection_behavior,
-                       ctx->memory_pool()));
+                       ctx->scratch_pool()));
 
     if (indices->length > 0) {
       // Take from all input columns
@@ -1906,6 +1910,74 @@ Result<std::shared_ptr<Array>> TakeAA(const Array& values, const Array& indices,
   return result.make_array();
 }
 
+// Take from a chunked array of binary-like values, gathering the values from
+// the chunks directly rather than concatenating the chunks first, which
+// copies all of their data (and fails beyond 2GB of Binary or String data).
+// The output is made of as many chunks as needed to hold the data, but
+// usually only one.
+template <typename Type>
+Result<std::shared_ptr<ChunkedArray>> TakeCABaseBinary(const ChunkedArray& values,
+                                                        const Array& indices,
+                                                        const TakeOptions& options,
+                                                        ExecContext* ctx) {
+  using ArrayType = typename TypeTraits<Type>::ArrayType;
+
+  if (options.boundscheck) {
+    RETURN_NOT_OK(CheckIndexBounds(*indices.data(), values.length()));
+  }
+  std::shared_ptr<Array> int64_indices;
+  if (indices.type_id() == ::arrow::Type::INT64) {
+    int64_indices = MakeArray(indices.data());
+  } else {
+    ARROW_ASSIGN_OR_RAISE(int64_indices,
+                          Cast(indices, int64(), CastOptions::Unsafe(), ctx));
+  }
+  const auto& typed_indices = checked_cast<const Int64Array&>(*int64_indices);
+
+  // Resolve logical indices to a chunk and an index in that chunk, starting
+  // from the last chunk resolved as indices are often clustered
+  std::vector<int64_t> chunk_starts(values.num_chunks() + 1, 0);
+  for (int i = 0; i < values.num_chunks(); ++i) {
+    chunk_starts[i + 1] = chunk_starts[i] + values.chunk(i)->length();
+  }
+  int current_chunk = 0;
+  auto resolve = [&](int64_t index, int64_t* chunk_index) -> const ArrayType& {
+    if (index < chunk_starts[current_chunk] || index >= chunk_starts[current_chunk + 1]) {
+      current_chunk = static_cast<int>(std::upper_bound(chunk_starts.begin(),
+                                                        chunk_starts.end(), index) -
+                                       chunk_starts.begin()) -
+                      1;
+    }
+    *chunk_index = index - chunk_starts[current_chunk];
+    return checked_cast<const ArrayType&>(*values.chunk(current_chunk));
+  };
+
+  // Size the output exactly, so that it never needs to be reallocated
+  int64_t data_length = 0;
+  int64_t chunk_index;
+  for (int64_t i = 0; i < typed_indices.length(); ++i) {
+    if (typed_indices.IsValid(i)) {
+      const auto& chunk = resolve(typed_indices.Value(i), &chunk_index);
+      data_length += chunk.value_length(chunk_index);
+    }
+  }
+  ::arrow::internal::ChunkedBaseBinaryBuilder<Type> builder(
+      typed_indices.length(), std::numeric_limits<int64_t>::max(), ctx->memory_pool());
+  RETURN_NOT_OK(builder.Reserve(typed_indices.length()));
+  RETURN_NOT_OK(builder.ReserveData(data_length));
+  for (int64_t i = 0; i < typed_indices.length(); ++i) {
+    if (typed_indices.IsValid(i)) {
+      const auto& chunk = resolve(typed_indices.Value(i), &chunk_index);
+      if (chunk.IsValid(chunk_index)) {
+        RETURN_NOT_OK(builder.Append(chunk.GetView(chunk_index)));
+        continue;
+      }
+    }
+    RETURN_NOT_OK(builder.AppendNull());
+  }
+  return builder.Finish();
+}
+
 Result<std::shared_ptr<ChunkedArray>> TakeCA(const ChunkedArray& values,
                                              const Array& indices,
                                              const TakeOptions& options,
@@ -1914,6 +1986,21 @@ Result<std::shared_ptr<ChunkedArray>> TakeCA(const ChunkedArray& values,
   std::vector<std::shared_ptr<Array>> new_chunks(1);  // Hard-coded 1 for now
   std::shared_ptr<Array> current_chunk;
 
+  if (num_chunks > 1) {
+    switch (values.type()->id()) {
+      case Type::BINARY:
+        return TakeCABaseBinary<BinaryType>(values, indices, options, ctx);
+      case Type::STRING:
+        return TakeCABaseBinary<StringType>(values, indices, options, ctx);
+      case Type::LARGE_BINARY:
+        return TakeCABaseBinary<LargeBinaryType>(values, indices, options, ctx);
+      case Type::LARGE_STRING:
+        return TakeCABaseBinary<LargeStringType>(values, indices, options, ctx);
+      default:
+        break;
+    }
+  }
+
   // Case 1: `values` has a single chunk, so just use it
   if (num_chunks == 1) {
     current_chunk = values.chunk(0);
@@ -303,6 +303,35 @@ static void TakeStringMonotonicIndices(benchmark::State& state) {
   TakeBenchmark(state, /*indices_with_nulls=*/false, /*monotonic=*/true).FSLInt64();
 }
 
+// Take with random indices from values much larger than the TLB reach, allocated
+// either from the default pool (arg 0) or from huge pages (arg 1).
+static void TakeInt64LargeRandomIndices(benchmark::State& state) {
+  constexpr int64_t kNumValues = 1 << 24;  // 128 MiB of values
+  constexpr int64_t kNumIndices = 1 << 20;
+  MemoryPool* pool = default_memory_pool();
+  if (state.range(0) != 0) {
+    auto st = hugepage_memory_pool(&pool);
+    if (!st.ok()) {
+      state.SkipWithError(st.ToString().c_str());
+      return;
+    }
+  }
+
+  random::RandomArrayGenerator rand(kSeed);
+  auto values = rand.Int64(kNumValues, -100, 100, /*null_probability=*/0);
+  auto values_data = values->data()->Copy();
+  values_data->buffers[1] =
+      *values_data->buffers[1]->CopySlice(0, kNumValues * sizeof(int64_t), pool);
+  values = MakeArray(values_data);
+  auto indices = rand.Int32(kNumIndices, 0, kNumValues - 1, /*null_probability=*/0);
+
+  ExecContext ctx(pool);
+  for (auto _ : state) {
+    ABORT_NOT_OK(Take(values, indices, TakeOptions::Defaults(), &ctx).status());
+  }
+  state.SetItemsProcessed(state.iterations() * kNumIndices);
+}
+
 void FilterSetArgs(benchmark::internal::Benchmark* bench) {
   for (int64_t size : g_data_sizes) {
     for (int i = 0; i < static_cast<int>(g_filter_params.size()); ++i) {
@@ -338,6 +367,7 @@ void TakeSetArgs(benchmark::internal::Benchmark* bench) {
 BENCHMARK(TakeInt64RandomIndicesNoNulls)->Apply(TakeSetArgs);
 BENCHMARK(TakeInt64RandomIndicesWithNulls)->Apply(TakeSetArgs);
 BENCHMARK(TakeInt64MonotonicIndices)->Apply(TakeSetArgs);
+BENCHMARK(TakeInt64LargeRandomIndices)->ArgName("hugepages")->Arg(0)->Arg(1);
 BENCHMARK(TakeFSLInt64RandomIndicesNoNulls)->Apply(TakeSetArgs);
 BENCHMARK(TakeFSLInt64RandomIndicesWithNulls)->Apply(TakeSetArgs);
 BENCHMARK(TakeFSLInt64MonotonicIndices)->Apply(TakeSetArgs);
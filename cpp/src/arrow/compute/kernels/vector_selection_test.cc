@@ -664,6 +664,30 @@ TEST_F(TestFilterKernelWithRecordBatch, FilterRecordBatch) {
   ])");
 }
 
+TEST(TestFilterKernelScratchPool, RecordBatch) {
+  // Selection indices are allocated from the scratch pool, and don't outlive the call
+  random::RandomArrayGenerator rng(42);
+  const int64_t length = 1000;
+  auto batch = RecordBatch::Make(
+      schema({field("a", int32()), field("b", utf8()), field("c", list(int8()))}),
+      length,
+      {rng.Int32(length, 0, 100, 0.1), rng.String(length, 0, 10, 0.1),
+       rng.List(*rng.Int8(length * 2, 0, 100), length, 0.1)});
+  auto filter = rng.Boolean(length, 0.5, 0.1);
+  ASSERT_OK_AND_ASSIGN(Datum expected, Filter(batch, filter));
+
+  ArenaMemoryPool arena;
+  ExecContext ctx;
+  ctx.set_scratch_pool(&arena);
+  ASSERT_OK_AND_ASSIGN(Datum actual,
+                       Filter(batch, filter, FilterOptions::Defaults(), &ctx));
+  ASSERT_OK(actual.record_batch()->ValidateFull());
+  AssertBatchesEqual(*expected.record_batch(), *actual.record_batch());
+  ASSERT_GT(arena.max_memory(), 0);
+  ASSERT_EQ(arena.bytes_allocated(), 0);
+  arena.Reset();
+}
+
 class TestFilterKernelWithChunkedArray : public TestFilterKernel<ChunkedArray> {
  public:
   void AssertFilter(const std::shared_ptr<DataType>& type,
@@ -1477,6 +1501,31 @@ TEST_F(TestTakeKernelWithChunkedArray, TakeChunkedArray) {
                                                        {"[0, 1, 0]", "[5, 1]"}, &arr));
 }
 
+TEST_F(TestTakeKernelWithChunkedArray, TakeChunkedArrayBinaryLike) {
+  // Binary-like values are gathered from the chunks without concatenating them
+  for (auto type : {binary(), utf8(), large_binary(), large_utf8()}) {
+    SCOPED_TRACE(type->ToString());
+    this->AssertTake(type, {R"(["a", null])", "[]", R"(["bc", "def"])"},
+                     "[3, 0, null, 1, 2, 0]",
+                     {R"(["def", "a", null, null, "bc", "a"])"});
+    this->AssertTake(type, {"[]", R"([""])"}, "[]", {"[]"});
+    // No data to gather
+    this->AssertTake(type, {R"(["a"])", R"(["b"])"}, "[null]", {"[null]"});
+    this->AssertTake(type, {R"(["a"])", R"(["b"])"}, "[null, null]", {"[null, null]"});
+    this->AssertTake(type, {R"([""])", R"(["b", ""])"}, "[0, 2, 0]",
+                     {R"(["", "", ""])"});
+    this->AssertTake(type, {R"([""])", R"(["b", ""])"}, "[2, null]", {R"(["", null])"});
+    this->AssertChunkedTake(type, {R"(["a"])", R"(["b", "c"])"}, {"[2, 0]", "[]", "[1]"},
+                            {R"(["c", "a"])", "[]", R"(["b"])"});
+
+    std::shared_ptr<ChunkedArray> arr;
+    ASSERT_RAISES(IndexError,
+                  this->TakeWithArray(type, {R"(["a"])", R"(["b"])"}, "[0, 2]", &arr));
+    ASSERT_RAISES(IndexError,
+                  this->TakeWithArray(type, {R"(["a"])", R"(["b"])"}, "[-1]", &arr));
+  }
+}
+
 class TestTakeKernelWithTable : public TestTakeKernel<Table> {
  public:
   void AssertTake(const std::shared_ptr<Schema>& schm,
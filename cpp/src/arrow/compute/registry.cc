@@ -136,6 +136,7 @@ static std::unique_ptr<FunctionRegistry> CreateBuiltInRegistry() {
   RegisterVectorHash(registry.get());
   RegisterVectorSelection(registry.get());
   RegisterVectorNested(registry.get());
+  RegisterVectorPartition(registry.get());
   RegisterVectorSort(registry.get());
 
   return registry;
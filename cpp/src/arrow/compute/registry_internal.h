@@ -39,6 +39,7 @@ void RegisterScalarFillNull(FunctionRegistry* registry);
 void RegisterVectorHash(FunctionRegistry* registry);
 void RegisterVectorSelection(FunctionRegistry* registry);
 void RegisterVectorNested(FunctionRegistry* registry);
+void RegisterVectorPartition(FunctionRegistry* registry);
 void RegisterVectorSort(FunctionRegistry* registry);
 
 // Aggregate functions
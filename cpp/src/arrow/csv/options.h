@@ -24,6 +24,7 @@
 #include <vector>
 
 #include "arrow/csv/type_fwd.h"
+#include "arrow/util/cancel.h"
 #include "arrow/util/visibility.h"
 
 namespace arrow {
@@ -122,6 +123,9 @@ struct ARROW_EXPORT ReadOptions {
   /// Block size we request from the IO layer; also determines the size of
   /// chunks when use_threads is true
   int32_t block_size = 1 << 20;  // 1 MB
+  /// A token polled between blocks; once a stop was requested, reading fails with
+  /// the error given to StopSource::RequestStop()
+  StopToken stop_token;
 
   /// Number of header rows to skip (not including the row of column names, if any)
   int32_t skip_rows = 0;
@@ -670,6 +670,7 @@ class SerialStreamingReader : public BaseStreamingReader {
     }
 
     if (!source_eof_) {
+      RETURN_NOT_OK(read_options_.stop_token.Poll());
       ARROW_ASSIGN_OR_RAISE(auto maybe_block, block_reader_->Next());
       if (maybe_block.has_value()) {
         last_block_index_ = maybe_block->block_index;
@@ -750,6 +751,7 @@ class SerialTableReader : public BaseTableReader {
                                    std::move(buffer_iterator_), std::move(first_buffer));
 
     while (true) {
+      RETURN_NOT_OK(read_options_.stop_token.Poll());
       ARROW_ASSIGN_OR_RAISE(auto maybe_block, block_reader.Next());
       if (!maybe_block.has_value()) {
         // EOF
@@ -815,6 +817,7 @@ class ThreadedTableReader : public BaseTableReader {
                                      std::move(first_buffer));
 
     while (true) {
+      RETURN_NOT_OK(read_options_.stop_token.Poll());
       ARROW_ASSIGN_OR_RAISE(auto maybe_block, block_reader.Next());
       if (!maybe_block.has_value()) {
         // EOF
@@ -824,6 +827,7 @@ class ThreadedTableReader : public BaseTableReader {
 
       // Launch parse task
       task_group_->Append([this, maybe_block] {
+        RETURN_NOT_OK(read_options_.stop_token.Poll());
         return ParseAndInsert(maybe_block->partial, maybe_block->completion,
                               maybe_block->buffer, maybe_block->block_index,
                               maybe_block->is_final)
@@ -52,6 +52,25 @@ Result<std::shared_ptr<Schema>> Fragment::ReadPhysicalSchema() {
   return physical_schema_;
 }
 
+Result<FragmentCount> Fragment::CountRows(const Expression& predicate) {
+  FragmentCount count;
+  ARROW_ASSIGN_OR_RAISE(auto simplified, SimplifyWithPartition(predicate, *this));
+  if (simplified.IsSatisfiable()) {
+    count.remainder = shared_from_this();
+  }
+  return count;
+}
+
+Result<FragmentMinMax> Fragment::MinMax(const std::string& column,
+                                        const Expression& predicate) {
+  FragmentMinMax min_max;
+  ARROW_ASSIGN_OR_RAISE(auto simplified, SimplifyWithPartition(predicate, *this));
+  if (simplified.IsSatisfiable()) {
+    min_max.remainder = shared_from_this();
+  }
+  return min_max;
+}
+
 Result<std::shared_ptr<Schema>> InMemoryFragment::ReadPhysicalSchemaImpl() {
   return physical_schema_;
 }
@@ -92,6 +111,19 @@ Result<ScanTaskIterator> InMemoryFragment::Scan(std::shared_ptr<ScanOptions> opt
   return MakeMapIterator(fn, std::move(batches_it));
 }
 
+Result<FragmentCount> InMemoryFragment::CountRows(const Expression& predicate) {
+  ARROW_ASSIGN_OR_RAISE(auto simplified, SimplifyWithPartition(predicate, *this));
+  if (simplified != literal(true)) {
+    return Fragment::CountRows(simplified);
+  }
+
+  FragmentCount count;
+  for (const auto& batch : record_batches_) {
+    count.num_rows += batch->num_rows();
+  }
+  return count;
+}
+
 Dataset::Dataset(std::shared_ptr<Schema> schema, Expression partition_expression)
     : schema_(std::move(schema)),
       partition_expression_(std::move(partition_expression)) {}
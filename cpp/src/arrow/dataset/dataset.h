@@ -34,6 +34,29 @@
 namespace arrow {
 namespace dataset {
 
+/// \brief The number of rows of a Fragment which satisfy a predicate, as far as
+/// metadata could decide it.
+struct ARROW_DS_EXPORT FragmentCount {
+  /// Number of rows known to satisfy the predicate.
+  int64_t num_rows = 0;
+
+  /// The rows which metadata couldn't decide, or null if there are none. This
+  /// Fragment must be scanned (and filtered) to complete the count.
+  std::shared_ptr<Fragment> remainder;
+};
+
+/// \brief The extrema of a column over the rows of a Fragment which satisfy a
+/// predicate, as far as metadata could decide them.
+struct ARROW_DS_EXPORT FragmentMinMax {
+  /// Values whose min and max are the min and max of the decided rows. Empty if
+  /// there are no such rows, or if they are all null.
+  ScalarVector extrema;
+
+  /// The rows which metadata couldn't decide, or null if there are none. This
+  /// Fragment must be scanned (and filtered) to complete the min and max.
+  std::shared_ptr<Fragment> remainder;
+};
+
 /// \brief A granular piece of a Dataset, such as an individual file.
 ///
 /// A Fragment can be read/scanned separately from other fragments. It yields a
@@ -43,7 +66,7 @@ namespace dataset {
 /// Note that Fragments have well defined physical schemas which are reconciled by
 /// the Datasets which contain them; these physical schemas may differ from a parent
 /// Dataset's schema and the physical schemas of sibling Fragments.
-class ARROW_DS_EXPORT Fragment {
+class ARROW_DS_EXPORT Fragment : public std::enable_shared_from_this<Fragment> {
  public:
   /// \brief Return the physical schema of the Fragment.
   ///
@@ -65,6 +88,22 @@ class ARROW_DS_EXPORT Fragment {
   virtual Result<ScanTaskIterator> Scan(std::shared_ptr<ScanOptions> options,
                                         std::shared_ptr<ScanContext> context) = 0;
 
+  /// \brief Count the rows satisfying a bound predicate, using only metadata.
+  ///
+  /// The partition expression and any metadata (e.g. Parquet row group statistics)
+  /// are used to decide which rows satisfy the predicate without reading them.
+  /// The default implementation only prunes Fragments whose partition expression
+  /// excludes the predicate.
+  virtual Result<FragmentCount> CountRows(const Expression& predicate);
+
+  /// \brief Find the extrema of a column over the rows satisfying a bound
+  /// predicate, using only metadata.
+  ///
+  /// Metadata is only used if it is exact. The default implementation only prunes
+  /// Fragments whose partition expression excludes the predicate.
+  virtual Result<FragmentMinMax> MinMax(const std::string& column,
+                                        const Expression& predicate);
+
   /// \brief Return true if the fragment can benefit from parallel scanning.
   virtual bool splittable() const = 0;
 
@@ -99,6 +138,8 @@ class ARROW_DS_EXPORT InMemoryFragment : public Fragment {
   Result<ScanTaskIterator> Scan(std::shared_ptr<ScanOptions> options,
                                 std::shared_ptr<ScanContext> context) override;
 
+  Result<FragmentCount> CountRows(const Expression& predicate) override;
+
   bool splittable() const override { return false; }
 
   std::string type_name() const override { return "in-memory"; }
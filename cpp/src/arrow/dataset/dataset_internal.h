@@ -57,6 +57,24 @@ inline RecordBatchIterator IteratorFromReader(
   return MakeFunctionIterator([reader] { return reader->Next(); });
 }
 
+/// \brief Conjunct `r` into `*l`, avoiding a trivial literal(true) operand
+inline void FoldingAnd(Expression* l, Expression r) {
+  if (*l == literal(true)) {
+    *l = std::move(r);
+  } else {
+    *l = and_(std::move(*l), std::move(r));
+  }
+}
+
+/// \brief Simplify a predicate against a Fragment's partition expression.
+///
+/// Unbound predicates are returned as is.
+inline Result<Expression> SimplifyWithPartition(Expression predicate,
+                                                const Fragment& fragment) {
+  if (!predicate.IsBound()) return predicate;
+  return SimplifyWithGuarantee(std::move(predicate), fragment.partition_expression());
+}
+
 inline std::shared_ptr<Schema> SchemaFromColumnNames(
     const std::shared_ptr<Schema>& input, const std::vector<std::string>& column_names) {
   std::vector<std::shared_ptr<Field>> columns;
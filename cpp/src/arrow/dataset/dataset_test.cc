@@ -27,6 +27,9 @@
 #include "arrow/util/optional.h"
 
 namespace arrow {
+
+using internal::checked_cast;
+
 namespace dataset {
 
 class TestInMemoryFragment : public DatasetFixtureMixin {};
@@ -347,6 +350,59 @@ TEST(TestProjector, NonTrivial) {
   AssertBatchesEqual(*expected_batch, *reconciled_batch);
 }
 
+TEST(TestProjector, AugmentWithDictionaryValue) {
+  constexpr int64_t kBatchSize = 1024;
+
+  auto from_schema = schema({field("f64", float64())});
+  auto batch = ConstantArrayGenerator::Zeroes(kBatchSize, from_schema);
+  auto dict_type = dictionary(int32(), utf8());
+  auto to_schema = schema({field("f64", float64()), field("str", dict_type)});
+
+  RecordBatchProjector projector(to_schema);
+  auto value = MakeScalar(std::string("a long partition key"));
+  ASSERT_RAISES(TypeError, projector.SetDefaultValue(FieldRef("str"), MakeScalar(1)));
+  ASSERT_OK(projector.SetDefaultValue(FieldRef("str"), value));
+
+  ASSERT_OK_AND_ASSIGN(auto reconciled_batch, projector.Project(*batch));
+  ASSERT_OK(reconciled_batch->ValidateFull());
+  AssertSchemaEqual(*reconciled_batch->schema(), *to_schema);
+
+  // the value is stored once, and every index refers to it
+  const auto& str = checked_cast<const DictionaryArray&>(*reconciled_batch->column(1));
+  ASSERT_EQ(str.dictionary()->length(), 1);
+  ASSERT_OK_AND_ASSIGN(auto dictionary, MakeArrayFromScalar(*value, 1));
+  AssertArraysEqual(*dictionary, *str.dictionary());
+  ASSERT_OK_AND_ASSIGN(auto zeros, MakeArrayFromScalar(Int32Scalar(0), kBatchSize));
+  AssertArraysEqual(*zeros, *str.indices());
+
+  // projecting another batch reuses the same indices
+  ASSERT_OK_AND_ASSIGN(auto other_batch, projector.Project(*batch->Slice(1)));
+  const auto& other_str = checked_cast<const DictionaryArray&>(*other_batch->column(1));
+  ASSERT_EQ(other_str.indices()->data()->buffers[1]->data(),
+            str.indices()->data()->buffers[1]->data());
+}
+
+TEST(TestProjector, DictionaryEncode) {
+  constexpr int64_t kBatchSize = 1024;
+
+  auto from_schema = schema({field("i32", int32())});
+  auto batch = ConstantArrayGenerator::Zeroes(kBatchSize, from_schema);
+  auto to_schema = schema({field("i32", dictionary(int32(), int32()))});
+
+  RecordBatchProjector projector(to_schema);
+  ASSERT_OK_AND_ASSIGN(auto reconciled_batch, projector.Project(*batch));
+  ASSERT_OK(reconciled_batch->ValidateFull());
+  AssertSchemaEqual(*reconciled_batch->schema(), *to_schema);
+
+  const auto& i32 = checked_cast<const DictionaryArray&>(*reconciled_batch->column(0));
+  AssertArraysEqual(*batch->column(0)->Slice(0, 1), *i32.dictionary());
+  AssertArraysEqual(*batch->column(0), *i32.indices());
+
+  // only int32 indices are produced by dictionary encoding
+  RecordBatchProjector int8_indices(schema({field("i32", dictionary(int8(), int32()))}));
+  ASSERT_RAISES(TypeError, int8_indices.Project(*batch));
+}
+
 class TestEndToEnd : public TestUnionDataset {
   void SetUp() override {
     bool nullable = false;
@@ -18,6 +18,7 @@
 #include "arrow/dataset/discovery.h"
 
 #include <algorithm>
+#include <atomic>
 #include <memory>
 #include <string>
 #include <unordered_set>
@@ -30,11 +31,56 @@
 #include "arrow/dataset/type_fwd.h"
 #include "arrow/filesystem/path_forest.h"
 #include "arrow/filesystem/path_util.h"
+#include "arrow/io/util_internal.h"
+#include "arrow/util/checked_cast.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/stopwatch.h"
+#include "arrow/util/task_group.h"
+#include "arrow/util/thread_pool.h"
 
 namespace arrow {
 namespace dataset {
 
+namespace {
+
+/// Accumulate the wall clock time of a scope into a DiscoveryTimings member.
+class ScopedTimer {
+ public:
+  explicit ScopedTimer(double* seconds) : seconds_(seconds) { stop_watch_.Start(); }
+  ~ScopedTimer() { *seconds_ += static_cast<double>(stop_watch_.Stop()) * 1e-9; }
+
+ private:
+  double* seconds_;
+  internal::StopWatch stop_watch_;
+};
+
+/// Call `visit(i)` for each i in [0, num_files). At most `concurrency` calls are
+/// in flight at once, on the IO thread pool.
+template <typename Visit>
+Status VisitFiles(int concurrency, size_t num_files, Visit&& visit) {
+  if (concurrency <= 1 || num_files <= 1) {
+    for (size_t i = 0; i < num_files; ++i) {
+      RETURN_NOT_OK(visit(i));
+    }
+    return Status::OK();
+  }
+
+  auto task_group = internal::TaskGroup::MakeThreaded(io::internal::GetIOThreadPool());
+  std::atomic<size_t> next_file{0};
+  auto num_workers = std::min(static_cast<size_t>(concurrency), num_files);
+  for (size_t worker = 0; worker < num_workers; ++worker) {
+    task_group->Append([&] {
+      for (size_t i = next_file++; i < num_files && task_group->ok(); i = next_file++) {
+        RETURN_NOT_OK(visit(i));
+      }
+      return Status::OK();
+    });
+  }
+  return task_group->Finish();
+}
+
+}  // namespace
+
 DatasetFactory::DatasetFactory() : root_partition_(literal(true)) {}
 
 Result<std::shared_ptr<Schema>> DatasetFactory::Inspect(InspectOptions options) {
@@ -44,7 +90,20 @@ Result<std::shared_ptr<Schema>> DatasetFactory::Inspect(InspectOptions options)
     return arrow::schema({});
   }
 
-  return UnifySchemas(schemas);
+  ScopedTimer timer(&timings_.unify_schemas);
+
+  // Fragments frequently share a schema; unify each distinct schema only once
+  std::vector<std::shared_ptr<Schema>> distinct;
+  for (auto& schema : schemas) {
+    auto is_duplicate = [&](const std::shared_ptr<Schema>& other) {
+      return schema == other || schema->Equals(*other, /*check_metadata=*/true);
+    };
+    if (std::none_of(distinct.begin(), distinct.end(), is_duplicate)) {
+      distinct.push_back(std::move(schema));
+    }
+  }
+
+  return UnifySchemas(distinct);
 }
 
 Result<std::shared_ptr<Dataset>> DatasetFactory::Finish() {
@@ -114,43 +173,44 @@ FileSystemDatasetFactory::FileSystemDatasetFactory(
 Result<std::shared_ptr<DatasetFactory>> FileSystemDatasetFactory::Make(
     std::shared_ptr<fs::FileSystem> filesystem, const std::vector<std::string>& paths,
     std::shared_ptr<FileFormat> format, FileSystemFactoryOptions options) {
-  std::vector<fs::FileInfo> filtered_files;
+  std::vector<fs::FileInfo> files;
   for (const auto& path : paths) {
-    if (options.exclude_invalid_files) {
-      ARROW_ASSIGN_OR_RAISE(auto supported,
-                            format->IsSupported(FileSource(path, filesystem)));
-      if (!supported) {
-        continue;
-      }
-    }
-
-    filtered_files.emplace_back(path);
+    files.emplace_back(path);
   }
 
-  return std::shared_ptr<DatasetFactory>(
-      new FileSystemDatasetFactory(std::move(filtered_files), std::move(filesystem),
-                                   std::move(format), std::move(options)));
+  return Make(std::move(filesystem), files, std::move(format), std::move(options));
 }
 
 Result<std::shared_ptr<DatasetFactory>> FileSystemDatasetFactory::Make(
     std::shared_ptr<fs::FileSystem> filesystem, const std::vector<fs::FileInfo>& files,
     std::shared_ptr<FileFormat> format, FileSystemFactoryOptions options) {
+  DiscoveryTimings timings;
   std::vector<fs::FileInfo> filtered_files;
-  for (const auto& info : files) {
-    if (options.exclude_invalid_files) {
-      ARROW_ASSIGN_OR_RAISE(auto supported,
-                            format->IsSupported(FileSource(info, filesystem)));
-      if (!supported) {
-        continue;
+
+  if (options.exclude_invalid_files) {
+    ScopedTimer timer(&timings.check_files);
+
+    std::vector<char> supported(files.size(), false);
+    RETURN_NOT_OK(VisitFiles(options.inspect_concurrency, files.size(), [&](size_t i) {
+      ARROW_ASSIGN_OR_RAISE(supported[i],
+                            format->IsSupported(FileSource(files[i], filesystem)));
+      return Status::OK();
+    }));
+
+    for (size_t i = 0; i < files.size(); ++i) {
+      if (supported[i]) {
+        filtered_files.emplace_back(files[i]);
       }
     }
-
-    filtered_files.emplace_back(info);
+  } else {
+    filtered_files = files;
   }
 
-  return std::shared_ptr<DatasetFactory>(
+  auto factory =
       new FileSystemDatasetFactory(std::move(filtered_files), std::move(filesystem),
-                                   std::move(format), std::move(options)));
+                                   std::move(format), std::move(options));
+  factory->timings_ = timings;
+  return std::shared_ptr<DatasetFactory>(factory);
 }
 
 bool StartsWithAnyOf(const std::string& path, const std::vector<std::string>& prefixes) {
@@ -176,8 +236,14 @@ Result<std::shared_ptr<DatasetFactory>> FileSystemDatasetFactory::Make(
     options.partition_base_dir = selector.base_dir;
   }
 
-  ARROW_ASSIGN_OR_RAISE(selector.base_dir, filesystem->NormalizePath(selector.base_dir));
-  ARROW_ASSIGN_OR_RAISE(auto files, filesystem->GetFileInfo(selector));
+  DiscoveryTimings timings;
+  std::vector<fs::FileInfo> files;
+  {
+    ScopedTimer timer(&timings.list_files);
+    ARROW_ASSIGN_OR_RAISE(selector.base_dir,
+                          filesystem->NormalizePath(selector.base_dir));
+    ARROW_ASSIGN_OR_RAISE(files, filesystem->GetFileInfo(selector));
+  }
 
   // Filter out anything that's not a file or that's explicitly ignored
   Status st;
@@ -204,22 +270,29 @@ Result<std::shared_ptr<DatasetFactory>> FileSystemDatasetFactory::Make(
   // Sorting by path guarantees a stability sometimes needed by unit tests.
   std::sort(files.begin(), files.end(), fs::FileInfo::ByPath());
 
-  return Make(std::move(filesystem), std::move(files), std::move(format),
-              std::move(options));
+  ARROW_ASSIGN_OR_RAISE(auto factory, Make(std::move(filesystem), std::move(files),
+                                            std::move(format), std::move(options)));
+  internal::checked_cast<FileSystemDatasetFactory&>(*factory).timings_.list_files =
+      timings.list_files;
+  return factory;
 }
 
 Result<std::vector<std::shared_ptr<Schema>>> FileSystemDatasetFactory::InspectSchemas(
     InspectOptions options) {
-  std::vector<std::shared_ptr<Schema>> schemas;
+  size_t num_fragments = files_.size();
+  if (options.fragments >= 0) {
+    num_fragments = std::min(num_fragments, static_cast<size_t>(options.fragments));
+  }
 
-  const bool has_fragments_limit = options.fragments >= 0;
-  int fragments = options.fragments;
-  for (const auto& info : files_) {
-    if (has_fragments_limit && fragments-- == 0) break;
-    ARROW_ASSIGN_OR_RAISE(auto schema, format_->Inspect({info, fs_}));
-    schemas.push_back(schema);
+  std::vector<std::shared_ptr<Schema>> schemas(num_fragments);
+  {
+    ScopedTimer timer(&timings_.inspect_fragments);
+    RETURN_NOT_OK(VisitFiles(options_.inspect_concurrency, num_fragments, [&](size_t i) {
+      return format_->Inspect({files_[i], fs_}).Value(&schemas[i]);
+    }));
   }
 
+  ScopedTimer timer(&timings_.inspect_partitioning);
   ARROW_ASSIGN_OR_RAISE(auto partition_schema,
                         options_.partitioning.GetOrInferSchema(
                             StripPrefixAndFilename(files_, options_.partition_base_dir)));
@@ -250,6 +323,7 @@ Result<std::shared_ptr<Dataset>> FileSystemDatasetFactory::Finish(FinishOptions
     ARROW_ASSIGN_OR_RAISE(partitioning, factory->Finish(schema));
   }
 
+  ScopedTimer timer(&timings_.make_fragments);
   std::vector<std::shared_ptr<FileFragment>> fragments;
   for (const auto& info : files_) {
     auto fixed_path = StripPrefixAndFilename(info.path(), options_.partition_base_dir);
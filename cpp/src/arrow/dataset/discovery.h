@@ -73,6 +73,25 @@ struct FinishOptions {
   bool validate_fragments = false;
 };
 
+/// \brief Wall clock time spent in each stage of dataset discovery, in seconds.
+///
+/// Stages which don't apply to a DatasetFactory (or weren't run yet) are zero.
+/// Repeated calls to Inspect() or Finish() accumulate.
+struct DiscoveryTimings {
+  /// Crawling a FileSelector for files.
+  double list_files = 0;
+  /// Excluding unsupported files (see FileSystemFactoryOptions::exclude_invalid_files).
+  double check_files = 0;
+  /// Reading the physical schemas of fragments (for example Parquet footers).
+  double inspect_fragments = 0;
+  /// Inferring the schema of the partitioning.
+  double inspect_partitioning = 0;
+  /// Unifying the inspected schemas.
+  double unify_schemas = 0;
+  /// Parsing partition expressions and constructing fragments.
+  double make_fragments = 0;
+};
+
 /// \brief DatasetFactory provides a way to inspect/discover a Dataset's expected
 /// schema before materializing said Dataset.
 class ARROW_DS_EXPORT DatasetFactory {
@@ -96,12 +115,16 @@ class ARROW_DS_EXPORT DatasetFactory {
     return Status::OK();
   }
 
+  /// \brief Time spent in each stage of discovery by this factory.
+  const DiscoveryTimings& timings() const { return timings_; }
+
   virtual ~DatasetFactory() = default;
 
  protected:
   DatasetFactory();
 
   Expression root_partition_;
+  DiscoveryTimings timings_;
 };
 
 /// \brief DatasetFactory provides a way to inspect/discover a Dataset's
@@ -133,6 +156,8 @@ class ARROW_DS_EXPORT UnionDatasetFactory : public DatasetFactory {
   std::vector<std::shared_ptr<DatasetFactory>> factories_;
 };
 
+constexpr int kDefaultInspectConcurrency = 8;
+
 struct FileSystemFactoryOptions {
   // Either an explicit Partitioning or a PartitioningFactory to discover one.
   //
@@ -161,12 +186,18 @@ struct FileSystemFactoryOptions {
   std::string partition_base_dir;
 
   // Invalid files (via selector or explicitly) will be excluded by checking
-  // with the FileFormat::IsSupported method.  This will incur IO for each files
-  // in a serial and single threaded fashion. Disabling this feature will skip the
+  // with the FileFormat::IsSupported method.  This will incur IO for each file
+  // (see inspect_concurrency). Disabling this feature will skip the
   // IO, but unsupported files may be present in the Dataset
   // (resulting in an error at scan time).
   bool exclude_invalid_files = false;
 
+  // Maximum number of files which are checked (see exclude_invalid_files) or
+  // inspected (see InspectOptions::fragments) concurrently. Files are read on the
+  // IO thread pool, so its capacity also limits concurrency. A value of 1 reads
+  // files serially on the calling thread.
+  int inspect_concurrency = kDefaultInspectConcurrency;
+
   // When discovering from a Selector (and not from an explicit file list), ignore
   // files and directories matching any of these prefixes.
   //
@@ -354,6 +354,59 @@ TEST_F(FileSystemDatasetFactoryTest, InspectFragmentsLimit) {
   }
 }
 
+TEST_F(FileSystemDatasetFactoryTest, InspectConcurrently) {
+  // Files' schemas have a single field named after the file, and files whose name
+  // starts with "bad" are unsupported
+  class PathSchemaFileFormat : public DummyFileFormat {
+   public:
+    Result<bool> IsSupported(const FileSource& source) const override {
+      return source.path().find("bad") != 0;
+    }
+
+    Result<std::shared_ptr<Schema>> Inspect(const FileSource& source) const override {
+      return schema({field(source.path(), int32())});
+    }
+  };
+  format_ = std::make_shared<PathSchemaFileFormat>();
+  factory_options_.exclude_invalid_files = true;
+
+  std::vector<fs::FileInfo> files;
+  std::vector<std::string> expected_paths;
+  std::vector<std::shared_ptr<Schema>> expected_schemas;
+  FieldVector expected_fields;
+  for (int i = 0; i < 50; ++i) {
+    auto path = "file" + std::to_string(100 + i);
+    files.push_back(fs::File(path));
+    files.push_back(fs::File("bad" + std::to_string(100 + i)));
+    expected_paths.push_back(path);
+    expected_schemas.push_back(schema({field(path, int32())}));
+    expected_fields.push_back(field(path, int32()));
+  }
+  // the partitioning's schema
+  expected_schemas.push_back(schema({}));
+
+  InspectOptions options;
+  options.fragments = InspectOptions::kInspectAllFragments;
+
+  for (int concurrency : {1, 4, 64}) {
+    SCOPED_TRACE("concurrency = " + std::to_string(concurrency));
+    factory_options_.inspect_concurrency = concurrency;
+    MakeFactory(files);
+
+    // order is preserved regardless of concurrency
+    AssertInspectSchemas(expected_schemas, options);
+    AssertInspect(schema(expected_fields), options);
+
+    EXPECT_GT(factory_->timings().list_files, 0);
+    EXPECT_GT(factory_->timings().check_files, 0);
+    EXPECT_GT(factory_->timings().inspect_fragments, 0);
+    EXPECT_GT(factory_->timings().unify_schemas, 0);
+    EXPECT_EQ(factory_->timings().make_fragments, 0);
+
+    AssertFinishWithPaths(expected_paths, nullptr, options);
+  }
+}
+
 TEST_F(FileSystemDatasetFactoryTest, FilenameNotPartOfPartitions) {
   // ARROW-8726: Ensure filename is not a partition.
 
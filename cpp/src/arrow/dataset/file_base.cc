@@ -18,12 +18,21 @@
 #include "arrow/dataset/file_base.h"
 
 #include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
 #include <deque>
+#include <list>
+#include <mutex>
 #include <unordered_map>
 #include <unordered_set>
 #include <vector>
 
+#include "arrow/array/concatenate.h"
+#include "arrow/chunked_array.h"
+
 #include "arrow/dataset/dataset_internal.h"
+#include "arrow/dataset/expression_internal.h"
 #include "arrow/dataset/scanner.h"
 #include "arrow/dataset/scanner_internal.h"
 #include "arrow/filesystem/filesystem.h"
@@ -31,11 +40,12 @@
 #include "arrow/filesystem/path_util.h"
 #include "arrow/io/interfaces.h"
 #include "arrow/io/memory.h"
+#include "arrow/util/hash_util.h"
 #include "arrow/util/iterator.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/make_unique.h"
 #include "arrow/util/map.h"
-#include "arrow/util/mutex.h"
+#include "arrow/util/optional.h"
 #include "arrow/util/string.h"
 #include "arrow/util/task_group.h"
 
@@ -54,6 +64,157 @@ Result<std::shared_ptr<io::RandomAccessFile>> FileSource::Open() const {
   return custom_open_();
 }
 
+bool ColumnChunkCache::Key::operator==(const Key& other) const {
+  if (path != other.path || mtime != other.mtime || chunk != other.chunk ||
+      column != other.column || format != other.format) {
+    return false;
+  }
+  if (filesystem == other.filesystem) return true;
+  return filesystem != nullptr && other.filesystem != nullptr &&
+         filesystem->Equals(*other.filesystem);
+}
+
+size_t ColumnChunkCache::Key::Hash::operator()(const Key& key) const {
+  size_t h = std::hash<std::string>{}(key.path);
+  // Equal filesystems have the same type name
+  if (key.filesystem != nullptr) {
+    internal::hash_combine(h, key.filesystem->type_name());
+  }
+  internal::hash_combine(h, key.format);
+  internal::hash_combine(h, key.mtime);
+  internal::hash_combine(h, key.chunk);
+  internal::hash_combine(h, key.column);
+  return h;
+}
+
+ColumnChunkCache::ColumnChunkCache(int64_t capacity, MemoryPool* pool)
+    : capacity_(capacity), pool_(pool) {}
+
+std::shared_ptr<ColumnChunkCache> ColumnChunkCache::Make(int64_t capacity,
+                                                         MemoryPool* pool) {
+  return std::shared_ptr<ColumnChunkCache>(new ColumnChunkCache(capacity, pool));
+}
+
+util::optional<ColumnChunkCache::Key> ColumnChunkCache::MakeKey(const FileSource& source,
+                                                                std::string format,
+                                                                int chunk, int column) {
+  if (source.filesystem() == nullptr) return util::nullopt;
+  // Without a modification time, changes to the file can't be detected
+  if (source.file_info().mtime() == fs::kNoTime) return util::nullopt;
+
+  auto mtime = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                   source.file_info().mtime().time_since_epoch())
+                   .count();
+  return Key{source.filesystem(), std::move(format), source.path(),
+             static_cast<int64_t>(mtime), chunk, column};
+}
+
+namespace {
+
+// Sum the sizes of the distinct buffers referenced by an ArrayData, its children and
+// its dictionary. Slices are counted at their own size rather than their parent's, so
+// FileFormats copy the slices of larger buffers (such as an IPC record batch body)
+// before inserting them.
+void AccumulateBufferSizes(const ArrayData& data,
+                           std::unordered_set<const uint8_t*>* seen, int64_t* size) {
+  for (const auto& buffer : data.buffers) {
+    if (buffer == nullptr) continue;
+
+    if (seen->insert(buffer->data()).second) {
+      *size += buffer->size();
+    }
+  }
+
+  for (const auto& child : data.child_data) {
+    AccumulateBufferSizes(*child, seen, size);
+  }
+
+  if (data.dictionary != nullptr) {
+    AccumulateBufferSizes(*data.dictionary, seen, size);
+  }
+}
+
+int64_t RetainedSize(const ChunkedArray& column_chunk) {
+  std::unordered_set<const uint8_t*> seen;
+  int64_t size = 0;
+  for (const auto& chunk : column_chunk.chunks()) {
+    AccumulateBufferSizes(*chunk->data(), &seen, &size);
+  }
+  return size;
+}
+
+}  // namespace
+
+std::shared_ptr<ChunkedArray> ColumnChunkCache::Get(const Key& key) {
+  std::lock_guard<std::mutex> lock(mutex_);
+
+  auto it = index_.find(key);
+  if (it == index_.end()) {
+    ++stats_.misses;
+    return nullptr;
+  }
+
+  ++stats_.hits;
+  // move to the most recently used end
+  entries_.splice(entries_.end(), entries_, it->second);
+  return it->second->column_chunk;
+}
+
+void ColumnChunkCache::Put(Key key, std::shared_ptr<ChunkedArray> column_chunk) {
+  auto size = RetainedSize(*column_chunk);
+  if (size > capacity_) return;
+
+  std::lock_guard<std::mutex> lock(mutex_);
+
+  auto it = index_.find(key);
+  if (it != index_.end()) {
+    // already inserted by a concurrent scan; replace it
+    stats_.bytes -= it->second->size;
+    --stats_.num_entries;
+    entries_.erase(it->second);
+    index_.erase(it);
+  }
+
+  EvictUnlocked(stats_.bytes + size - capacity_);
+
+  entries_.push_back(Entry{key, std::move(column_chunk), size});
+  index_.emplace(std::move(key), std::prev(entries_.end()));
+  stats_.bytes += size;
+  ++stats_.num_entries;
+}
+
+void ColumnChunkCache::EvictUnlocked(int64_t bytes) {
+  while (bytes > 0 && !entries_.empty()) {
+    const auto& lru = entries_.front();
+    bytes -= lru.size;
+    stats_.bytes -= lru.size;
+    --stats_.num_entries;
+    ++stats_.evictions;
+    index_.erase(lru.key);
+    entries_.pop_front();
+  }
+}
+
+int64_t ColumnChunkCache::Evict(int64_t bytes) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto bytes_before = stats_.bytes;
+  EvictUnlocked(bytes);
+  return bytes_before - stats_.bytes;
+}
+
+void ColumnChunkCache::Clear() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  stats_.evictions += stats_.num_entries;
+  stats_.num_entries = stats_.bytes = 0;
+  index_.clear();
+  entries_.clear();
+}
+
+ColumnChunkCache::Stats ColumnChunkCache::stats() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return stats_;
+}
+
 Result<std::shared_ptr<FileFragment>> FileFormat::MakeFragment(
     FileSource source, std::shared_ptr<Schema> physical_schema) {
   return MakeFragment(std::move(source), literal(true), std::move(physical_schema));
@@ -81,15 +242,166 @@ Result<ScanTaskIterator> FileFragment::Scan(std::shared_ptr<ScanOptions> options
   return format_->ScanFile(std::move(options), std::move(context), this);
 }
 
+/// PartitionIndex maps the values which fragments' partition expressions guarantee
+/// for each field (as produced by DirectoryPartitioning and HivePartitioning) to the
+/// fragments with that value. This allows the fragments which may satisfy a predicate
+/// to be found without simplifying the predicate against every partition expression.
+class FileSystemDataset::PartitionIndex {
+ public:
+  static std::shared_ptr<PartitionIndex> Make(
+      const std::vector<std::shared_ptr<FileFragment>>& fragments) {
+    auto index = std::make_shared<PartitionIndex>();
+
+    int num_fragments = static_cast<int>(fragments.size());
+    for (int i = 0; i < num_fragments; ++i) {
+      auto maybe_known_values =
+          ExtractKnownFieldValues(fragments[i]->partition_expression());
+      if (!maybe_known_values.ok()) return NULLPTR;
+
+      for (const auto& ref_value : *maybe_known_values) {
+        auto name = ref_value.first.name();
+        if (name == NULLPTR || !ref_value.second.is_scalar()) continue;
+
+        auto value = ref_value.second.scalar();
+        auto& field_index = index->fields_[*name];
+        field_index.Insert(i, value);
+      }
+    }
+
+    // Fragments without a known value for a field may satisfy any predicate on it
+    for (auto& name_field_index : index->fields_) {
+      auto& field_index = name_field_index.second;
+      std::vector<bool> is_known(num_fragments, false);
+      for (const auto& value_fragments : field_index.fragments_by_value) {
+        for (int i : value_fragments.second) {
+          is_known[i] = true;
+        }
+      }
+      for (int i = 0; i < num_fragments; ++i) {
+        if (!is_known[i]) field_index.unknown.push_back(i);
+      }
+    }
+    return index;
+  }
+
+  /// Return (sorted) indices of fragments which may satisfy a predicate, or nullopt
+  /// if the index can't narrow the predicate's candidates.
+  Result<util::optional<std::vector<int>>> GetCandidates(
+      const Expression& predicate) const {
+    util::optional<std::vector<int>> candidates;
+
+    for (const auto& member : ConjunctionMembers(predicate)) {
+      // Only members referencing a single indexed field can be looked up
+      auto refs = FieldsInExpression(member);
+      if (refs.empty() || refs[0].name() == NULLPTR) continue;
+      if (std::any_of(refs.begin(), refs.end(),
+                      [&](const FieldRef& ref) { return !ref.Equals(refs[0]); })) {
+        continue;
+      }
+      auto it = fields_.find(*refs[0].name());
+      if (it == fields_.end()) continue;
+
+      ARROW_ASSIGN_OR_RAISE(auto matching, it->second.GetMatching(refs[0], member));
+      if (!candidates) {
+        candidates = std::move(matching);
+        continue;
+      }
+
+      std::vector<int> intersection;
+      std::set_intersection(candidates->begin(), candidates->end(), matching.begin(),
+                            matching.end(), std::back_inserter(intersection));
+      candidates = std::move(intersection);
+    }
+
+    return candidates;
+  }
+
+ private:
+  struct ScalarPtrsEqual {
+    bool operator()(const std::shared_ptr<Scalar>& l,
+                    const std::shared_ptr<Scalar>& r) const {
+      return l->Equals(*r);
+    }
+  };
+
+  struct FieldIndex {
+    void Insert(int fragment_index, const std::shared_ptr<Scalar>& value) {
+      if (fragments_by_value.empty()) {
+        value_type = value->type;
+      } else if (value_type != NULLPTR && !value_type->Equals(*value->type)) {
+        // values have differing types; lookup by hash is not possible
+        value_type = NULLPTR;
+      }
+      fragments_by_value[value].push_back(fragment_index);
+    }
+
+    // Return (sorted) indices of fragments which may satisfy a predicate referencing
+    // only this field.
+    Result<std::vector<int>> GetMatching(const FieldRef& ref,
+                                         const Expression& member) const {
+      std::vector<int> matching = unknown;
+
+      const Datum* lit = NULLPTR;
+      auto call = member.call();
+      if (call && call->function_name == "equal" && call->arguments[0].field_ref()) {
+        lit = call->arguments[1].literal();
+      }
+      if (lit != NULLPTR && lit->is_scalar() && value_type != NULLPTR &&
+          value_type->Equals(*lit->type())) {
+        // Equality with a literal: a single lookup
+        auto it = fragments_by_value.find(lit->scalar());
+        if (it != fragments_by_value.end()) {
+          matching.insert(matching.end(), it->second.begin(), it->second.end());
+        }
+      } else {
+        // Otherwise visit each distinct value rather than each fragment
+        for (const auto& value_fragments : fragments_by_value) {
+          auto guarantee = equal(field_ref(ref), literal(value_fragments.first));
+          ARROW_ASSIGN_OR_RAISE(auto simplified,
+                                SimplifyWithGuarantee(member, std::move(guarantee)));
+          if (simplified.IsSatisfiable()) {
+            matching.insert(matching.end(), value_fragments.second.begin(),
+                            value_fragments.second.end());
+          }
+        }
+      }
+
+      std::sort(matching.begin(), matching.end());
+      return matching;
+    }
+
+    std::unordered_map<std::shared_ptr<Scalar>, std::vector<int>, Scalar::Hash,
+                       ScalarPtrsEqual>
+        fragments_by_value;
+    // The type of all values, or null if they differ
+    std::shared_ptr<DataType> value_type;
+    // Fragments for which no value of this field is known
+    std::vector<int> unknown;
+  };
+
+  static std::vector<Expression> ConjunctionMembers(const Expression& predicate) {
+    auto call = predicate.call();
+    if (call == NULLPTR || call->function_name != "and_kleene") {
+      return {predicate};
+    }
+    return FlattenedAssociativeChain(predicate).fringe;
+  }
+
+  std::unordered_map<std::string, FieldIndex> fields_;
+};
+
 FileSystemDataset::FileSystemDataset(std::shared_ptr<Schema> schema,
                                      Expression root_partition,
                                      std::shared_ptr<FileFormat> format,
                                      std::shared_ptr<fs::FileSystem> filesystem,
-                                     std::vector<std::shared_ptr<FileFragment>> fragments)
+                                     std::vector<std::shared_ptr<FileFragment>> fragments,
+                                     std::shared_ptr<PartitionIndex> partition_index)
     : Dataset(std::move(schema), std::move(root_partition)),
       format_(std::move(format)),
       filesystem_(std::move(filesystem)),
-      fragments_(std::move(fragments)) {}
+      fragments_(std::move(fragments)),
+      partition_index_(partition_index ? std::move(partition_index)
+                                       : PartitionIndex::Make(fragments_)) {}
 
 Result<std::shared_ptr<FileSystemDataset>> FileSystemDataset::Make(
     std::shared_ptr<Schema> schema, Expression root_partition,
@@ -103,8 +415,9 @@ Result<std::shared_ptr<FileSystemDataset>> FileSystemDataset::Make(
 Result<std::shared_ptr<Dataset>> FileSystemDataset::ReplaceSchema(
     std::shared_ptr<Schema> schema) const {
   RETURN_NOT_OK(CheckProjectable(*schema_, *schema));
-  return std::shared_ptr<Dataset>(new FileSystemDataset(
-      std::move(schema), partition_expression_, format_, filesystem_, fragments_));
+  return std::shared_ptr<Dataset>(
+      new FileSystemDataset(std::move(schema), partition_expression_, format_,
+                            filesystem_, fragments_, partition_index_));
 }
 
 std::vector<std::string> FileSystemDataset::files() const {
@@ -139,13 +452,31 @@ std::string FileSystemDataset::ToString() const {
 Result<FragmentIterator> FileSystemDataset::GetFragmentsImpl(Expression predicate) {
   FragmentVector fragments;
 
-  for (const auto& fragment : fragments_) {
+  auto visit = [&](const std::shared_ptr<FileFragment>& fragment) -> Status {
     ARROW_ASSIGN_OR_RAISE(
         auto simplified,
         SimplifyWithGuarantee(predicate, fragment->partition_expression()));
     if (simplified.IsSatisfiable()) {
       fragments.push_back(fragment);
     }
+    return Status::OK();
+  };
+
+  util::optional<std::vector<int>> candidates;
+  if (partition_index_ != nullptr) {
+    ARROW_ASSIGN_OR_RAISE(candidates, partition_index_->GetCandidates(predicate));
+  }
+
+  if (candidates) {
+    // The index only narrows the fragments down; predicates which combine fields
+    // must still be checked against each candidate.
+    for (int i : *candidates) {
+      RETURN_NOT_OK(visit(fragments_[i]));
+    }
+  } else {
+    for (const auto& fragment : fragments_) {
+      RETURN_NOT_OK(visit(fragment));
+    }
   }
 
   return MakeVectorIterator(std::move(fragments));
@@ -173,197 +504,415 @@ Status ValidateBasenameTemplate(util::string_view basename_template) {
   return Status::OK();
 }
 
-/// WriteQueue allows batches to be pushed from multiple threads while another thread
-/// flushes some to disk.
-class WriteQueue {
+Status ValidateWriteOptions(const FileSystemDatasetWriteOptions& write_options) {
+  RETURN_NOT_OK(ValidateBasenameTemplate(write_options.basename_template));
+  if (write_options.max_open_files <= 0) {
+    return Status::Invalid("max_open_files must be greater than 0, got ",
+                           write_options.max_open_files);
+  }
+  if (write_options.max_rows_per_file < 0 || write_options.min_rows_per_group < 0) {
+    return Status::Invalid("max_rows_per_file and min_rows_per_group must be positive");
+  }
+  if (write_options.max_rows_per_file > 0 &&
+      write_options.min_rows_per_group > write_options.max_rows_per_file) {
+    return Status::Invalid("min_rows_per_group (", write_options.min_rows_per_group,
+                           ") exceeds max_rows_per_file (",
+                           write_options.max_rows_per_file, ")");
+  }
+  return Status::OK();
+}
+
+class DatasetWriter;
+
+/// PartitionWriter buffers the batches of a partition and writes them into a
+/// succession of files. Batches may be pushed from multiple threads.
+class PartitionWriter {
  public:
-  WriteQueue(std::string partition_expression, size_t index,
-             std::shared_ptr<Schema> schema)
-      : partition_expression_(std::move(partition_expression)),
-        index_(index),
+  PartitionWriter(DatasetWriter* dataset_writer, std::string directory,
+                  std::shared_ptr<Schema> schema)
+      : dataset_writer_(dataset_writer),
+        directory_(std::move(directory)),
         schema_(std::move(schema)) {}
 
-  // Push a batch into the writer's queue of pending writes.
-  void Push(std::shared_ptr<RecordBatch> batch) {
-    auto push_lock = push_mutex_.Lock();
-    pending_.push_back(std::move(batch));
+  // Buffer a batch, and write buffered rows if there are enough of them.
+  Status Write(std::shared_ptr<RecordBatch> batch);
+
+  // Write all buffered rows and close the current file.
+  Status Finish();
+
+ private:
+  friend class DatasetWriter;
+
+  // The following methods must be called with mutex_ locked.
+
+  Status Flush(bool force);
+
+  Result<std::shared_ptr<RecordBatch>> TakePending(int64_t num_rows);
+
+  Status CloseFile();
+
+  DatasetWriter* dataset_writer_;
+  // The (formatted) partition expression to which this writer corresponds
+  std::string directory_;
+  std::shared_ptr<Schema> schema_;
+
+  std::mutex mutex_;
+  std::deque<std::shared_ptr<RecordBatch>> pending_;
+  int64_t num_pending_rows_ = 0;
+
+  std::shared_ptr<FileWriter> writer_;
+  int64_t num_rows_in_file_ = 0;
+  // Position in DatasetWriter::open_writers_, valid while writer_ is open
+  std::list<PartitionWriter*>::iterator lru_position_;
+};
+
+/// DatasetWriter maps partitions to PartitionWriters, and bounds the number of
+/// files open at once by closing the least recently used ones.
+class DatasetWriter {
+ public:
+  explicit DatasetWriter(const FileSystemDatasetWriteOptions& write_options)
+      : write_options_(write_options) {}
+
+  const FileSystemDatasetWriteOptions& write_options() const { return write_options_; }
+
+  PartitionWriter* GetPartitionWriter(const std::string& directory,
+                                      const std::shared_ptr<Schema>& schema) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return internal::GetOrInsertGenerated(
+               &partition_writers_, directory,
+               [&](const std::string& emplaced_directory) {
+                 // lookup in `partition_writers_` also failed,
+                 // generate a new PartitionWriter
+                 return internal::make_unique<PartitionWriter>(this, emplaced_directory,
+                                                               schema);
+               })
+        ->second.get();
   }
 
-  // Flush all pending batches, or return immediately if another thread is already
-  // flushing this queue.
-  Status Flush(const FileSystemDatasetWriteOptions& write_options) {
-    if (auto writer_lock = writer_mutex_.TryLock()) {
-      if (writer_ == nullptr) {
-        // FileWriters are opened lazily to avoid blocking access to a scan-wide queue set
-        RETURN_NOT_OK(OpenWriter(write_options));
-      }
+  std::vector<PartitionWriter*> partition_writers() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::vector<PartitionWriter*> out;
+    for (const auto& directory_writer : partition_writers_) {
+      out.push_back(directory_writer.second.get());
+    }
+    return out;
+  }
 
-      while (true) {
-        std::shared_ptr<RecordBatch> batch;
-        {
-          auto push_lock = push_mutex_.Lock();
-          if (pending_.empty()) {
-            // Ensure the writer_lock is released before the push_lock. Otherwise another
-            // thread might successfully Push() a batch but then fail to Flush() it since
-            // the writer_lock is still held, leaving an unflushed batch in pending_.
-            writer_lock.Unlock();
+  // Open a new file for a PartitionWriter (whose mutex is locked by the caller).
+  Status OpenFile(PartitionWriter* partition_writer) {
+    size_t index;
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      ++num_waiting_;
+      while (num_open_files_ >= write_options_.max_open_files) {
+        // Close the least recently used file whose writer isn't busy
+        PartitionWriter* victim = NULLPTR;
+        for (PartitionWriter* candidate : open_writers_) {
+          if (candidate->mutex_.try_lock()) {
+            victim = candidate;
             break;
           }
-          batch = std::move(pending_.front());
-          pending_.pop_front();
         }
-        RETURN_NOT_OK(writer_->Write(batch));
+        if (victim == NULLPTR) {
+          // All open files are being written to, wait for one to become idle
+          cv_.wait(lock);
+          continue;
+        }
+
+        lock.unlock();
+        Status st = victim->CloseFile();
+        victim->mutex_.unlock();
+        lock.lock();
+        if (!st.ok()) {
+          --num_waiting_;
+          return st;
+        }
       }
+      --num_waiting_;
+      ++num_open_files_;
+      index = file_index_++;
     }
+
+    auto basename = internal::Replace(write_options_.basename_template, kIntegerToken,
+                                      std::to_string(index));
+    if (!basename) {
+      ReleaseFile(NULLPTR);
+      return Status::Invalid("string interpolation of basename template failed");
+    }
+
+    auto dir = fs::internal::EnsureTrailingSlash(write_options_.base_dir) +
+               partition_writer->directory_;
+    auto path = fs::internal::ConcatAbstractPath(dir, *basename);
+
+    auto maybe_writer = [&]() -> Result<std::shared_ptr<FileWriter>> {
+      RETURN_NOT_OK(write_options_.filesystem->CreateDir(dir));
+      ARROW_ASSIGN_OR_RAISE(auto destination,
+                            write_options_.filesystem->OpenOutputStream(path));
+      return write_options_.format()->MakeWriter(std::move(destination),
+                                                 partition_writer->schema_,
+                                                 write_options_.file_write_options);
+    }();
+    if (!maybe_writer.ok()) {
+      ReleaseFile(NULLPTR);
+      return maybe_writer.status();
+    }
+
+    partition_writer->writer_ = maybe_writer.MoveValueUnsafe();
+    partition_writer->num_rows_in_file_ = 0;
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    partition_writer->lru_position_ =
+        open_writers_.insert(open_writers_.end(), partition_writer);
     return Status::OK();
   }
 
-  const std::shared_ptr<FileWriter>& writer() const { return writer_; }
+  // Mark a PartitionWriter's file as most recently used.
+  void Touch(PartitionWriter* partition_writer) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    open_writers_.splice(open_writers_.end(), open_writers_,
+                         partition_writer->lru_position_);
+  }
+
+  // Account for a closed file (or a file which failed to open, if null).
+  void ReleaseFile(PartitionWriter* partition_writer) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (partition_writer != NULLPTR) {
+      open_writers_.erase(partition_writer->lru_position_);
+    }
+    --num_open_files_;
+    cv_.notify_all();
+  }
+
+  // Wake up OpenFile() calls waiting for an open file to become idle.
+  void NotifyIdle() {
+    if (num_waiting_.load() > 0) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      cv_.notify_all();
+    }
+  }
 
  private:
-  Status OpenWriter(const FileSystemDatasetWriteOptions& write_options) {
-    auto dir =
-        fs::internal::EnsureTrailingSlash(write_options.base_dir) + partition_expression_;
+  const FileSystemDatasetWriteOptions& write_options_;
+
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  std::unordered_map<std::string, std::unique_ptr<PartitionWriter>> partition_writers_;
+  // PartitionWriters with an open file, least recently used first
+  std::list<PartitionWriter*> open_writers_;
+  int num_open_files_ = 0;
+  std::atomic<int> num_waiting_{0};
+  size_t file_index_ = 0;
+};
 
-    auto basename = internal::Replace(write_options.basename_template, kIntegerToken,
-                                      std::to_string(index_));
-    if (!basename) {
-      return Status::Invalid("string interpolation of basename template failed");
+Status PartitionWriter::Write(std::shared_ptr<RecordBatch> batch) {
+  Status st;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    num_pending_rows_ += batch->num_rows();
+    pending_.push_back(std::move(batch));
+    st = Flush(/*force=*/false);
+  }
+  dataset_writer_->NotifyIdle();
+  return st;
+}
+
+Status PartitionWriter::Finish() {
+  Status st;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    st = Flush(/*force=*/true);
+    if (st.ok()) st = CloseFile();
+  }
+  dataset_writer_->NotifyIdle();
+  return st;
+}
+
+Status PartitionWriter::Flush(bool force) {
+  const auto& write_options = dataset_writer_->write_options();
+
+  while (!pending_.empty() &&
+         (force || num_pending_rows_ >= write_options.min_rows_per_group)) {
+    if (writer_ == nullptr) {
+      RETURN_NOT_OK(dataset_writer_->OpenFile(this));
+    } else {
+      dataset_writer_->Touch(this);
     }
 
-    auto path = fs::internal::ConcatAbstractPath(dir, *basename);
+    int64_t num_rows = num_pending_rows_;
+    if (write_options.max_rows_per_file > 0) {
+      num_rows = std::min(num_rows, write_options.max_rows_per_file - num_rows_in_file_);
+    }
 
-    RETURN_NOT_OK(write_options.filesystem->CreateDir(dir));
-    ARROW_ASSIGN_OR_RAISE(auto destination,
-                          write_options.filesystem->OpenOutputStream(path));
+    ARROW_ASSIGN_OR_RAISE(auto batch, TakePending(num_rows));
+    RETURN_NOT_OK(writer_->Write(batch));
+    num_rows_in_file_ += num_rows;
 
-    ARROW_ASSIGN_OR_RAISE(
-        writer_, write_options.format()->MakeWriter(std::move(destination), schema_,
-                                                    write_options.file_write_options));
-    return Status::OK();
+    if (num_rows_in_file_ == write_options.max_rows_per_file) {
+      RETURN_NOT_OK(CloseFile());
+    }
   }
+  return Status::OK();
+}
 
-  util::Mutex writer_mutex_;
-  std::shared_ptr<FileWriter> writer_;
+Result<std::shared_ptr<RecordBatch>> PartitionWriter::TakePending(int64_t num_rows) {
+  num_pending_rows_ -= num_rows;
 
-  util::Mutex push_mutex_;
-  std::deque<std::shared_ptr<RecordBatch>> pending_;
+  auto front = pending_.front();
+  if (front->num_rows() >= num_rows) {
+    // Common case: no need to concatenate
+    if (front->num_rows() == num_rows) {
+      pending_.pop_front();
+    } else {
+      pending_.front() = front->Slice(num_rows);
+    }
+    return front->Slice(0, num_rows);
+  }
+
+  RecordBatchVector batches;
+  for (int64_t taken = 0; taken < num_rows;) {
+    auto batch = std::move(pending_.front());
+    pending_.pop_front();
+    if (taken + batch->num_rows() > num_rows) {
+      pending_.push_front(batch->Slice(num_rows - taken));
+      batch = batch->Slice(0, num_rows - taken);
+    }
+    taken += batch->num_rows();
+    batches.push_back(std::move(batch));
+  }
+
+  ArrayVector columns(schema_->num_fields());
+  for (int i = 0; i < schema_->num_fields(); ++i) {
+    ArrayVector chunks;
+    for (const auto& batch : batches) {
+      chunks.push_back(batch->column(i));
+    }
+    ARROW_ASSIGN_OR_RAISE(columns[i], Concatenate(chunks));
+  }
+  return RecordBatch::Make(schema_, num_rows, std::move(columns));
+}
 
-  // The (formatted) partition expression to which this queue corresponds
-  std::string partition_expression_;
+Status PartitionWriter::CloseFile() {
+  if (writer_ == nullptr) return Status::OK();
 
-  size_t index_;
+  auto writer = std::move(writer_);
+  dataset_writer_->ReleaseFile(this);
+  return writer->Finish();
+}
 
-  std::shared_ptr<Schema> schema_;
+/// Bound the number of ScanTasks in flight, so that the writer doesn't race ahead of
+/// the disk and buffer an unbounded amount of data.
+class TaskThrottle {
+ public:
+  explicit TaskThrottle(int max_in_flight) : max_in_flight_(max_in_flight) {}
+
+  // Wait until a task may be started. Returns false if a task failed.
+  bool Acquire() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    cv_.wait(lock, [&] { return in_flight_ < max_in_flight_ || failed_; });
+    if (failed_) return false;
+    ++in_flight_;
+    return true;
+  }
+
+  // Signal that a task completed. A task group skips the tasks appended after a
+  // failure, so those will never be released; stop waiting for them.
+  void Release(bool ok) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    --in_flight_;
+    failed_ |= !ok;
+    cv_.notify_one();
+  }
+
+ private:
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  int in_flight_ = 0;
+  bool failed_ = false;
+  const int max_in_flight_;
 };
 
 Status FileSystemDataset::Write(const FileSystemDatasetWriteOptions& write_options,
                                 std::shared_ptr<Scanner> scanner) {
-  RETURN_NOT_OK(ValidateBasenameTemplate(write_options.basename_template));
+  RETURN_NOT_OK(ValidateWriteOptions(write_options));
 
   auto task_group = scanner->context()->TaskGroup();
 
-  // Things we'll un-lazy for the sake of simplicity, with the tradeoff they represent:
-  //
-  // - Fragment iteration. Keeping this lazy would allow us to start partitioning/writing
-  //   any fragments we have before waiting for discovery to complete. This isn't
-  //   currently implemented for FileSystemDataset anyway: ARROW-8613
-  //
-  // - ScanTask iteration. Keeping this lazy would save some unnecessary blocking when
-  //   writing Fragments which produce scan tasks slowly. No Fragments do this.
-  //
-  // NB: neither of these will have any impact whatsoever on the common case of writing
-  //     an in-memory table to disk.
-  ARROW_ASSIGN_OR_RAISE(auto fragment_it, scanner->GetFragments());
-  ARROW_ASSIGN_OR_RAISE(FragmentVector fragments, fragment_it.ToVector());
-  ScanTaskVector scan_tasks;
-  std::vector<const Fragment*> fragment_for_task;
-
   // Avoid contention with multithreaded readers
   auto context = std::make_shared<ScanContext>(*scanner->context());
   context->use_threads = false;
 
-  for (const auto& fragment : fragments) {
-    auto options = std::make_shared<ScanOptions>(*scanner->options());
-    ARROW_ASSIGN_OR_RAISE(auto scan_task_it,
-                          Scanner(fragment, std::move(options), context).Scan());
-    for (auto maybe_scan_task : scan_task_it) {
-      ARROW_ASSIGN_OR_RAISE(auto scan_task, maybe_scan_task);
-      scan_tasks.push_back(std::move(scan_task));
-      fragment_for_task.push_back(fragment.get());
-    }
-  }
-
-  // Store a mapping from partitions (represened by their formatted partition expressions)
-  // to a WriteQueue which flushes batches into that partition's output file. In principle
-  // any thread could produce a batch for any partition, so each task alternates between
-  // pushing batches and flushing them to disk.
-  util::Mutex queues_mutex;
-  std::unordered_map<std::string, std::unique_ptr<WriteQueue>> queues;
-
-  auto fragment_for_task_it = fragment_for_task.begin();
-  for (const auto& scan_task : scan_tasks) {
-    const Fragment* fragment = *fragment_for_task_it++;
-
-    task_group->Append([&, scan_task, fragment] {
-      ARROW_ASSIGN_OR_RAISE(auto batches, scan_task->Execute());
-
-      for (auto maybe_batch : batches) {
-        ARROW_ASSIGN_OR_RAISE(auto batch, maybe_batch);
-        ARROW_ASSIGN_OR_RAISE(auto groups, write_options.partitioning->Partition(batch));
-        batch.reset();  // drop to hopefully conserve memory
+  // Store a mapping from partitions (represented by their formatted partition
+  // expressions) to a PartitionWriter which writes batches into that partition's files.
+  // In principle any thread could produce a batch for any partition, so each task
+  // pushes batches into the relevant PartitionWriters, which write them out.
+  DatasetWriter dataset_writer(write_options);
+
+  auto write_task = [&](const std::shared_ptr<ScanTask>& scan_task,
+                        const Fragment& fragment) -> Status {
+    ARROW_ASSIGN_OR_RAISE(auto batches, scan_task->Execute());
+
+    for (auto maybe_batch : batches) {
+      ARROW_ASSIGN_OR_RAISE(auto batch, maybe_batch);
+      ARROW_ASSIGN_OR_RAISE(auto groups, write_options.partitioning->Partition(batch));
+      batch.reset();  // drop to hopefully conserve memory
+
+      if (groups.batches.size() > static_cast<size_t>(write_options.max_partitions)) {
+        return Status::Invalid("Fragment would be written into ", groups.batches.size(),
+                               " partitions. This exceeds the maximum of ",
+                               write_options.max_partitions);
+      }
 
-        if (groups.batches.size() > static_cast<size_t>(write_options.max_partitions)) {
-          return Status::Invalid("Fragment would be written into ", groups.batches.size(),
-                                 " partitions. This exceeds the maximum of ",
-                                 write_options.max_partitions);
-        }
+      for (size_t i = 0; i < groups.batches.size(); ++i) {
+        auto partition_expression =
+            and_(std::move(groups.expressions[i]), fragment.partition_expression());
+        auto batch = std::move(groups.batches[i]);
 
-        std::unordered_set<WriteQueue*> need_flushed;
-        for (size_t i = 0; i < groups.batches.size(); ++i) {
-          auto partition_expression =
-              and_(std::move(groups.expressions[i]), fragment->partition_expression());
-          auto batch = std::move(groups.batches[i]);
-
-          ARROW_ASSIGN_OR_RAISE(auto part,
-                                write_options.partitioning->Format(partition_expression));
-
-          WriteQueue* queue;
-          {
-            // lookup the queue to which batch should be appended
-            auto queues_lock = queues_mutex.Lock();
-
-            queue = internal::GetOrInsertGenerated(
-                        &queues, std::move(part),
-                        [&](const std::string& emplaced_part) {
-                          // lookup in `queues` also failed,
-                          // generate a new WriteQueue
-                          size_t queue_index = queues.size() - 1;
-
-                          return internal::make_unique<WriteQueue>(
-                              emplaced_part, queue_index, batch->schema());
-                        })
-                        ->second.get();
-          }
+        ARROW_ASSIGN_OR_RAISE(auto part,
+                              write_options.partitioning->Format(partition_expression));
 
-          queue->Push(std::move(batch));
-          need_flushed.insert(queue);
-        }
+        auto partition_writer = dataset_writer.GetPartitionWriter(part, batch->schema());
+        RETURN_NOT_OK(partition_writer->Write(std::move(batch)));
+      }
+    }
 
-        // flush all touched WriteQueues
-        for (auto queue : need_flushed) {
-          RETURN_NOT_OK(queue->Flush(write_options));
-        }
+    return Status::OK();
+  };
+
+  // Fragments and ScanTasks are iterated lazily, and at most a few ScanTasks per
+  // thread are in flight, so that memory usage doesn't grow with the dataset.
+  TaskThrottle throttle(2 * task_group->parallelism());
+
+  auto append_write_tasks = [&]() -> Status {
+    ARROW_ASSIGN_OR_RAISE(auto fragment_it, scanner->GetFragments());
+    for (auto maybe_fragment : fragment_it) {
+      ARROW_ASSIGN_OR_RAISE(auto fragment, maybe_fragment);
+
+      auto options = std::make_shared<ScanOptions>(*scanner->options());
+      ARROW_ASSIGN_OR_RAISE(auto scan_task_it,
+                            Scanner(fragment, std::move(options), context).Scan());
+      for (auto maybe_scan_task : scan_task_it) {
+        ARROW_ASSIGN_OR_RAISE(auto scan_task, maybe_scan_task);
+        // stop early if a task failed; the error will be reported by Finish()
+        if (!throttle.Acquire()) return Status::OK();
+
+        task_group->Append([&, scan_task, fragment] {
+          Status st = write_task(scan_task, *fragment);
+          throttle.Release(st.ok());
+          return st;
+        });
       }
+    }
+    return Status::OK();
+  };
 
-      return Status::OK();
-    });
-  }
-  RETURN_NOT_OK(task_group->Finish());
+  // Tasks reference locals of this function, so wait for them even on error
+  Status st = append_write_tasks();
+  st &= task_group->Finish();
+  RETURN_NOT_OK(st);
 
   task_group = scanner->context()->TaskGroup();
-  for (const auto& part_queue : queues) {
-    task_group->Append([&] { return part_queue.second->writer()->Finish(); });
+  for (auto partition_writer : dataset_writer.partition_writers()) {
+    task_group->Append([partition_writer] { return partition_writer->Finish(); });
   }
   return task_group->Finish();
 }
@@ -20,8 +20,11 @@
 #pragma once
 
 #include <functional>
+#include <list>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -34,7 +37,9 @@
 #include "arrow/filesystem/filesystem.h"
 #include "arrow/filesystem/path_forest.h"
 #include "arrow/io/file.h"
+#include "arrow/memory_pool.h"
 #include "arrow/util/compression.h"
+#include "arrow/util/optional.h"
 
 namespace arrow {
 
@@ -98,6 +103,9 @@ class ARROW_DS_EXPORT FileSource {
   /// \brief Return the filesystem, if any. Otherwise returns nullptr
   const std::shared_ptr<fs::FileSystem>& filesystem() const { return filesystem_; }
 
+  /// \brief Return the FileInfo of the file. Only valid when file source wraps a path.
+  const fs::FileInfo& file_info() const { return file_info_; }
+
   /// \brief Return the buffer containing the file, if any. Otherwise returns nullptr
   const std::shared_ptr<Buffer>& buffer() const { return buffer_; }
 
@@ -116,6 +124,117 @@ class ARROW_DS_EXPORT FileSource {
   Compression::type compression_ = Compression::UNCOMPRESSED;
 };
 
+/// \brief A byte-budgeted LRU cache of decoded column chunks.
+///
+/// A column chunk is a column of one record batch (Feather/IPC) or row group (Parquet)
+/// of a file. When a ColumnChunkCache is set as ScanContext::column_cache, FileFormats
+/// which support it look up column chunks here before reading and decoding them, and
+/// insert the column chunks they decode. Chunks are keyed by the file's filesystem,
+/// path and modification time, so a file which is modified in place (and whose
+/// FileInfo has an up to date mtime) isn't served stale data, and by the options of
+/// the FileFormat which affect decoding. Files whose mtime is unknown aren't cached.
+///
+/// stats().bytes reports the memory retained by cached column chunks. FileFormats
+/// allocate the buffers they decode for the cache (decompressed or decoded data, as
+/// opposed to buffers read verbatim from the file) from pool(), so that the memory
+/// held by the cache and by scans which use it can be observed separately.
+class ARROW_DS_EXPORT ColumnChunkCache {
+ public:
+  struct Key {
+    /// The filesystem of the file. Keys match if their filesystems are equal
+    /// according to FileSystem::Equals().
+    std::shared_ptr<fs::FileSystem> filesystem;
+    /// The type name of the FileFormat, followed by any of its options which affect
+    /// the decoded column chunks (such as the Parquet columns read as dictionaries)
+    std::string format;
+    std::string path;
+    /// Modification time of the file, in nanoseconds since the epoch
+    int64_t mtime;
+    /// Index of the record batch or row group
+    int chunk;
+    /// Index of the column in the file's physical schema
+    int column;
+
+    bool operator==(const Key& other) const;
+
+    struct Hash {
+      size_t operator()(const Key& key) const;
+    };
+  };
+
+  struct Stats {
+    int64_t hits = 0;
+    int64_t misses = 0;
+    int64_t evictions = 0;
+    int64_t num_entries = 0;
+    /// Bytes retained by cached column chunks
+    int64_t bytes = 0;
+
+    double hit_rate() const {
+      return hits + misses == 0 ? 0 : static_cast<double>(hits) / (hits + misses);
+    }
+  };
+
+  /// \brief Make a cache retaining at most capacity bytes of column chunks.
+  ///
+  /// \param[in] capacity the budget of the cache, in bytes
+  /// \param[in] pool the pool from which decoded column chunks are allocated
+  /// (through a ProxyMemoryPool private to the cache)
+  static std::shared_ptr<ColumnChunkCache> Make(int64_t capacity,
+                                                MemoryPool* pool = default_memory_pool());
+
+  /// \brief Make the key of a column chunk, or return nullopt if the FileSource
+  /// can't be cached (it doesn't wrap a path, or its mtime is unknown).
+  static util::optional<Key> MakeKey(const FileSource& source, std::string format,
+                                     int chunk, int column);
+
+  /// \brief Look up a column chunk, returning null if it isn't cached.
+  std::shared_ptr<ChunkedArray> Get(const Key& key);
+
+  /// \brief Insert a column chunk, evicting the least recently used chunks to make
+  /// room for it. Column chunks larger than the capacity aren't inserted.
+  ///
+  /// Only the bytes referenced by the column chunk are accounted for, so it shouldn't
+  /// slice larger buffers, which would be retained in their entirety.
+  void Put(Key key, std::shared_ptr<ChunkedArray> column_chunk);
+
+  /// \brief Evict least recently used column chunks until at least `bytes` are freed
+  /// (or the cache is empty). Returns the number of bytes freed.
+  ///
+  /// This may be used to shed memory under external pressure.
+  int64_t Evict(int64_t bytes);
+
+  /// \brief Evict all column chunks.
+  void Clear();
+
+  int64_t capacity() const { return capacity_; }
+
+  MemoryPool* pool() { return &pool_; }
+
+  Stats stats() const;
+
+ private:
+  ColumnChunkCache(int64_t capacity, MemoryPool* pool);
+
+  struct Entry {
+    Key key;
+    std::shared_ptr<ChunkedArray> column_chunk;
+    int64_t size;
+  };
+
+  // Must be called with mutex_ locked
+  void EvictUnlocked(int64_t bytes);
+
+  const int64_t capacity_;
+  ProxyMemoryPool pool_;
+
+  mutable std::mutex mutex_;
+  // Least recently used first
+  std::list<Entry> entries_;
+  std::unordered_map<Key, std::list<Entry>::iterator, Key::Hash> index_;
+  Stats stats_;
+};
+
 /// \brief Base class for file format implementation
 class ARROW_DS_EXPORT FileFormat : public std::enable_shared_from_this<FileFormat> {
  public:
@@ -211,6 +330,9 @@ class ARROW_DS_EXPORT FileSystemDataset : public Dataset {
       std::vector<std::shared_ptr<FileFragment>> fragments);
 
   /// \brief Write a dataset.
+  ///
+  /// Fragments and scan tasks are consumed lazily and each batch is partitioned and
+  /// written as it is produced, so only a bounded number of batches is buffered.
   static Status Write(const FileSystemDatasetWriteOptions& write_options,
                       std::shared_ptr<Scanner> scanner);
 
@@ -235,14 +357,20 @@ class ARROW_DS_EXPORT FileSystemDataset : public Dataset {
  protected:
   Result<FragmentIterator> GetFragmentsImpl(Expression predicate) override;
 
+  class PartitionIndex;
+
   FileSystemDataset(std::shared_ptr<Schema> schema, Expression root_partition,
                     std::shared_ptr<FileFormat> format,
                     std::shared_ptr<fs::FileSystem> filesystem,
-                    std::vector<std::shared_ptr<FileFragment>> fragments);
+                    std::vector<std::shared_ptr<FileFragment>> fragments,
+                    std::shared_ptr<PartitionIndex> partition_index = NULLPTR);
 
   std::shared_ptr<FileFormat> format_;
   std::shared_ptr<fs::FileSystem> filesystem_;
   std::vector<std::shared_ptr<FileFragment>> fragments_;
+  // Built from fragments_ on construction, used to prune fragments in
+  // GetFragmentsImpl. May be null, in which case every fragment is visited.
+  std::shared_ptr<PartitionIndex> partition_index_;
 };
 
 class ARROW_DS_EXPORT FileWriteOptions {
@@ -298,6 +426,22 @@ struct ARROW_DS_EXPORT FileSystemDatasetWriteOptions {
   /// Maximum number of partitions any batch may be written into, default is 1K.
   int max_partitions = 1024;
 
+  /// Maximum number of files kept open at once. When this limit is reached, the least
+  /// recently written file is closed; rows subsequently written into its partition go
+  /// to a new file.
+  int max_open_files = 900;
+
+  /// Maximum number of rows written into a single file, or 0 for no limit. Once
+  /// reached, rows subsequently written into the partition go to a new file.
+  int64_t max_rows_per_file = 0;
+
+  /// Minimum number of rows passed at once to a FileWriter (i.e. the minimum size of
+  /// a Parquet row group or an IPC record batch), or 0 to write batches as they come.
+  /// Rows are buffered per partition until this many are available, and the
+  /// remaining rows are written when the dataset is finished. Smaller writes may
+  /// still happen at the end of a file if max_rows_per_file is set.
+  int64_t min_rows_per_group = 0;
+
   /// Template string used to generate fragment basenames.
   /// {i} will be replaced by an auto incremented integer.
   std::string basename_template;
@@ -0,0 +1,159 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "benchmark/benchmark.h"
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "arrow/dataset/discovery.h"
+#include "arrow/dataset/file_base.h"
+#include "arrow/dataset/file_ipc.h"
+#include "arrow/filesystem/filesystem.h"
+#include "arrow/filesystem/mockfs.h"
+#include "arrow/io/memory.h"
+#include "arrow/ipc/writer.h"
+#include "arrow/record_batch.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/type.h"
+#include "arrow/util/iterator.h"
+
+namespace arrow {
+namespace dataset {
+
+static std::shared_ptr<Schema> PartitionSchema() {
+  return schema({field("year", int32()), field("month", int32()), field("id", int64())});
+}
+
+// Make a dataset of num_fragments fragments, partitioned as "year=*/month=*/id=*"
+// would be by HivePartitioning.
+static std::shared_ptr<FileSystemDataset> MakePartitionedDataset(int64_t num_fragments) {
+  auto format = std::make_shared<IpcFileFormat>();
+  auto filesystem = std::make_shared<fs::internal::MockFileSystem>(fs::kNoTime);
+  auto partition_schema = PartitionSchema();
+
+  std::vector<std::shared_ptr<FileFragment>> fragments;
+  for (int64_t i = 0; i < num_fragments; ++i) {
+    auto year = static_cast<int32_t>(2000 + i % 20);
+    auto month = static_cast<int32_t>(1 + (i / 20) % 12);
+    auto partition = and_({equal(field_ref("year"), literal(year)),
+                           equal(field_ref("month"), literal(month)),
+                           equal(field_ref("id"), literal(i))});
+    ABORT_NOT_OK(partition.Bind(*partition_schema).Value(&partition));
+
+    auto path = "year=" + std::to_string(year) + "/month=" + std::to_string(month) +
+                "/id=" + std::to_string(i) + "/data.arrow";
+    fragments.push_back(
+        format->MakeFragment(FileSource(path, filesystem), partition).ValueOrDie());
+  }
+
+  return FileSystemDataset::Make(partition_schema, literal(true), format, filesystem,
+                                 std::move(fragments))
+      .ValueOrDie();
+}
+
+static void GetFragments(benchmark::State& state,  // NOLINT non-const reference
+                         const Expression& unbound_filter) {
+  const int64_t num_fragments = state.range(0);
+  auto dataset = MakePartitionedDataset(num_fragments);
+  auto filter = unbound_filter.Bind(*dataset->schema()).ValueOrDie();
+
+  int64_t num_selected = 0;
+  for (auto _ : state) {
+    auto fragments = dataset->GetFragments(filter).ValueOrDie().ToVector().ValueOrDie();
+    num_selected = static_cast<int64_t>(fragments.size());
+  }
+
+  state.counters["selected"] = static_cast<double>(num_selected);
+  state.SetItemsProcessed(state.iterations() * num_fragments);
+}
+
+// A single fragment, found by hash lookup
+static void GetFragmentsEqualUnique(
+    benchmark::State& state) {  // NOLINT non-const reference
+  GetFragments(state, equal(field_ref("id"), literal(int64_t(7))));
+}
+
+// Ranges are decided once per distinct value of each field
+static void GetFragmentsRange(benchmark::State& state) {  // NOLINT non-const reference
+  GetFragments(state, and_(greater_equal(field_ref("year"), literal(2018)),
+                           less(field_ref("month"), literal(3))));
+}
+
+// Predicates combining fields can't use the index; every fragment is visited
+static void GetFragmentsUnindexed(
+    benchmark::State& state) {  // NOLINT non-const reference
+  GetFragments(state, equal(field_ref("year"), field_ref("month")));
+}
+
+// Discover (list, inspect and finish) a dataset of IPC files on a filesystem with
+// injected latency.
+static void DiscoverWithLatency(benchmark::State& state) {  // NOLINT non-const reference
+  constexpr int kNumFiles = 200;
+  constexpr double kAverageLatency = 0.002;
+  const auto concurrency = static_cast<int>(state.range(0));
+
+  auto file_schema = schema({field("f64", float64())});
+  auto sink = io::BufferOutputStream::Create().ValueOrDie();
+  auto writer = ipc::MakeFileWriter(sink, file_schema).ValueOrDie();
+  ABORT_NOT_OK(writer->Close());
+  auto contents = sink->Finish().ValueOrDie()->ToString();
+
+  auto mock_fs = std::make_shared<fs::internal::MockFileSystem>(fs::kNoTime);
+  for (int i = 0; i < kNumFiles; ++i) {
+    ABORT_NOT_OK(mock_fs->CreateFile("dataset/" + std::to_string(i) + ".arrow",
+                                     contents, /*recursive=*/true));
+  }
+  auto slow_fs = std::make_shared<fs::SlowFileSystem>(mock_fs, kAverageLatency,
+                                                      /*seed=*/42);
+
+  fs::FileSelector selector;
+  selector.base_dir = "dataset";
+  FileSystemFactoryOptions options;
+  options.exclude_invalid_files = true;
+  options.inspect_concurrency = concurrency;
+  FinishOptions finish_options;
+  finish_options.inspect_options.fragments = InspectOptions::kInspectAllFragments;
+
+  DiscoveryTimings timings;
+  for (auto _ : state) {
+    auto factory =
+        FileSystemDatasetFactory::Make(slow_fs, selector,
+                                       std::make_shared<IpcFileFormat>(), options)
+            .ValueOrDie();
+    ABORT_NOT_OK(factory->Finish(finish_options).status());
+    timings = factory->timings();
+  }
+
+  state.counters["list_files"] = timings.list_files;
+  state.counters["check_files"] = timings.check_files;
+  state.counters["inspect_fragments"] = timings.inspect_fragments;
+  state.counters["make_fragments"] = timings.make_fragments;
+  state.SetItemsProcessed(state.iterations() * kNumFiles);
+}
+
+// NB: a dataset of 10^7 fragments takes tens of GB to construct
+BENCHMARK(GetFragmentsEqualUnique)->RangeMultiplier(10)->Range(10000, 10000000);
+BENCHMARK(GetFragmentsRange)->RangeMultiplier(10)->Range(10000, 10000000);
+BENCHMARK(GetFragmentsUnindexed)->RangeMultiplier(10)->Range(10000, 1000000);
+
+BENCHMARK(DiscoverWithLatency)->Arg(1)->Arg(2)->Arg(4)->Arg(8)->Arg(32)->UseRealTime();
+
+}  // namespace dataset
+}  // namespace arrow
@@ -19,12 +19,19 @@
 
 #include <algorithm>
 #include <memory>
+#include <numeric>
 #include <utility>
 #include <vector>
 
+#include "arrow/array/array_nested.h"
+#include "arrow/array/array_primitive.h"
+#include "arrow/array/util.h"
+#include "arrow/chunked_array.h"
 #include "arrow/dataset/dataset_internal.h"
 #include "arrow/dataset/file_base.h"
 #include "arrow/dataset/scanner.h"
+#include "arrow/filesystem/filesystem.h"
+#include "arrow/io/file.h"
 #include "arrow/ipc/reader.h"
 #include "arrow/ipc/writer.h"
 #include "arrow/util/checked_cast.h"
@@ -32,6 +39,7 @@
 
 namespace arrow {
 
+using internal::checked_cast;
 using internal::checked_pointer_cast;
 
 namespace dataset {
@@ -42,10 +50,49 @@ static inline ipc::IpcReadOptions default_read_options() {
   return options;
 }
 
+// IPC files are decoded identically whatever the options of the IpcFileFormat
+static inline util::optional<ColumnChunkCache::Key> MakeCacheKey(const FileSource& source,
+                                                                 int batch, int column) {
+  return ColumnChunkCache::MakeKey(source, "ipc", batch, column);
+}
+
+// Copy the buffers of a column which slice a larger buffer into `pool`. The columns of
+// an uncompressed record batch slice its body, which also holds the columns which
+// weren't projected: caching them as is would retain the whole body, beyond the
+// budget of the cache. Decompressed buffers are already allocated on their own.
+static Result<std::shared_ptr<ArrayData>> CopySlicedBuffers(const ArrayData& data,
+                                                            MemoryPool* pool) {
+  auto out = data.Copy();
+  for (auto& buffer : out->buffers) {
+    if (buffer != nullptr && buffer->parent() != nullptr) {
+      ARROW_ASSIGN_OR_RAISE(buffer, buffer->CopySlice(0, buffer->size(), pool));
+    }
+  }
+  for (auto& child : out->child_data) {
+    ARROW_ASSIGN_OR_RAISE(child, CopySlicedBuffers(*child, pool));
+  }
+  if (out->dictionary != nullptr) {
+    ARROW_ASSIGN_OR_RAISE(out->dictionary, CopySlicedBuffers(*out->dictionary, pool));
+  }
+  return out;
+}
+
+static inline Result<std::shared_ptr<io::RandomAccessFile>> OpenInput(
+    const FileSource& source, bool use_memory_map) {
+  const auto& filesystem = source.filesystem();
+  if (use_memory_map && filesystem != nullptr && filesystem->type_name() == "local") {
+    ARROW_ASSIGN_OR_RAISE(auto file,
+                          io::MemoryMappedFile::Open(source.path(), io::FileMode::READ));
+    return file;
+  }
+  return source.Open();
+}
+
 static inline Result<std::shared_ptr<ipc::RecordBatchFileReader>> OpenReader(
     const FileSource& source,
-    const ipc::IpcReadOptions& options = default_read_options()) {
-  ARROW_ASSIGN_OR_RAISE(auto input, source.Open());
+    const ipc::IpcReadOptions& options = default_read_options(),
+    bool use_memory_map = false) {
+  ARROW_ASSIGN_OR_RAISE(auto input, OpenInput(source, use_memory_map));
 
   std::shared_ptr<ipc::RecordBatchFileReader> reader;
 
@@ -72,55 +119,214 @@ static inline Result<std::vector<int>> GetIncludedFields(
   return included_fields;
 }
 
+/// \brief Express the statistics of one record batch as a guarantee
+///
+/// Only the fields of the file referenced in `fields` are considered.  As in
+/// the Parquet format, failure to interpret statistics merely results in a
+/// weaker guarantee.
+static Expression BatchStatisticsAsExpression(const RecordBatch& statistics, int batch,
+                                              const Schema& schema,
+                                              const std::vector<int>& fields) {
+  auto guarantee = literal(true);
+  auto num_rows = checked_pointer_cast<Int64Array>(
+      statistics.column(statistics.num_columns() - 1));
+
+  for (int i : fields) {
+    const auto& field = schema.field(i);
+    auto column = checked_pointer_cast<StructArray>(statistics.column(i));
+    auto field_expr = field_ref(field->name());
+
+    auto null_count = column->GetFieldByName("null_count");
+    if (null_count != nullptr &&
+        checked_cast<const Int64Array&>(*null_count).Value(batch) ==
+            num_rows->Value(batch)) {
+      FoldingAnd(&guarantee,
+                 equal(std::move(field_expr), literal(MakeNullScalar(field->type()))));
+      continue;
+    }
+
+    auto min = column->GetFieldByName("min");
+    auto max = column->GetFieldByName("max");
+    if (min == nullptr || max == nullptr || min->IsNull(batch) || max->IsNull(batch)) {
+      continue;
+    }
+    auto maybe_min = min->GetScalar(batch);
+    auto maybe_max = max->GetScalar(batch);
+    if (maybe_min.ok() && maybe_max.ok()) {
+      FoldingAnd(&guarantee,
+                 and_(greater_equal(field_expr, literal(maybe_min.MoveValueUnsafe())),
+                      less_equal(field_expr, literal(maybe_max.MoveValueUnsafe()))));
+    }
+  }
+  return guarantee;
+}
+
+/// \brief Select the record batches of an Ipc file which may satisfy a predicate
+///
+/// All batches are selected unless the file was written with
+/// IpcWriteOptions::write_batch_statistics.
+static Result<std::vector<int>> FilterBatches(const ipc::RecordBatchFileReader& reader,
+                                              const Expression& predicate) {
+  std::vector<int> batches(reader.num_record_batches());
+  std::iota(batches.begin(), batches.end(), 0);
+  if (predicate == literal(true)) {
+    return batches;
+  }
+
+  auto maybe_statistics = ipc::ReadBatchStatistics(reader);
+  if (!maybe_statistics.ok() || *maybe_statistics == nullptr) {
+    return batches;
+  }
+  const auto& statistics = **maybe_statistics;
+  const auto& schema = *reader.schema();
+
+  std::vector<int> fields;
+  for (const FieldRef& ref : FieldsInExpression(predicate)) {
+    ARROW_ASSIGN_OR_RAISE(auto match, ref.FindOneOrNone(schema));
+    if (match.empty()) continue;
+    fields.push_back(match[0]);
+  }
+
+  batches.clear();
+  for (int i = 0; i < reader.num_record_batches(); ++i) {
+    auto guarantee = BatchStatisticsAsExpression(statistics, i, schema, fields);
+    ARROW_ASSIGN_OR_RAISE(guarantee, guarantee.Bind(schema));
+    ARROW_ASSIGN_OR_RAISE(auto batch_predicate,
+                          SimplifyWithGuarantee(predicate, guarantee));
+    if (batch_predicate.IsSatisfiable()) {
+      batches.push_back(i);
+    }
+  }
+  return batches;
+}
+
 /// \brief A ScanTask backed by an Ipc file.
 class IpcScanTask : public ScanTask {
  public:
-  IpcScanTask(FileSource source, std::shared_ptr<ScanOptions> options,
-              std::shared_ptr<ScanContext> context)
-      : ScanTask(std::move(options), std::move(context)), source_(std::move(source)) {}
+  IpcScanTask(FileSource source, Expression predicate, bool use_memory_map,
+              std::shared_ptr<ScanOptions> options, std::shared_ptr<ScanContext> context)
+      : ScanTask(std::move(options), std::move(context)),
+        source_(std::move(source)),
+        predicate_(std::move(predicate)),
+        use_memory_map_(use_memory_map) {}
 
   Result<RecordBatchIterator> Execute() override {
     struct Impl {
       static Result<RecordBatchIterator> Make(
-          const FileSource& source, std::vector<std::string> materialized_fields,
-          MemoryPool* pool) {
-        ARROW_ASSIGN_OR_RAISE(auto reader, OpenReader(source));
+          const FileSource& source, const Expression& predicate, bool use_memory_map,
+          std::vector<std::string> materialized_fields, MemoryPool* pool,
+          std::shared_ptr<ColumnChunkCache> cache) {
+        ARROW_ASSIGN_OR_RAISE(auto reader,
+                              OpenReader(source, default_read_options(), use_memory_map));
+
+        // Memory mapped batches are zero-copy; there's nothing to gain by caching them.
+        if (use_memory_map || !MakeCacheKey(source, 0, 0).has_value()) {
+          cache = nullptr;
+        }
 
         auto options = default_read_options();
-        options.memory_pool = pool;
+        options.memory_pool = cache ? cache->pool() : pool;
         ARROW_ASSIGN_OR_RAISE(options.included_fields,
                               GetIncludedFields(*reader->schema(), materialized_fields));
-
-        ARROW_ASSIGN_OR_RAISE(reader, OpenReader(source, options));
-        return RecordBatchIterator(Impl{std::move(reader), 0});
+        ARROW_ASSIGN_OR_RAISE(auto batches, FilterBatches(*reader, predicate));
+
+        // The indices in the file's schema of the columns which will be read, in the
+        // order in which they appear in the reader's projected schema
+        std::vector<int> columns = options.included_fields;
+        if (columns.empty()) {
+          columns.resize(reader->schema()->num_fields());
+          std::iota(columns.begin(), columns.end(), 0);
+        }
+        std::sort(columns.begin(), columns.end());
+        columns.erase(std::unique(columns.begin(), columns.end()), columns.end());
+        if (columns.empty()) cache = nullptr;
+
+        ARROW_ASSIGN_OR_RAISE(reader, OpenReader(source, options, use_memory_map));
+        Impl impl{std::move(reader), std::move(batches), 0,
+                  std::move(cache),  source,             std::move(columns)};
+        impl.Prefetch(0);
+        return RecordBatchIterator(std::move(impl));
       }
 
       Result<std::shared_ptr<RecordBatch>> Next() {
-        if (i_ == reader_->num_record_batches()) {
+        if (i_ == batches_.size()) {
           return nullptr;
         }
 
-        return reader_->ReadRecordBatch(i_++);
+        // Prefetch one batch ahead of the consumer
+        Prefetch(i_ + 1);
+
+        int batch = batches_[i_++];
+        if (cache_ == nullptr) {
+          return reader_->ReadRecordBatch(batch);
+        }
+
+        if (auto cached = GetCached(batch)) {
+          return cached;
+        }
+
+        ARROW_ASSIGN_OR_RAISE(auto record_batch, reader_->ReadRecordBatch(batch));
+        for (size_t i = 0; i < columns_.size(); ++i) {
+          ARROW_ASSIGN_OR_RAISE(
+              auto column_data,
+              CopySlicedBuffers(*record_batch->column_data(static_cast<int>(i)),
+                                cache_->pool()));
+          cache_->Put(*MakeCacheKey(source_, batch, columns_[i]),
+                      std::make_shared<ChunkedArray>(MakeArray(column_data)));
+        }
+        return record_batch;
+      }
+
+      // Assemble a batch from cached column chunks, or return null if any are missing.
+      std::shared_ptr<RecordBatch> GetCached(int batch) {
+        ArrayVector arrays(columns_.size());
+        for (size_t i = 0; i < columns_.size(); ++i) {
+          auto column_chunk =
+              cache_->Get(*MakeCacheKey(source_, batch, columns_[i]));
+          if (column_chunk == nullptr || column_chunk->num_chunks() != 1) {
+            return nullptr;
+          }
+          arrays[i] = column_chunk->chunk(0);
+        }
+        auto num_rows = arrays[0]->length();
+        return RecordBatch::Make(reader_->schema(), num_rows, std::move(arrays));
+      }
+
+      void Prefetch(size_t i) {
+        if (i >= batches_.size()) return;
+        // Prefetching is advisory; ReadRecordBatch() reports any actual error
+        ARROW_UNUSED(reader_->WillNeedRecordBatch(batches_[i]));
       }
 
       std::shared_ptr<ipc::RecordBatchFileReader> reader_;
-      int i_;
+      std::vector<int> batches_;
+      size_t i_;
+
+      std::shared_ptr<ColumnChunkCache> cache_;
+      FileSource source_;
+      std::vector<int> columns_;
     };
 
-    return Impl::Make(source_, options_->MaterializedFields(), context_->pool);
+    return Impl::Make(source_, predicate_, use_memory_map_,
+                      options_->MaterializedFields(), context_->pool,
+                      context_->column_cache);
   }
 
  private:
   FileSource source_;
+  Expression predicate_;
+  bool use_memory_map_;
 };
 
 class IpcScanTaskIterator {
  public:
   static Result<ScanTaskIterator> Make(std::shared_ptr<ScanOptions> options,
                                        std::shared_ptr<ScanContext> context,
-                                       FileSource source) {
-    return ScanTaskIterator(
-        IpcScanTaskIterator(std::move(options), std::move(context), std::move(source)));
+                                       FileSource source, Expression predicate,
+                                       bool use_memory_map) {
+    return ScanTaskIterator(IpcScanTaskIterator(std::move(options), std::move(context),
+                                                std::move(source), std::move(predicate),
+                                                use_memory_map));
   }
 
   Result<std::shared_ptr<ScanTask>> Next() {
@@ -130,22 +336,34 @@ class IpcScanTaskIterator {
     }
 
     once_ = true;
-    return std::shared_ptr<ScanTask>(new IpcScanTask(source_, options_, context_));
+    return std::shared_ptr<ScanTask>(
+        new IpcScanTask(source_, predicate_, use_memory_map_, options_, context_));
   }
 
  private:
   IpcScanTaskIterator(std::shared_ptr<ScanOptions> options,
-                      std::shared_ptr<ScanContext> context, FileSource source)
+                      std::shared_ptr<ScanContext> context, FileSource source,
+                      Expression predicate, bool use_memory_map)
       : options_(std::move(options)),
         context_(std::move(context)),
-        source_(std::move(source)) {}
+        source_(std::move(source)),
+        predicate_(std::move(predicate)),
+        use_memory_map_(use_memory_map) {}
 
   bool once_ = false;
   std::shared_ptr<ScanOptions> options_;
   std::shared_ptr<ScanContext> context_;
   FileSource source_;
+  Expression predicate_;
+  bool use_memory_map_;
 };
 
+bool IpcFileFormat::Equals(const FileFormat& other) const {
+  if (other.type_name() != type_name()) return false;
+
+  return use_memory_map == checked_cast<const IpcFileFormat&>(other).use_memory_map;
+}
+
 Result<bool> IpcFileFormat::IsSupported(const FileSource& source) const {
   RETURN_NOT_OK(source.Open().status());
   return OpenReader(source).ok();
@@ -159,8 +377,16 @@ Result<std::shared_ptr<Schema>> IpcFileFormat::Inspect(const FileSource& source)
 Result<ScanTaskIterator> IpcFileFormat::ScanFile(std::shared_ptr<ScanOptions> options,
                                                  std::shared_ptr<ScanContext> context,
                                                  FileFragment* fragment) const {
+  // Batch statistics can only be used with a bound filter
+  auto predicate = literal(true);
+  if (options->filter.IsBound()) {
+    ARROW_ASSIGN_OR_RAISE(predicate, SimplifyWithGuarantee(
+                                         options->filter,
+                                         fragment->partition_expression()));
+  }
   return IpcScanTaskIterator::Make(std::move(options), std::move(context),
-                                   fragment->source());
+                                   fragment->source(), std::move(predicate),
+                                   use_memory_map);
 }
 
 //
@@ -41,9 +41,7 @@ class ARROW_DS_EXPORT IpcFileFormat : public FileFormat {
  public:
   std::string type_name() const override { return "ipc"; }
 
-  bool Equals(const FileFormat& other) const override {
-    return type_name() == other.type_name();
-  }
+  bool Equals(const FileFormat& other) const override;
 
   bool splittable() const override { return true; }
 
@@ -62,6 +60,14 @@ class ARROW_DS_EXPORT IpcFileFormat : public FileFormat {
       std::shared_ptr<FileWriteOptions> options) const override;
 
   std::shared_ptr<FileWriteOptions> DefaultWriteOptions() override;
+
+  /// \brief Memory-map fragments which reside on a LocalFileSystem
+  ///
+  /// Record batches are then read without copying, and the buffers of the
+  /// projected columns of the next batch are prefetched (see
+  /// ipc::RecordBatchFileReader::WillNeedRecordBatch) while the current one
+  /// is being consumed.
+  bool use_memory_map = false;
 };
 
 class ARROW_DS_EXPORT IpcFileWriteOptions : public FileWriteOptions {
@@ -17,15 +17,20 @@
 
 #include "arrow/dataset/file_ipc.h"
 
+#include <map>
 #include <memory>
+#include <numeric>
 #include <utility>
 #include <vector>
 
+#include "arrow/array/builder_primitive.h"
 #include "arrow/dataset/dataset_internal.h"
 #include "arrow/dataset/discovery.h"
 #include "arrow/dataset/file_base.h"
 #include "arrow/dataset/partition.h"
+#include "arrow/dataset/scanner.h"
 #include "arrow/dataset/test_util.h"
+#include "arrow/filesystem/localfs.h"
 #include "arrow/io/memory.h"
 #include "arrow/ipc/reader.h"
 #include "arrow/ipc/writer.h"
@@ -33,6 +38,7 @@
 #include "arrow/table.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/util.h"
+#include "arrow/util/io_util.h"
 #include "arrow/util/key_value_metadata.h"
 
 namespace arrow {
@@ -43,6 +49,7 @@ constexpr int64_t kBatchRepetitions = 1 << 5;
 constexpr int64_t kNumRows = kBatchSize * kBatchRepetitions;
 
 using internal::checked_pointer_cast;
+using internal::TemporaryDir;
 
 class ArrowIpcWriterMixin : public ::testing::Test {
  public:
@@ -235,6 +242,134 @@ TEST_F(TestIpcFileSystemDataset, WriteExceedsMaxPartitions) {
                                   FileSystemDataset::Write(write_options_, scanner));
 }
 
+class TestIpcDatasetWriter : public ::testing::Test {
+ public:
+  void SetUp() override {
+    fs_ = std::make_shared<fs::internal::MockFileSystem>(fs::kNoTime);
+    write_options_.file_write_options = format_->DefaultWriteOptions();
+    write_options_.filesystem = fs_;
+    write_options_.base_dir = "root";
+    write_options_.basename_template = "dat_{i}";
+    write_options_.partitioning =
+        std::make_shared<DirectoryPartitioning>(schema({field("part", int32())}));
+  }
+
+  // Write num_batches batches of batch_size rows, distributed round robin into
+  // num_partitions partitions.
+  Status DoWrite(int num_batches, int batch_size, int num_partitions) {
+    RecordBatchVector batches;
+    int64_t row = 0;
+    for (int i = 0; i < num_batches; ++i) {
+      Int32Builder part_builder;
+      Int64Builder row_builder;
+      for (int j = 0; j < batch_size; ++j, ++row) {
+        RETURN_NOT_OK(part_builder.Append(static_cast<int32_t>(row % num_partitions)));
+        RETURN_NOT_OK(row_builder.Append(row));
+      }
+      ARROW_ASSIGN_OR_RAISE(auto part, part_builder.Finish());
+      ARROW_ASSIGN_OR_RAISE(auto rows, row_builder.Finish());
+      batches.push_back(RecordBatch::Make(schema_, batch_size, {part, rows}));
+    }
+
+    auto dataset = std::make_shared<InMemoryDataset>(schema_, batches);
+    ScannerBuilder builder(dataset, ctx_);
+    ARROW_ASSIGN_OR_RAISE(auto scanner, builder.Finish());
+    return FileSystemDataset::Write(write_options_, std::move(scanner));
+  }
+
+  // Return the lengths of the batches in each written file.
+  std::map<std::string, std::vector<int64_t>> WrittenBatchLengths() {
+    std::map<std::string, std::vector<int64_t>> out;
+    fs::FileSelector selector;
+    selector.base_dir = "root";
+    selector.recursive = true;
+    EXPECT_OK_AND_ASSIGN(auto infos, fs_->GetFileInfo(selector));
+    for (const auto& info : infos) {
+      if (!info.IsFile()) continue;
+      EXPECT_OK_AND_ASSIGN(auto file, fs_->OpenInputFile(info.path()));
+      EXPECT_OK_AND_ASSIGN(auto reader, ipc::RecordBatchFileReader::Open(file));
+      auto& lengths = out[info.path()];
+      for (int i = 0; i < reader->num_record_batches(); ++i) {
+        EXPECT_OK_AND_ASSIGN(auto batch, reader->ReadRecordBatch(i));
+        lengths.push_back(batch->num_rows());
+      }
+    }
+    return out;
+  }
+
+ protected:
+  std::shared_ptr<fs::FileSystem> fs_;
+  std::shared_ptr<IpcFileFormat> format_ = std::make_shared<IpcFileFormat>();
+  std::shared_ptr<ScanContext> ctx_ = std::make_shared<ScanContext>();
+  std::shared_ptr<Schema> schema_ =
+      schema({field("part", int32()), field("row", int64())});
+  FileSystemDatasetWriteOptions write_options_;
+};
+
+TEST_F(TestIpcDatasetWriter, MaxRowsPerFile) {
+  write_options_.max_rows_per_file = 20;
+  ASSERT_OK(DoWrite(/*num_batches=*/10, /*batch_size=*/10, /*num_partitions=*/2));
+
+  // each partition receives 50 rows: written as 20 + 20 + 10
+  std::map<std::string, int64_t> file_rows;
+  for (const auto& path_lengths : WrittenBatchLengths()) {
+    const auto& lengths = path_lengths.second;
+    file_rows[path_lengths.first] = std::accumulate(lengths.begin(), lengths.end(), 0);
+  }
+  std::map<std::string, int64_t> expected = {
+      {"root/0/dat_0", 20}, {"root/1/dat_1", 20}, {"root/0/dat_2", 20},
+      {"root/1/dat_3", 20}, {"root/0/dat_4", 10}, {"root/1/dat_5", 10},
+  };
+  EXPECT_EQ(file_rows, expected);
+}
+
+TEST_F(TestIpcDatasetWriter, MinRowsPerGroup) {
+  write_options_.min_rows_per_group = 12;
+  ASSERT_OK(DoWrite(/*num_batches=*/10, /*batch_size=*/10, /*num_partitions=*/2));
+
+  // each partition receives 10 batches of 5 rows, buffered up to 15 rows
+  std::map<std::string, std::vector<int64_t>> expected = {
+      {"root/0/dat_0", {15, 15, 15, 5}},
+      {"root/1/dat_1", {15, 15, 15, 5}},
+  };
+  EXPECT_EQ(WrittenBatchLengths(), expected);
+}
+
+TEST_F(TestIpcDatasetWriter, MaxOpenFiles) {
+  for (bool use_threads : {false, true}) {
+    SCOPED_TRACE(use_threads ? "use_threads" : "serial");
+    SetUp();
+    ctx_->use_threads = use_threads;
+    write_options_.max_open_files = 2;
+    write_options_.max_rows_per_file = 7;
+    write_options_.min_rows_per_group = 3;
+    ASSERT_OK(DoWrite(/*num_batches=*/20, /*batch_size=*/9, /*num_partitions=*/3));
+
+    // with three partitions but only two open files, files are closed before
+    // max_rows_per_file is reached
+    int64_t num_rows = 0, num_short_files = 0;
+    for (const auto& path_lengths : WrittenBatchLengths()) {
+      const auto& lengths = path_lengths.second;
+      auto file_rows = std::accumulate(lengths.begin(), lengths.end(), int64_t(0));
+      ASSERT_LE(file_rows, write_options_.max_rows_per_file);
+      num_short_files += file_rows < write_options_.max_rows_per_file;
+      num_rows += file_rows;
+    }
+    EXPECT_EQ(num_rows, 20 * 9);
+    EXPECT_GT(num_short_files, 3);
+  }
+}
+
+TEST_F(TestIpcDatasetWriter, InvalidOptions) {
+  write_options_.max_open_files = 0;
+  ASSERT_RAISES(Invalid, DoWrite(1, 1, 1));
+
+  write_options_.max_open_files = 1;
+  write_options_.max_rows_per_file = 10;
+  write_options_.min_rows_per_group = 20;
+  ASSERT_RAISES(Invalid, DoWrite(1, 1, 1));
+}
+
 TEST_F(TestIpcFileFormat, OpenFailureWithRelevantError) {
   std::shared_ptr<Buffer> buf = std::make_shared<Buffer>(util::string_view(""));
   auto result = format_->Inspect(FileSource(buf));
@@ -325,6 +460,179 @@ TEST_F(TestIpcFileFormat, ScanRecordBatchReaderProjectedMissingCols) {
   }
 }
 
+TEST_F(TestIpcFileFormat, ScanWithBatchStatistics) {
+  schema_ = schema({field("i32", int32()), field("str", utf8())});
+  std::vector<std::shared_ptr<RecordBatch>> batches = {
+      RecordBatchFromJSON(schema_, R"([[0, "a"], [4, "b"]])"),
+      RecordBatchFromJSON(schema_, R"([[5, "c"], [9, "d"]])"),
+      RecordBatchFromJSON(schema_, R"([[null, "e"], [null, "f"]])")};
+
+  auto write_options = ipc::IpcWriteOptions::Defaults();
+  write_options.write_batch_statistics = true;
+  ASSERT_OK_AND_ASSIGN(auto sink, io::BufferOutputStream::Create());
+  ASSERT_OK_AND_ASSIGN(auto writer, ipc::MakeFileWriter(sink, schema_, write_options));
+  for (const auto& batch : batches) {
+    ASSERT_OK(writer->WriteRecordBatch(*batch));
+  }
+  ASSERT_OK(writer->Close());
+  ASSERT_OK_AND_ASSIGN(auto buffer, sink->Finish());
+  ASSERT_OK_AND_ASSIGN(auto fragment, format_->MakeFragment(FileSource(buffer)));
+
+  auto CountBatches = [&](Expression filter) {
+    opts_ = ScanOptions::Make(schema_);
+    EXPECT_OK_AND_ASSIGN(opts_->filter, filter.Bind(*schema_));
+    int num_batches = 0;
+    for (auto maybe_batch : Batches(fragment.get())) {
+      EXPECT_OK_AND_ASSIGN(auto batch, maybe_batch);
+      ++num_batches;
+    }
+    return num_batches;
+  };
+
+  EXPECT_EQ(CountBatches(literal(true)), 3);
+  EXPECT_EQ(CountBatches(greater(field_ref("i32"), literal(4))), 1);
+  EXPECT_EQ(CountBatches(less_equal(field_ref("i32"), literal(5))), 2);
+  EXPECT_EQ(CountBatches(greater(field_ref("i32"), literal(100))), 0);
+  EXPECT_EQ(CountBatches(call("is_null", {field_ref("i32")})), 3);
+  EXPECT_EQ(CountBatches(equal(field_ref("str"), literal("e"))), 1);
+  EXPECT_EQ(CountBatches(or_(equal(field_ref("str"), literal("a")),
+                             greater(field_ref("i32"), literal(6)))),
+            2);
+}
+
+TEST_F(TestIpcFileFormat, ScanWithMemoryMap) {
+  ASSERT_OK_AND_ASSIGN(auto temp_dir, TemporaryDir::Make("test-ipc-mmap-"));
+  auto fs = std::make_shared<fs::LocalFileSystem>();
+  const auto path = temp_dir->path().ToString() + "data.arrow";
+
+  // 4 batches of 1 MiB
+  auto reader = MakeGeneratedRecordBatch(schema_, 1 << 17, 4);
+  ASSERT_OK_AND_ASSIGN(auto sink, fs->OpenOutputStream(path));
+  ASSERT_OK(sink->Write(Write(reader.get())));
+  ASSERT_OK(sink->Close());
+  const int64_t data_size = 4 << 20;
+
+  opts_ = ScanOptions::Make(schema_);
+  FileSource source(path, fs);
+  for (bool use_memory_map : {false, true}) {
+    SCOPED_TRACE(use_memory_map ? "use_memory_map" : "copying reads");
+    format_->use_memory_map = use_memory_map;
+    ASSERT_OK_AND_ASSIGN(auto fragment, format_->MakeFragment(source));
+
+    const int64_t bytes_allocated = default_memory_pool()->bytes_allocated();
+    RecordBatchVector batches;
+    for (auto maybe_batch : Batches(fragment.get())) {
+      ASSERT_OK_AND_ASSIGN(auto batch, maybe_batch);
+      batches.push_back(batch);
+    }
+    ASSERT_EQ(batches.size(), 4);
+    const int64_t batches_allocated =
+        default_memory_pool()->bytes_allocated() - bytes_allocated;
+    if (use_memory_map) {
+      // Record batches are read without copying
+      ASSERT_LT(batches_allocated, data_size / 4);
+    } else {
+      ASSERT_GE(batches_allocated, data_size);
+    }
+  }
+
+  auto other = std::make_shared<IpcFileFormat>();
+  ASSERT_FALSE(format_->Equals(*other));
+  other->use_memory_map = true;
+  ASSERT_TRUE(format_->Equals(*other));
+}
+
+TEST_F(TestIpcFileFormat, ScanWithColumnChunkCache) {
+  ASSERT_OK_AND_ASSIGN(auto temp_dir, TemporaryDir::Make("test-ipc-cache-"));
+  auto fs = std::make_shared<fs::LocalFileSystem>();
+  const auto path = temp_dir->path().ToString() + "data.arrow";
+
+  auto file_schema = schema({field("f64", float64()), field("i32", int32())});
+  auto reader = MakeGeneratedRecordBatch(file_schema, kBatchSize, 4);
+  ASSERT_OK_AND_ASSIGN(auto sink, fs->OpenOutputStream(path));
+  ASSERT_OK(sink->Write(Write(reader.get())));
+  ASSERT_OK(sink->Close());
+  ASSERT_OK_AND_ASSIGN(auto info, fs->GetFileInfo(path));
+
+  auto cache = ColumnChunkCache::Make(/*capacity=*/1 << 20);
+  ctx_->column_cache = cache;
+  opts_ = ScanOptions::Make(file_schema);
+  opts_->projector = RecordBatchProjector(schema({field("i32", int32())}));
+  ASSERT_OK_AND_ASSIGN(auto fragment, format_->MakeFragment({info, fs}));
+
+  auto scan = [&] {
+    RecordBatchVector batches;
+    for (auto maybe_batch : Batches(fragment.get())) {
+      EXPECT_OK_AND_ASSIGN(auto batch, maybe_batch);
+      batches.push_back(batch);
+    }
+    return batches;
+  };
+
+  auto uncached = scan();
+  ASSERT_EQ(uncached.size(), 4);
+  // only the projected column is decoded and cached
+  auto stats = cache->stats();
+  ASSERT_EQ(stats.hits, 0);
+  ASSERT_EQ(stats.misses, 4);
+  ASSERT_EQ(stats.num_entries, 4);
+  ASSERT_GE(stats.bytes, kBatchSize * 4 * sizeof(int32_t));
+
+  auto cached = scan();
+  ASSERT_EQ(cached.size(), 4);
+  for (size_t i = 0; i < cached.size(); ++i) {
+    AssertBatchesEqual(*uncached[i], *cached[i]);
+  }
+  stats = cache->stats();
+  ASSERT_EQ(stats.hits, 4);
+  ASSERT_EQ(stats.misses, 4);
+  ASSERT_DOUBLE_EQ(stats.hit_rate(), 0.5);
+
+  // a modified file is read again
+  info.set_mtime(info.mtime() + std::chrono::seconds(1));
+  ASSERT_OK_AND_ASSIGN(fragment, format_->MakeFragment({info, fs}));
+  ASSERT_EQ(scan().size(), 4);
+  ASSERT_EQ(cache->stats().misses, 8);
+}
+
+TEST_F(TestIpcFileFormat, ColumnChunkCacheRetainsOnlyProjectedColumns) {
+  ASSERT_OK_AND_ASSIGN(auto temp_dir, TemporaryDir::Make("test-ipc-cache-"));
+  auto fs = std::make_shared<fs::LocalFileSystem>();
+  const auto path = temp_dir->path().ToString() + "wide.arrow";
+
+  constexpr int kNumColumns = 16;
+  constexpr int kNumBatches = 4;
+  FieldVector fields;
+  for (int i = 0; i < kNumColumns; ++i) {
+    fields.push_back(field("i32_" + std::to_string(i), int32()));
+  }
+  auto file_schema = schema(fields);
+  auto reader = MakeGeneratedRecordBatch(file_schema, kBatchSize, kNumBatches);
+  ASSERT_OK_AND_ASSIGN(auto sink, fs->OpenOutputStream(path));
+  ASSERT_OK(sink->Write(Write(reader.get())));
+  ASSERT_OK(sink->Close());
+  ASSERT_OK_AND_ASSIGN(auto info, fs->GetFileInfo(path));
+
+  // Room for one column of every batch, but far less than the whole file
+  const int64_t column_size = kNumBatches * kBatchSize * sizeof(int32_t);
+  auto cache = ColumnChunkCache::Make(/*capacity=*/2 * column_size);
+  ctx_->column_cache = cache;
+  opts_ = ScanOptions::Make(file_schema);
+  opts_->projector = RecordBatchProjector(schema({fields[0]}));
+  ASSERT_OK_AND_ASSIGN(auto fragment, format_->MakeFragment({info, fs}));
+
+  const int64_t bytes_before = default_memory_pool()->bytes_allocated();
+  for (auto maybe_batch : Batches(fragment.get())) {
+    ASSERT_OK(maybe_batch.status());
+  }
+  ASSERT_EQ(cache->stats().num_entries, kNumBatches);
+  ASSERT_GE(cache->stats().bytes, column_size);
+
+  // The record batch bodies, holding the other columns, aren't retained
+  ASSERT_LE(cache->pool()->bytes_allocated(), cache->capacity());
+  ASSERT_LE(default_memory_pool()->bytes_allocated() - bytes_before, cache->capacity());
+}
+
 TEST_F(TestIpcFileFormat, Inspect) {
   auto reader = GetRecordBatchReader();
   auto source = GetFileSource(reader.get());
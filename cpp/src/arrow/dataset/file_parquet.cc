@@ -17,7 +17,9 @@
 
 #include "arrow/dataset/file_parquet.h"
 
+#include <algorithm>
 #include <memory>
+#include <string>
 #include <unordered_map>
 #include <unordered_set>
 #include <utility>
@@ -27,6 +29,7 @@
 #include "arrow/dataset/scanner.h"
 #include "arrow/filesystem/path_util.h"
 #include "arrow/table.h"
+#include "arrow/type_traits.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/iterator.h"
 #include "arrow/util/logging.h"
@@ -52,16 +55,40 @@ using parquet::arrow::StatisticsAsScalars;
 /// \brief A ScanTask backed by a parquet file and a RowGroup within a parquet file.
 class ParquetScanTask : public ScanTask {
  public:
-  ParquetScanTask(int row_group, std::vector<int> column_projection,
+  ParquetScanTask(FileSource source, int row_group, std::vector<int> column_projection,
                   std::shared_ptr<parquet::arrow::FileReader> reader,
-                  std::shared_ptr<ScanOptions> options,
+                  std::string cache_format, std::shared_ptr<ScanOptions> options,
                   std::shared_ptr<ScanContext> context)
       : ScanTask(std::move(options), std::move(context)),
+        source_(std::move(source)),
         row_group_(row_group),
         column_projection_(std::move(column_projection)),
-        reader_(std::move(reader)) {}
+        reader_(std::move(reader)),
+        cache_format_(std::move(cache_format)) {}
 
   Result<RecordBatchIterator> Execute() override {
+    if (context_->column_cache != nullptr) {
+      ARROW_ASSIGN_OR_RAISE(auto table, ReadCached(context_->column_cache.get()));
+      if (table != nullptr) {
+        struct {
+          Result<std::shared_ptr<RecordBatch>> operator()() const {
+            std::shared_ptr<RecordBatch> batch;
+            RETURN_NOT_OK(table_batch_reader->ReadNext(&batch));
+            return batch;
+          }
+
+          // TableBatchReader refers to but does not own the Table
+          std::shared_ptr<Table> table;
+          std::unique_ptr<TableBatchReader> table_batch_reader;
+        } NextBatch;
+
+        NextBatch.table = std::move(table);
+        NextBatch.table_batch_reader.reset(new TableBatchReader(*NextBatch.table));
+        NextBatch.table_batch_reader->set_chunksize(options_->batch_size);
+        return MakeFunctionIterator(std::move(NextBatch));
+      }
+    }
+
     // The construction of parquet's RecordBatchReader is deferred here to
     // control the memory usage of consumers who materialize all ScanTasks
     // before dispatching them, e.g. for scheduling purposes.
@@ -86,11 +113,81 @@ class ParquetScanTask : public ScanTask {
   }
 
  private:
+  // Read the projected columns of this RowGroup, looking up each column chunk in the
+  // cache and reading only those which are missing. Column chunks are cached by leaf
+  // column index, so this is only supported if no nested column is projected; null
+  // is returned otherwise.
+  Result<std::shared_ptr<Table>> ReadCached(ColumnChunkCache* cache) const {
+    if (column_projection_.empty() || !MakeCacheKey(0).has_value()) {
+      return nullptr;
+    }
+
+    std::unordered_map<int, std::shared_ptr<Field>> top_level_leaves;
+    for (const auto& schema_field : reader_->manifest().schema_fields) {
+      if (schema_field.is_leaf()) {
+        top_level_leaves.emplace(schema_field.column_index, schema_field.field);
+      }
+    }
+
+    // column_projection_ is ordered as the manifest's fields, so the columns of a
+    // Table read from any subset of it are in the same order as that subset.
+    FieldVector fields;
+    for (int column_index : column_projection_) {
+      auto it = top_level_leaves.find(column_index);
+      if (it == top_level_leaves.end()) return nullptr;
+      fields.push_back(it->second);
+    }
+
+    ChunkedArrayVector columns(column_projection_.size());
+    std::vector<int> missing, missing_column_indices;
+    for (size_t i = 0; i < columns.size(); ++i) {
+      columns[i] = cache->Get(*MakeCacheKey(column_projection_[i]));
+      if (columns[i] == nullptr) {
+        missing.push_back(static_cast<int>(i));
+        missing_column_indices.push_back(column_projection_[i]);
+      }
+    }
+
+    if (!missing.empty()) {
+      std::shared_ptr<Table> read;
+      RETURN_NOT_OK(reader_->ReadRowGroup(row_group_, missing_column_indices, &read));
+
+      for (size_t j = 0; j < missing.size(); ++j) {
+        auto i = missing[j];
+        columns[i] = read->column(static_cast<int>(j));
+        cache->Put(*MakeCacheKey(column_projection_[i]), columns[i]);
+      }
+    }
+
+    return Table::Make(schema(std::move(fields)), std::move(columns));
+  }
+
+  util::optional<ColumnChunkCache::Key> MakeCacheKey(int column_index) const {
+    return ColumnChunkCache::MakeKey(source_, cache_format_, row_group_, column_index);
+  }
+
+  FileSource source_;
   int row_group_;
   std::vector<int> column_projection_;
   std::shared_ptr<parquet::arrow::FileReader> reader_;
+  std::string cache_format_;
 };
 
+// Identify the reader options which affect the decoded column chunks (NUL-separated),
+// so that they aren't shared through a ColumnChunkCache between differently
+// configured formats
+static std::string ColumnChunkCacheFormat(const ParquetFileFormat& format) {
+  std::vector<std::string> dict_columns(format.reader_options.dict_columns.begin(),
+                                        format.reader_options.dict_columns.end());
+  std::sort(dict_columns.begin(), dict_columns.end());
+  std::string cache_format = format.type_name();
+  for (const auto& name : dict_columns) {
+    cache_format += '\0';
+    cache_format += name;
+  }
+  return cache_format;
+}
+
 static parquet::ReaderProperties MakeReaderProperties(
     const ParquetFileFormat& format, MemoryPool* pool = default_memory_pool()) {
   parquet::ReaderProperties properties(pool);
@@ -255,6 +352,9 @@ Result<std::shared_ptr<Schema>> ParquetFileFormat::Inspect(
 Result<std::unique_ptr<parquet::arrow::FileReader>> ParquetFileFormat::GetReader(
     const FileSource& source, ScanOptions* options, ScanContext* context) const {
   MemoryPool* pool = context ? context->pool : default_memory_pool();
+  if (context && context->column_cache) {
+    pool = context->column_cache->pool();
+  }
   auto properties = MakeReaderProperties(*this, pool);
 
   ARROW_ASSIGN_OR_RAISE(auto input, source.Open());
@@ -277,6 +377,10 @@ Result<std::unique_ptr<parquet::arrow::FileReader>> ParquetFileFormat::GetReader
     arrow_properties.set_use_threads(reader_options.enable_parallel_column_conversion);
   }
 
+  if (context) {
+    arrow_properties.set_stop_token(context->stop_token);
+  }
+
   std::unique_ptr<parquet::arrow::FileReader> arrow_reader;
   RETURN_NOT_OK(parquet::arrow::FileReader::Make(
       pool, std::move(reader), std::move(arrow_properties), &arrow_reader));
@@ -318,10 +422,12 @@ Result<ScanTaskIterator> ParquetFileFormat::ScanFile(std::shared_ptr<ScanOptions
   }
 
   auto column_projection = InferColumnProjection(*reader, *options);
+  auto cache_format = ColumnChunkCacheFormat(*this);
   ScanTaskVector tasks(row_groups.size());
 
   for (size_t i = 0; i < row_groups.size(); ++i) {
-    tasks[i] = std::make_shared<ParquetScanTask>(row_groups[i], column_projection, reader,
+    tasks[i] = std::make_shared<ParquetScanTask>(fragment->source(), row_groups[i],
+                                                 column_projection, reader, cache_format,
                                                  options, context);
   }
 
@@ -489,15 +595,20 @@ Result<std::shared_ptr<Fragment>> ParquetFileFragment::Subset(
   return new_fragment;
 }
 
-inline void FoldingAnd(Expression* l, Expression r) {
-  if (*l == literal(true)) {
-    *l = std::move(r);
-  } else {
-    *l = and_(std::move(*l), std::move(r));
+Result<std::vector<int>> ParquetFileFragment::FilterRowGroups(Expression predicate) {
+  ARROW_ASSIGN_OR_RAISE(auto row_group_predicates, TestRowGroups(std::move(predicate)));
+
+  std::vector<int> row_groups;
+  for (size_t i = 0; i < row_group_predicates.size(); ++i) {
+    if (row_group_predicates[i].IsSatisfiable()) {
+      row_groups.push_back(row_groups_->at(i));
+    }
   }
+  return row_groups;
 }
 
-Result<std::vector<int>> ParquetFileFragment::FilterRowGroups(Expression predicate) {
+Result<std::vector<Expression>> ParquetFileFragment::TestRowGroups(
+    Expression predicate) {
   auto lock = physical_schema_mutex_.Lock();
 
   DCHECK_NE(metadata_, nullptr);
@@ -505,7 +616,7 @@ Result<std::vector<int>> ParquetFileFragment::FilterRowGroups(Expression predica
       predicate, SimplifyWithGuarantee(std::move(predicate), partition_expression_));
 
   if (!predicate.IsSatisfiable()) {
-    return std::vector<int>{};
+    return std::vector<Expression>(row_groups_->size(), literal(false));
   }
 
   for (const FieldRef& ref : FieldsInExpression(predicate)) {
@@ -531,16 +642,159 @@ Result<std::vector<int>> ParquetFileFragment::FilterRowGroups(Expression predica
     }
   }
 
-  std::vector<int> row_groups;
+  std::vector<Expression> row_group_predicates(row_groups_->size());
   for (size_t i = 0; i < row_groups_->size(); ++i) {
-    ARROW_ASSIGN_OR_RAISE(auto row_group_predicate,
+    ARROW_ASSIGN_OR_RAISE(row_group_predicates[i],
                           SimplifyWithGuarantee(predicate, statistics_expressions_[i]));
-    if (row_group_predicate.IsSatisfiable()) {
-      row_groups.push_back(row_groups_->at(i));
+  }
+  return row_group_predicates;
+}
+
+Result<bool> ParquetFileFragment::StatisticsAreExact(const Expression& predicate,
+                                                     int row_group) {
+  auto row_group_metadata = metadata_->RowGroup(row_group);
+  for (const FieldRef& ref : FieldsInExpression(predicate)) {
+    ARROW_ASSIGN_OR_RAISE(auto match, ref.FindOneOrNone(*physical_schema_));
+    if (match.empty()) return false;
+
+    const SchemaField& schema_field = manifest_->schema_fields[match[0]];
+    if (!schema_field.is_leaf()) return false;
+    if (is_floating(schema_field.field->type()->id())) return false;
+
+    auto statistics =
+        row_group_metadata->ColumnChunk(schema_field.column_index)->statistics();
+    if (statistics == nullptr || !statistics->HasNullCount() ||
+        statistics->null_count() != 0) {
+      return false;
+    }
+  }
+  return true;
+}
+
+Result<FragmentCount> ParquetFileFragment::CountRows(const Expression& predicate) {
+  ARROW_ASSIGN_OR_RAISE(auto simplified, SimplifyWithPartition(predicate, *this));
+  if (!simplified.IsSatisfiable() || !simplified.IsBound()) {
+    return Fragment::CountRows(simplified);
+  }
+
+  RETURN_NOT_OK(EnsureCompleteMetadata());
+  ARROW_ASSIGN_OR_RAISE(auto row_group_predicates, TestRowGroups(simplified));
+
+  FragmentCount count;
+  std::vector<int> undecided;
+  for (size_t i = 0; i < row_group_predicates.size(); ++i) {
+    const Expression& row_group_predicate = row_group_predicates[i];
+    if (!row_group_predicate.IsSatisfiable()) continue;
+
+    int row_group = row_groups_->at(i);
+    // Null and NaN values don't satisfy the predicate even if statistics bounds do
+    ARROW_ASSIGN_OR_RAISE(auto exact, StatisticsAreExact(simplified, row_group));
+    if (row_group_predicate == literal(true) && exact) {
+      count.num_rows += metadata_->RowGroup(row_group)->num_rows();
+    } else {
+      undecided.push_back(row_group);
     }
   }
 
-  return row_groups;
+  if (!undecided.empty()) {
+    ARROW_ASSIGN_OR_RAISE(count.remainder, Subset(std::move(undecided)));
+  }
+  return count;
+}
+
+// Append the min and max of a column chunk to `extrema`, returning false if they
+// can't be extracted from its statistics.
+static bool ColumnChunkExtrema(const SchemaField& schema_field,
+                               const parquet::RowGroupMetaData& metadata,
+                               ScalarVector* extrema) {
+  auto statistics = metadata.ColumnChunk(schema_field.column_index)->statistics();
+  if (statistics == nullptr) {
+    return false;
+  }
+
+  // All values are null
+  if (statistics->HasNullCount() && statistics->null_count() == metadata.num_rows()) {
+    return true;
+  }
+
+  std::shared_ptr<Scalar> min, max;
+  if (!statistics->HasMinMax() || !StatisticsAsScalars(*statistics, &min, &max).ok()) {
+    return false;
+  }
+
+  const auto& type = schema_field.field->type();
+  auto maybe_min = min->CastTo(type);
+  auto maybe_max = max->CastTo(type);
+  if (!maybe_min.ok() || !maybe_max.ok()) {
+    return false;
+  }
+
+  extrema->push_back(maybe_min.MoveValueUnsafe());
+  extrema->push_back(maybe_max.MoveValueUnsafe());
+  return true;
+}
+
+Result<FragmentMinMax> ParquetFileFragment::MinMax(const std::string& column,
+                                                   const Expression& predicate) {
+  ARROW_ASSIGN_OR_RAISE(auto simplified, SimplifyWithPartition(predicate, *this));
+  if (!simplified.IsSatisfiable() || !simplified.IsBound()) {
+    return Fragment::MinMax(column, simplified);
+  }
+
+  RETURN_NOT_OK(EnsureCompleteMetadata());
+
+  // The column is either read from the file, or constant if it is a partition key
+  // absent from the file
+  const SchemaField* schema_field = NULLPTR;
+  std::shared_ptr<Scalar> partition_value;
+  ARROW_ASSIGN_OR_RAISE(auto match, FieldRef(column).FindOneOrNone(*physical_schema_));
+  if (!match.empty()) {
+    schema_field = &manifest_->schema_fields[match[0]];
+    if (!schema_field->is_leaf()) {
+      return Fragment::MinMax(column, simplified);
+    }
+  } else {
+    ARROW_ASSIGN_OR_RAISE(auto known_values,
+                          ExtractKnownFieldValues(partition_expression_));
+    auto it = known_values.find(FieldRef(column));
+    if (it == known_values.end() || !it->second.is_scalar()) {
+      return Fragment::MinMax(column, simplified);
+    }
+    partition_value = it->second.scalar();
+  }
+
+  ARROW_ASSIGN_OR_RAISE(auto row_group_predicates, TestRowGroups(simplified));
+
+  FragmentMinMax min_max;
+  std::vector<int> undecided;
+  for (size_t i = 0; i < row_group_predicates.size(); ++i) {
+    const Expression& row_group_predicate = row_group_predicates[i];
+    if (!row_group_predicate.IsSatisfiable()) continue;
+
+    int row_group = row_groups_->at(i);
+    auto row_group_metadata = metadata_->RowGroup(row_group);
+    ARROW_ASSIGN_OR_RAISE(auto exact, StatisticsAreExact(simplified, row_group));
+    if (row_group_predicate != literal(true) || !exact) {
+      undecided.push_back(row_group);
+      continue;
+    }
+
+    if (row_group_metadata->num_rows() == 0) continue;
+
+    if (partition_value != nullptr) {
+      if (partition_value->is_valid) {
+        min_max.extrema.push_back(partition_value);
+      }
+    } else if (!ColumnChunkExtrema(*schema_field, *row_group_metadata,
+                                   &min_max.extrema)) {
+      undecided.push_back(row_group);
+    }
+  }
+
+  if (!undecided.empty()) {
+    ARROW_ASSIGN_OR_RAISE(min_max.remainder, Subset(std::move(undecided)));
+  }
+  return min_max;
 }
 
 //
@@ -169,6 +169,18 @@ class ARROW_DS_EXPORT ParquetFileFragment : public FileFragment {
   Result<std::shared_ptr<Fragment>> Subset(Expression predicate);
   Result<std::shared_ptr<Fragment>> Subset(std::vector<int> row_group_ids);
 
+  /// \brief Count rows using row counts and statistics from the FileMetaData.
+  ///
+  /// Row groups whose statistics don't decide the predicate form the remainder.
+  Result<FragmentCount> CountRows(const Expression& predicate) override;
+
+  /// \brief Find the extrema of a column using statistics from the FileMetaData.
+  ///
+  /// Row groups whose statistics don't decide the predicate or lack min/max
+  /// statistics for the column form the remainder.
+  Result<FragmentMinMax> MinMax(const std::string& column,
+                                const Expression& predicate) override;
+
  private:
   ParquetFileFragment(FileSource source, std::shared_ptr<FileFormat> format,
                       Expression partition_expression,
@@ -187,6 +199,14 @@ class ARROW_DS_EXPORT ParquetFileFragment : public FileFragment {
   // Return a filtered subset of row group indices.
   Result<std::vector<int>> FilterRowGroups(Expression predicate);
 
+  // Simplify a predicate against the statistics of each selected row group.
+  Result<std::vector<Expression>> TestRowGroups(Expression predicate);
+
+  // Return whether the statistics of a row group exactly describe the fields
+  // referenced by a predicate: none of them may be null, nor floating point
+  // since min/max statistics ignore NaNs.
+  Result<bool> StatisticsAreExact(const Expression& predicate, int row_group);
+
   ParquetFileFormat& parquet_format_;
 
   // Indices of row groups selected by this fragment,
@@ -496,6 +496,113 @@ TEST_F(TestParquetFileFormat, PredicatePushdownRowGroupFragments) {
                                 less(field_ref("i64"), literal(8))));
 }
 
+TEST_F(TestParquetFileFormat, CountRowsAndMinMaxFromMetadata) {
+  constexpr int64_t kNumRowGroups = 16;
+  constexpr int64_t kTotalNumRows = kNumRowGroups * (kNumRowGroups + 1) / 2;
+
+  // The i-th row group has i + 1 rows, all with i64 == i + 1
+  auto reader = ArithmeticDatasetFixture::GetRecordBatchReader(kNumRowGroups);
+  auto source = GetFileSource(reader.get());
+
+  opts_ = ScanOptions::Make(reader->schema());
+  schema_ = reader->schema();
+  ASSERT_OK_AND_ASSIGN(auto fragment, format_->MakeFragment(*source));
+
+  auto remainder_row_groups = [](const std::shared_ptr<Fragment>& remainder) {
+    if (remainder == nullptr) return std::vector<int>{};
+    return checked_pointer_cast<ParquetFileFragment>(remainder)->row_groups();
+  };
+
+  SetFilter(literal(true));
+  ASSERT_OK_AND_ASSIGN(auto count, fragment->CountRows(opts_->filter));
+  EXPECT_EQ(count.num_rows, kTotalNumRows);
+  EXPECT_EQ(count.remainder, nullptr);
+
+  SetFilter(greater_equal(field_ref("i64"), literal<int64_t>(6)));
+  ASSERT_OK_AND_ASSIGN(count, fragment->CountRows(opts_->filter));
+  EXPECT_EQ(count.num_rows, kTotalNumRows - 5 * (5 + 1) / 2);
+  EXPECT_EQ(count.remainder, nullptr);
+
+  // Statistics can't decide comparisons between columns
+  SetFilter(and_(less(field_ref("i64"), literal<int64_t>(3)),
+                 equal(field_ref("i64"), field_ref("u8"))));
+  ASSERT_OK_AND_ASSIGN(count, fragment->CountRows(opts_->filter));
+  EXPECT_EQ(count.num_rows, 0);
+  EXPECT_EQ(remainder_row_groups(count.remainder), std::vector<int>({0, 1}));
+
+  SetFilter(literal(true));
+  ASSERT_OK_AND_ASSIGN(auto min_max, fragment->MinMax("i64", opts_->filter));
+  EXPECT_EQ(min_max.extrema.size(), 2 * kNumRowGroups);
+  EXPECT_EQ(min_max.remainder, nullptr);
+
+  SetFilter(less(field_ref("i64"), literal<int64_t>(3)));
+  ASSERT_OK_AND_ASSIGN(min_max, fragment->MinMax("i64", opts_->filter));
+  EXPECT_EQ(min_max.extrema.size(), 2 * 2);
+  EXPECT_EQ(min_max.remainder, nullptr);
+
+  // Only leaf columns have statistics
+  ASSERT_OK_AND_ASSIGN(min_max, fragment->MinMax("list", opts_->filter));
+  EXPECT_TRUE(min_max.extrema.empty());
+  EXPECT_EQ(min_max.remainder, fragment);
+
+  // Through a Scanner, undecided row groups are scanned
+  struct {
+    Expression filter;
+    int64_t expected_rows;
+    int64_t expected_max;
+  } cases[] = {
+      {literal(true), kTotalNumRows, kNumRowGroups},
+      {less(field_ref("i64"), literal<int64_t>(3)), 1 + 2, 2},
+      {equal(field_ref("i64"), field_ref("u8")), kTotalNumRows, kNumRowGroups},
+  };
+  for (const auto& c : cases) {
+    SetFilter(c.filter);
+    Scanner scanner(fragment, opts_, ctx_);
+
+    ASSERT_OK_AND_ASSIGN(auto num_rows, scanner.CountRows());
+    EXPECT_EQ(num_rows, c.expected_rows);
+
+    ASSERT_OK_AND_ASSIGN(auto min_max, scanner.MinMax("i64"));
+    const auto& values = checked_cast<const StructScalar&>(*min_max).value;
+    AssertScalarsEqual(Int64Scalar(1), *values[0]);
+    AssertScalarsEqual(Int64Scalar(c.expected_max), *values[1]);
+  }
+}
+
+TEST_F(TestParquetFileFormat, CountRowsAndMinMaxWithNaNs) {
+  // Parquet statistics ignore NaNs, which don't satisfy comparisons
+  auto table = TableFromJSON(schema({field("f64", float64()), field("i64", int64())}),
+                             {
+                                 R"([{"f64": 1.0, "i64": 1}, {"f64": 2.0, "i64": 2}])",
+                                 R"([{"f64": 3.0, "i64": 3}, {"f64": NaN, "i64": 4}])",
+                             });
+  TableBatchReader reader(*table);
+  auto source = GetFileSource(&reader);
+
+  opts_ = ScanOptions::Make(reader.schema());
+  schema_ = reader.schema();
+  ASSERT_OK_AND_ASSIGN(auto fragment, format_->MakeFragment(*source));
+
+  SetFilter(greater(field_ref("f64"), literal(0.0)));
+  ASSERT_OK_AND_ASSIGN(auto count, fragment->CountRows(opts_->filter));
+  EXPECT_EQ(count.num_rows, 0);
+  ASSERT_NE(count.remainder, nullptr);
+  EXPECT_EQ(checked_pointer_cast<ParquetFileFragment>(count.remainder)->row_groups(),
+            std::vector<int>({0, 1}));
+
+  ASSERT_OK_AND_ASSIGN(auto min_max, fragment->MinMax("i64", opts_->filter));
+  EXPECT_TRUE(min_max.extrema.empty());
+  ASSERT_NE(min_max.remainder, nullptr);
+
+  Scanner scanner(fragment, opts_, ctx_);
+  ASSERT_OK_AND_ASSIGN(auto num_rows, scanner.CountRows());
+  EXPECT_EQ(num_rows, 3);
+  ASSERT_OK_AND_ASSIGN(auto scanned_min_max, scanner.MinMax("i64"));
+  const auto& values = checked_cast<const StructScalar&>(*scanned_min_max).value;
+  AssertScalarsEqual(Int64Scalar(1), *values[0]);
+  AssertScalarsEqual(Int64Scalar(3), *values[1]);
+}
+
 TEST_F(TestParquetFileFormat, PredicatePushdownRowGroupFragmentsUsingStringColumn) {
   auto table = TableFromJSON(schema({field("x", utf8())}),
                              {
@@ -29,6 +29,7 @@
 #include "arrow/filesystem/path_util.h"
 #include "arrow/filesystem/test_util.h"
 #include "arrow/status.h"
+#include "arrow/testing/generator.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/util/io_util.h"
 
@@ -80,6 +81,106 @@ TEST(FileSource, BufferBased) {
   ASSERT_EQ(source1.buffer(), source3.buffer());
 }
 
+TEST(ColumnChunkCache, MakeKey) {
+  auto localfs = std::make_shared<fs::LocalFileSystem>();
+
+  fs::FileInfo info("/path/to/file.ext", fs::FileType::File);
+  info.set_mtime(fs::TimePoint(std::chrono::seconds(42)));
+
+  auto make_key = [&](std::shared_ptr<fs::FileSystem> filesystem, std::string format) {
+    return ColumnChunkCache::MakeKey(FileSource(info, std::move(filesystem)),
+                                     std::move(format), 1, 2);
+  };
+
+  auto key = make_key(localfs, "format");
+  ASSERT_TRUE(key.has_value());
+  ASSERT_EQ(key->filesystem, localfs);
+  ASSERT_EQ(key->format, "format");
+  ASSERT_EQ(key->path, info.path());
+  ASSERT_EQ(key->mtime, int64_t(42) * 1000000000);
+  ASSERT_EQ(key->chunk, 1);
+  ASSERT_EQ(key->column, 2);
+
+  // an equal filesystem shares keys
+  auto other_key = make_key(std::make_shared<fs::LocalFileSystem>(), "format");
+  ASSERT_TRUE(*key == *other_key);
+  ColumnChunkCache::Key::Hash hash;
+  ASSERT_EQ(hash(*key), hash(*other_key));
+
+  // ... but not a different filesystem, nor a differently configured format
+  auto subtreefs = std::make_shared<fs::SubTreeFileSystem>("/other", localfs);
+  ASSERT_FALSE(*key == *make_key(subtreefs, "format"));
+  ASSERT_FALSE(*key == *make_key(localfs, "other"));
+
+  // a modified file doesn't share keys
+  info.set_mtime(fs::TimePoint(std::chrono::seconds(43)));
+  ASSERT_FALSE(*key == *make_key(localfs, "format"));
+
+  // files whose mtime is unknown aren't cached
+  info.set_mtime(fs::kNoTime);
+  ASSERT_FALSE(make_key(localfs, "format").has_value());
+
+  // buffers aren't cached
+  auto buf = std::make_shared<Buffer>("this is the file contents");
+  ASSERT_FALSE(ColumnChunkCache::MakeKey(FileSource(buf), "format", 1, 2).has_value());
+}
+
+TEST(ColumnChunkCache, EvictLeastRecentlyUsed) {
+  // each chunk is 10 int64s with no validity bitmap: 80 bytes
+  std::shared_ptr<Array> array;
+  ArrayFromVector<Int64Type, int64_t>({0, 1, 2, 3, 4, 5, 6, 7, 8, 9}, &array);
+  auto chunk = std::make_shared<ChunkedArray>(array);
+  auto cache = ColumnChunkCache::Make(/*capacity=*/250);
+
+  auto key = [](int chunk) {
+    return ColumnChunkCache::Key{nullptr, "format", "file", 0, chunk, 0};
+  };
+
+  cache->Put(key(0), chunk);
+  cache->Put(key(1), chunk);
+  cache->Put(key(2), chunk);
+  ASSERT_EQ(cache->stats().num_entries, 3);
+  ASSERT_EQ(cache->stats().bytes, 240);
+
+  // touch 0 so that 1 is least recently used
+  ASSERT_EQ(cache->Get(key(0)), chunk);
+  cache->Put(key(3), chunk);
+
+  ASSERT_EQ(cache->Get(key(1)), nullptr);
+  ASSERT_NE(cache->Get(key(0)), nullptr);
+  ASSERT_NE(cache->Get(key(2)), nullptr);
+  ASSERT_NE(cache->Get(key(3)), nullptr);
+
+  auto stats = cache->stats();
+  ASSERT_EQ(stats.hits, 4);
+  ASSERT_EQ(stats.misses, 1);
+  ASSERT_EQ(stats.evictions, 1);
+  ASSERT_EQ(stats.num_entries, 3);
+  ASSERT_EQ(stats.bytes, 240);
+  ASSERT_DOUBLE_EQ(stats.hit_rate(), 0.8);
+
+  // evicting under pressure frees whole entries, least recently used first
+  ASSERT_EQ(cache->Evict(100), 160);
+  ASSERT_EQ(cache->Get(key(0)), nullptr);
+  ASSERT_EQ(cache->Get(key(2)), nullptr);
+  ASSERT_NE(cache->Get(key(3)), nullptr);
+
+  cache->Clear();
+  ASSERT_EQ(cache->stats().num_entries, 0);
+  ASSERT_EQ(cache->stats().bytes, 0);
+  ASSERT_EQ(cache->Get(key(3)), nullptr);
+
+  // buffers shared by several chunks are counted once
+  ArrayVector sharing_buffers = {array, array->Slice(1)};
+  cache->Put(key(4), std::make_shared<ChunkedArray>(sharing_buffers));
+  ASSERT_EQ(cache->stats().bytes, 80);
+
+  // column chunks which exceed the capacity aren't cached
+  cache->Put(key(5), std::make_shared<ChunkedArray>(
+                         ConstantArrayGenerator::Zeroes(40, int64())));
+  ASSERT_EQ(cache->Get(key(5)), nullptr);
+}
+
 TEST_F(TestFileSystemDataset, Basic) {
   MakeDataset({});
   AssertFragmentsAreFromPath(*dataset_->GetFragments(), {});
@@ -205,6 +306,61 @@ TEST_F(TestFileSystemDataset, TreePartitionPruning) {
                              franklins);
 }
 
+TEST_F(TestFileSystemDataset, PartitionIndexPruning) {
+  std::vector<fs::FileInfo> files;
+  std::vector<Expression> partitions;
+  for (int year = 2018; year <= 2020; ++year) {
+    for (int month = 1; month <= 3; ++month) {
+      files.push_back(fs::File(std::to_string(year) + "/" + std::to_string(month)));
+      partitions.push_back(and_(equal(field_ref("year"), literal(year)),
+                                equal(field_ref("month"), literal(month))));
+    }
+  }
+  // fragments with no known value for a field can't be pruned by it
+  files.push_back(fs::File("2019/unknown"));
+  partitions.push_back(equal(field_ref("year"), literal(2019)));
+  files.push_back(fs::File("unknown"));
+  partitions.push_back(literal(true));
+
+  MakeDataset(files, literal(true), partitions,
+              schema({field("year", int32()), field("month", int32())}));
+
+  auto GetFragments = [&](Expression filter) {
+    return *dataset_->GetFragments(*filter.Bind(*dataset_->schema()));
+  };
+
+  AssertFragmentsAreFromPath(GetFragments(equal(field_ref("year"), literal(2019))),
+                             {"2019/1", "2019/2", "2019/3", "2019/unknown", "unknown"});
+
+  AssertFragmentsAreFromPath(GetFragments(equal(field_ref("year"), literal(2017))),
+                             {"unknown"});
+
+  AssertFragmentsAreFromPath(
+      GetFragments(and_(greater_equal(field_ref("year"), literal(2019)),
+                        equal(field_ref("month"), literal(2)))),
+      {"2019/2", "2020/2", "2019/unknown", "unknown"});
+
+  AssertFragmentsAreFromPath(
+      GetFragments(and_(not_equal(field_ref("year"), literal(2019)),
+                        less(field_ref("month"), literal(2)))),
+      {"2018/1", "2020/1", "unknown"});
+
+  // predicates combining fields are checked against each candidate
+  AssertFragmentsAreFromPath(
+      GetFragments(and_(less(field_ref("month"), literal(3)),
+                        or_(equal(field_ref("year"), literal(2018)),
+                            equal(field_ref("month"), literal(1))))),
+      {"2018/1", "2018/2", "2019/1", "2020/1", "2019/unknown", "unknown"});
+
+  // the index is shared by datasets with replaced schemas
+  ASSERT_OK_AND_ASSIGN(
+      auto replaced, dataset_->ReplaceSchema(schema({field("month", int32())})));
+  AssertFragmentsAreFromPath(
+      *replaced->GetFragments(
+          *equal(field_ref("month"), literal(3)).Bind(*replaced->schema())),
+      {"2018/3", "2019/3", "2020/3", "2019/unknown", "unknown"});
+}
+
 TEST_F(TestFileSystemDataset, FragmentPartitions) {
   auto root_partition = equal(field_ref("country"), literal("US"));
   std::vector<fs::FileInfo> regions = {
@@ -23,17 +23,52 @@
 #include <vector>
 
 #include "arrow/array.h"
+#include "arrow/compute/api_vector.h"
 #include "arrow/dataset/type_fwd.h"
 #include "arrow/record_batch.h"
 #include "arrow/result.h"
 #include "arrow/scalar.h"
 #include "arrow/status.h"
 #include "arrow/type.h"
+#include "arrow/util/checked_cast.h"
 #include "arrow/util/logging.h"
+#include "arrow/visitor_inline.h"
 
 namespace arrow {
+
+using internal::checked_cast;
+
 namespace dataset {
 
+namespace {
+
+// Whether `to` is the type yielded by dictionary encoding `from`
+bool IsDictionaryEncodingOf(const DataType& to, const DataType& from) {
+  if (to.id() != Type::DICTIONARY) return false;
+  const auto& dict_type = checked_cast<const DictionaryType&>(to);
+  return dict_type.index_type()->id() == Type::INT32 &&
+         dict_type.value_type()->Equals(from);
+}
+
+// Make a dictionary array of the given length whose dictionary contains only `value`
+// and whose indices are all zero.
+Result<std::shared_ptr<Array>> MakeDictionaryArrayFromValue(
+    const std::shared_ptr<DataType>& type, const Scalar& value, int64_t length,
+    MemoryPool* pool) {
+  if (!value.is_valid) {
+    return MakeArrayOfNull(type, length, pool);
+  }
+
+  const auto& index_type = checked_cast<const DictionaryType&>(*type).index_type();
+  ARROW_ASSIGN_OR_RAISE(auto zero, MakeScalar(index_type, 0));
+  ARROW_ASSIGN_OR_RAISE(auto indices, MakeArrayFromScalar(*zero, length, pool));
+  ARROW_ASSIGN_OR_RAISE(auto dictionary, MakeArrayFromScalar(value, 1, pool));
+  return std::make_shared<DictionaryArray>(type, std::move(indices),
+                                           std::move(dictionary));
+}
+
+}  // namespace
+
 Status CheckProjectable(const Schema& from, const Schema& to) {
   for (const auto& to_field : to.fields()) {
     ARROW_ASSIGN_OR_RAISE(auto from_field, FieldRef(to_field->name()).GetOneOrNone(from));
@@ -55,7 +90,8 @@ Status CheckProjectable(const Schema& from, const Schema& to) {
                                " in origin schema ", from);
     }
 
-    if (!from_field->type()->Equals(to_field->type())) {
+    if (!from_field->type()->Equals(to_field->type()) &&
+        !IsDictionaryEncodingOf(*to_field->type(), *from_field->type())) {
       return Status::TypeError("fields had matching names but differing types. From: ",
                                from_field->ToString(), " To: ", to_field->ToString());
     }
@@ -74,6 +110,7 @@ RecordBatchProjector::RecordBatchProjector(std::shared_ptr<Schema> to)
     : to_(std::move(to)),
       missing_columns_(to_->num_fields(), nullptr),
       column_indices_(to_->num_fields(), kNoMatch),
+      dictionary_encode_(to_->num_fields(), false),
       scalars_(to_->num_fields(), nullptr) {}
 
 Status RecordBatchProjector::SetDefaultValue(FieldRef ref,
@@ -87,7 +124,8 @@ Status RecordBatchProjector::SetDefaultValue(FieldRef ref,
   auto index = match.indices()[0];
 
   auto field_type = to_->field(index)->type();
-  if (!field_type->Equals(scalar->type)) {
+  if (!field_type->Equals(scalar->type) &&
+      !IsDictionaryEncodingOf(*field_type, *scalar->type)) {
     return Status::TypeError("field ", to_->field(index)->ToString(),
                              " cannot be materialized from scalar of type ",
                              *scalar->type);
@@ -112,6 +150,12 @@ Result<std::shared_ptr<RecordBatch>> RecordBatchProjector::Project(
   for (int i = 0; i < to_->num_fields(); ++i) {
     if (column_indices_[i] != kNoMatch) {
       columns[i] = batch.column(column_indices_[i]);
+      if (dictionary_encode_[i]) {
+        compute::ExecContext exec_context(pool);
+        ARROW_ASSIGN_OR_RAISE(auto encoded,
+                              compute::DictionaryEncode(columns[i], &exec_context));
+        columns[i] = encoded.make_array();
+      }
     } else {
       columns[i] = missing_columns_[i]->Slice(0, batch.num_rows());
     }
@@ -136,10 +180,13 @@ Status RecordBatchProjector::SetInputSchema(std::shared_ptr<Schema> from,
       ARROW_ASSIGN_OR_RAISE(missing_columns_[i],
                             MakeArrayOfNull(to_->field(i)->type(), 0, pool));
       column_indices_[i] = kNoMatch;
+      dictionary_encode_[i] = false;
     } else {
       // Mark column i as not missing by setting missing_columns_[i] to nullptr
       missing_columns_[i] = nullptr;
       column_indices_[i] = match.indices()[0];
+      dictionary_encode_[i] = !from_->field(column_indices_[i])->type()->Equals(
+          to_->field(i)->type());
     }
   }
   return Status::OK();
@@ -158,6 +205,13 @@ Status RecordBatchProjector::ResizeMissingColumns(int64_t new_length, MemoryPool
           MakeArrayOfNull(missing_columns_[i]->type(), new_length, pool));
       continue;
     }
+    const auto& type = missing_columns_[i]->type();
+    if (!type->Equals(scalars_[i]->type)) {
+      ARROW_ASSIGN_OR_RAISE(
+          missing_columns_[i],
+          MakeDictionaryArrayFromValue(type, *scalars_[i], new_length, pool));
+      continue;
+    }
     ARROW_ASSIGN_OR_RAISE(missing_columns_[i],
                           MakeArrayFromScalar(*scalars_[i], new_length, pool));
   }
@@ -37,9 +37,13 @@ ARROW_DS_EXPORT Status CheckProjectable(const Schema& from, const Schema& to);
 /// otherwise the given schema will be satisfied by augmenting with null or constant
 /// columns.
 ///
+/// A column of type T will be dictionary encoded if the given schema has a field
+/// of the same name and type dictionary(int32(), T).
+///
 /// RecordBatchProjector is most efficient when projecting record batches with a
 /// consistent schema (for example batches from a table), but it can project record
-/// batches having any schema.
+/// batches having any schema. Columns added to projected record batches are
+/// materialized once and sliced for every record batch of equal or lesser length.
 class ARROW_DS_EXPORT RecordBatchProjector {
  public:
   static constexpr int kNoMatch = -1;
@@ -50,6 +54,10 @@ class ARROW_DS_EXPORT RecordBatchProjector {
 
   /// If the indexed field is absent from a record batch it will be added to the projected
   /// record batch with all its slots equal to the provided scalar (instead of null).
+  ///
+  /// If the field has type dictionary(int32(), T), the scalar may be of type T. The
+  /// field is then added as a dictionary array containing only that value, with all
+  /// indices zero.
   Status SetDefaultValue(FieldRef ref, std::shared_ptr<Scalar> scalar);
 
   Result<std::shared_ptr<RecordBatch>> Project(const RecordBatch& batch,
@@ -68,6 +76,7 @@ class ARROW_DS_EXPORT RecordBatchProjector {
   // these vectors are indexed parallel to to_->fields()
   std::vector<std::shared_ptr<Array>> missing_columns_;
   std::vector<int> column_indices_;
+  std::vector<bool> dictionary_encode_;
   std::vector<std::shared_ptr<Scalar>> scalars_;
 };
 
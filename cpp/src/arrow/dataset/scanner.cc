@@ -18,13 +18,25 @@
 #include "arrow/dataset/scanner.h"
 
 #include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
 #include <memory>
 #include <mutex>
+#include <unordered_set>
 
+#include "arrow/array/concatenate.h"
+#include "arrow/array/util.h"
+#include "arrow/compute/api_aggregate.h"
+#include "arrow/compute/exec.h"
 #include "arrow/dataset/dataset.h"
 #include "arrow/dataset/dataset_internal.h"
 #include "arrow/dataset/scanner_internal.h"
+#include "arrow/io/util_internal.h"
+#include "arrow/scalar.h"
 #include "arrow/table.h"
+#include "arrow/util/checked_cast.h"
 #include "arrow/util/iterator.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/task_group.h"
@@ -41,6 +53,8 @@ std::shared_ptr<ScanOptions> ScanOptions::ReplaceSchema(
   auto copy = ScanOptions::Make(std::move(schema));
   copy->filter = filter;
   copy->batch_size = batch_size;
+  copy->batch_readahead = batch_readahead;
+  copy->fragment_readahead = fragment_readahead;
   return copy;
 }
 
@@ -142,6 +156,30 @@ Status ScannerBuilder::BatchSize(int64_t batch_size) {
   return Status::OK();
 }
 
+Status ScannerBuilder::BatchReadahead(int32_t batch_readahead) {
+  if (batch_readahead <= 0) {
+    return Status::Invalid("BatchReadahead must be greater than 0, got ",
+                           batch_readahead);
+  }
+  scan_options_->batch_readahead = batch_readahead;
+  return Status::OK();
+}
+
+Status ScannerBuilder::FragmentReadahead(int32_t fragment_readahead) {
+  if (fragment_readahead <= 0) {
+    return Status::Invalid("FragmentReadahead must be greater than 0, got ",
+                           fragment_readahead);
+  }
+  scan_options_->fragment_readahead = fragment_readahead;
+  return Status::OK();
+}
+
+Status ScannerBuilder::DictionaryEncode(std::vector<std::string> columns) {
+  RETURN_NOT_OK(schema()->CanReferenceFieldsByNames(columns));
+  dictionary_encode_columns_ = std::move(columns);
+  return Status::OK();
+}
+
 Result<std::shared_ptr<Scanner>> ScannerBuilder::Finish() const {
   std::shared_ptr<ScanOptions> scan_options;
   if (has_projection_ && !project_columns_.empty()) {
@@ -151,6 +189,20 @@ Result<std::shared_ptr<Scanner>> ScannerBuilder::Finish() const {
     scan_options = std::make_shared<ScanOptions>(*scan_options_);
   }
 
+  if (!dictionary_encode_columns_.empty()) {
+    std::unordered_set<std::string> names(dictionary_encode_columns_.begin(),
+                                          dictionary_encode_columns_.end());
+    auto fields = scan_options->schema()->fields();
+    for (auto& field : fields) {
+      if (names.count(field->name()) == 0 || field->type()->id() == Type::DICTIONARY) {
+        continue;
+      }
+      field = field->WithType(dictionary(int32(), field->type()));
+    }
+    scan_options = scan_options->ReplaceSchema(
+        ::arrow::schema(std::move(fields), scan_options->schema()->metadata()));
+  }
+
   if (dataset_ == nullptr) {
     return std::make_shared<Scanner>(fragment_, std::move(scan_options), scan_context_);
   }
@@ -162,8 +214,11 @@ using arrow::internal::TaskGroup;
 
 std::shared_ptr<TaskGroup> ScanContext::TaskGroup() const {
   if (use_threads) {
-    auto* thread_pool = arrow::internal::GetCpuThreadPool();
-    return TaskGroup::MakeThreaded(thread_pool);
+    internal::Executor* executor = this->executor;
+    if (executor == nullptr) {
+      executor = arrow::internal::GetCpuThreadPool();
+    }
+    return TaskGroup::MakeThreaded(executor);
   }
   return TaskGroup::MakeSerial();
 }
@@ -209,7 +264,10 @@ Result<std::shared_ptr<Table>> Scanner::ToTable() {
     ARROW_ASSIGN_OR_RAISE(auto scan_task, maybe_scan_task);
 
     auto id = scan_task_id++;
-    task_group->Append([state, id, scan_task] {
+    auto stop_token = scan_context_->stop_token;
+    task_group->Append([state, id, scan_task, stop_token] {
+      // Don't start scan tasks queued before the scan was cancelled
+      RETURN_NOT_OK(stop_token.Poll());
       ARROW_ASSIGN_OR_RAISE(auto batch_it, scan_task->Execute());
       ARROW_ASSIGN_OR_RAISE(auto local, batch_it.ToVector());
       state->Emplace(std::move(local), id);
@@ -224,5 +282,564 @@ Result<std::shared_ptr<Table>> Scanner::ToTable() {
                                   FlattenRecordBatchVector(std::move(state->batches)));
 }
 
+namespace {
+
+/// Serially flatten ScanTasks into a stream of RecordBatches.
+class SerialScanBatchesReader : public RecordBatchReader {
+ public:
+  SerialScanBatchesReader(std::shared_ptr<Schema> schema, ScanTaskIterator tasks)
+      : schema_(std::move(schema)), tasks_(std::move(tasks)) {}
+
+  std::shared_ptr<Schema> schema() const override { return schema_; }
+
+  Status ReadNext(std::shared_ptr<RecordBatch>* out) override {
+    while (true) {
+      if (batches_ != nullptr) {
+        ARROW_ASSIGN_OR_RAISE(*out, batches_->Next());
+        if (*out != nullptr) return Status::OK();
+        batches_.reset();
+      }
+
+      // The batch iterator may reference its ScanTask, keep the latter alive
+      ARROW_ASSIGN_OR_RAISE(task_, tasks_.Next());
+      if (task_ == nullptr) return Status::OK();
+      ARROW_ASSIGN_OR_RAISE(auto batches, task_->Execute());
+      batches_.reset(new RecordBatchIterator(std::move(batches)));
+    }
+  }
+
+ private:
+  std::shared_ptr<Schema> schema_;
+  ScanTaskIterator tasks_;
+  std::shared_ptr<ScanTask> task_;
+  std::unique_ptr<RecordBatchIterator> batches_;
+};
+
+/// Execute ScanTasks on the CPU thread pool, with bounded readahead.
+///
+/// Each ScanTask gets a Slot buffering its batches.  A worker executing a ScanTask
+/// never blocks: when the readahead window is full it parks the task's batch
+/// iterator in its Slot and returns its thread to the pool.  Parked slots are
+/// resumed (by Pump) once the consumer has made room in the window.
+class ThreadedScanBatchesReader : public RecordBatchReader {
+ public:
+  ThreadedScanBatchesReader(std::shared_ptr<Schema> schema,
+                            std::shared_ptr<ScanOptions> options,
+                            std::shared_ptr<ScanContext> context,
+                            FragmentIterator fragments, bool ordered)
+      : schema_(std::move(schema)),
+        state_(std::make_shared<State>(std::move(options), std::move(context),
+                                       std::move(fragments), ordered)) {}
+
+  ~ThreadedScanBatchesReader() override {
+    std::unique_lock<std::mutex> lock(state_->mutex);
+    state_->stopped = true;
+    state_->cv.wait(lock,
+                    [this] { return state_->num_running == 0 && !state_->fetching; });
+  }
+
+  std::shared_ptr<Schema> schema() const override { return schema_; }
+
+  Status ReadNext(std::shared_ptr<RecordBatch>* out) override {
+    return state_->ReadNext(out);
+  }
+
+ private:
+  /// Progress of a fragment, to limit the number of fragments being scanned.
+  struct FragmentProgress {
+    int live_slots = 0;
+    bool tasks_exhausted = false;
+
+    bool done() const { return tasks_exhausted && live_slots == 0; }
+  };
+
+  struct Slot {
+    std::shared_ptr<FragmentProgress> fragment;
+    std::shared_ptr<ScanTask> task;
+    /// Non-null once the task started executing.
+    std::unique_ptr<RecordBatchIterator> batches;
+    std::deque<std::shared_ptr<RecordBatch>> queue;
+    bool running = false;
+    bool finished = false;
+  };
+
+  struct State : std::enable_shared_from_this<State> {
+    State(std::shared_ptr<ScanOptions> options, std::shared_ptr<ScanContext> context,
+          FragmentIterator fragments, bool ordered)
+        : options(std::move(options)),
+          context(std::move(context)),
+          fragments(std::move(fragments)),
+          ordered(ordered),
+          pool(this->context->executor != nullptr ? this->context->executor
+                                                  : arrow::internal::GetCpuThreadPool()),
+          max_running(std::max(pool->GetCapacity(), 1)) {}
+
+    // All the following methods must be called with the mutex locked, except
+    // ReadNext() and RunSlot().
+
+    Status ReadNext(std::shared_ptr<RecordBatch>* out) {
+      std::unique_lock<std::mutex> lock(mutex);
+      while (true) {
+        RETURN_NOT_OK(error);
+        Pump(&lock);
+        RETURN_NOT_OK(error);
+
+        if (PopBatch(out)) {
+          // Make room for the window to advance
+          Pump(&lock);
+          return Status::OK();
+        }
+
+        if (slots.empty() && fragments_exhausted && current_tasks == nullptr &&
+            !fetching) {
+          out->reset();
+          return Status::OK();
+        }
+
+        cv.wait(lock);
+      }
+    }
+
+    bool PopBatch(std::shared_ptr<RecordBatch>* out) {
+      for (auto it = slots.begin(); it != slots.end();) {
+        auto slot = *it;
+        if (!slot->queue.empty()) {
+          *out = std::move(slot->queue.front());
+          slot->queue.pop_front();
+          --num_buffered;
+          if (slot->finished && slot->queue.empty()) RemoveSlot(it);
+          return true;
+        }
+        if (slot->finished) {
+          it = RemoveSlot(it);
+          continue;
+        }
+        // Batches must be yielded in order: only the head may be consumed.
+        if (ordered) break;
+        ++it;
+      }
+      return false;
+    }
+
+    std::deque<std::shared_ptr<Slot>>::iterator RemoveSlot(
+        std::deque<std::shared_ptr<Slot>>::iterator it) {
+      auto& fragment = (*it)->fragment;
+      --fragment->live_slots;
+      if (fragment->done()) --num_active_fragments;
+      return slots.erase(it);
+    }
+
+    // Start (or resume) as many ScanTasks as the readahead window allows.
+    //
+    // The mutex is released while pulling new ScanTasks, as this may open files
+    // and read their metadata.
+    void Pump(std::unique_lock<std::mutex>* lock) {
+      if (stopped || !error.ok()) return;
+
+      bool seen_unfinished = false;
+      for (const auto& slot : slots) {
+        if (num_running >= max_running || !error.ok()) return;
+        // When ordered, always let the head of the stream progress so that the
+        // consumer cannot starve on a window full of later batches.
+        bool is_head = ordered && !seen_unfinished && slot->queue.empty();
+        if (slot->finished) continue;
+        seen_unfinished = true;
+        if (slot->running) continue;
+        if (num_buffered >= options->batch_readahead && !is_head) return;
+        Submit(slot);
+      }
+
+      while (num_running < max_running && num_buffered < options->batch_readahead &&
+             !stopped && error.ok()) {
+        // Only one thread pulls tasks at a time, the others go on with their work.
+        // The puller starts the tasks it gets.
+        if (fetching) return;
+        fetching = true;
+        auto maybe_task = NextTask(lock);
+        fetching = false;
+        cv.notify_all();
+
+        if (!maybe_task.ok()) {
+          SetError(maybe_task.status());
+          return;
+        }
+        auto task = maybe_task.MoveValueUnsafe();
+        if (task == nullptr || stopped || !error.ok()) return;
+
+        auto slot = std::make_shared<Slot>();
+        slot->fragment = current_fragment;
+        slot->task = std::move(task);
+        ++current_fragment->live_slots;
+        slots.push_back(slot);
+        Submit(std::move(slot));
+      }
+    }
+
+    // Pull the next ScanTask, opening a new Fragment if allowed.  Yields null if
+    // there is no task to start for now.  The mutex is released while iterating,
+    // `fetching` must be set so that the iterators aren't used concurrently.
+    Result<std::shared_ptr<ScanTask>> NextTask(std::unique_lock<std::mutex>* lock) {
+      while (true) {
+        if (current_tasks != nullptr) {
+          ARROW_ASSIGN_OR_RAISE(auto task,
+                                Unlocked(lock, [&] { return current_tasks->Next(); }));
+          if (task != nullptr) return task;
+
+          current_tasks.reset();
+          current_fragment->tasks_exhausted = true;
+          if (current_fragment->done()) --num_active_fragments;
+          current_fragment.reset();
+        }
+
+        if (fragments_exhausted || num_active_fragments >= options->fragment_readahead) {
+          return nullptr;
+        }
+
+        ARROW_ASSIGN_OR_RAISE(auto fragment,
+                              Unlocked(lock, [&] { return fragments.Next(); }));
+        if (fragment == nullptr) {
+          fragments_exhausted = true;
+          return nullptr;
+        }
+
+        // Wraps the fragment's ScanTasks in FilterAndProjectScanTask
+        auto get_tasks = [&] {
+          return GetScanTaskIterator(
+              MakeVectorIterator(FragmentVector{std::move(fragment)}), options, context);
+        };
+        ARROW_ASSIGN_OR_RAISE(auto tasks, Unlocked(lock, get_tasks));
+        current_tasks.reset(new ScanTaskIterator(std::move(tasks)));
+        current_fragment = std::make_shared<FragmentProgress>();
+        ++num_active_fragments;
+      }
+    }
+
+    // Call `fn` with the mutex released
+    template <typename Fn>
+    static auto Unlocked(std::unique_lock<std::mutex>* lock, Fn&& fn) -> decltype(fn()) {
+      lock->unlock();
+      auto result = fn();
+      lock->lock();
+      return result;
+    }
+
+    void Submit(std::shared_ptr<Slot> slot) {
+      slot->running = true;
+      ++num_running;
+      auto self = shared_from_this();
+      Status st = pool->Spawn([self, slot] { self->RunSlot(slot); });
+      if (!st.ok()) {
+        slot->running = false;
+        --num_running;
+        SetError(std::move(st));
+      }
+    }
+
+    void RunSlot(const std::shared_ptr<Slot>& slot) {
+      Status st = RunSlotUnlocked(slot);
+
+      std::unique_lock<std::mutex> lock(mutex);
+      slot->running = false;
+      --num_running;
+      if (!st.ok()) {
+        SetError(std::move(st));
+      } else {
+        Pump(&lock);
+      }
+      cv.notify_all();
+    }
+
+    // Run the slot's ScanTask until it is exhausted or the window is full.
+    Status RunSlotUnlocked(const std::shared_ptr<Slot>& slot) {
+      {
+        // Don't open files nor decode batches for a closed or failed reader
+        std::lock_guard<std::mutex> lock(mutex);
+        if (stopped || !error.ok()) return Status::OK();
+      }
+      if (slot->batches == nullptr) {
+        ARROW_ASSIGN_OR_RAISE(auto batches, slot->task->Execute());
+        slot->batches.reset(new RecordBatchIterator(std::move(batches)));
+      }
+
+      while (true) {
+        ARROW_ASSIGN_OR_RAISE(auto batch, slot->batches->Next());
+
+        std::lock_guard<std::mutex> lock(mutex);
+        if (batch == nullptr) {
+          slot->finished = true;
+          slot->batches.reset();
+          slot->task.reset();
+          return Status::OK();
+        }
+
+        slot->queue.push_back(std::move(batch));
+        ++num_buffered;
+        cv.notify_all();
+
+        if (stopped || !error.ok() || num_buffered >= options->batch_readahead) {
+          // Park the task, it will be resumed by Pump()
+          return Status::OK();
+        }
+      }
+    }
+
+    void SetError(Status st) {
+      if (error.ok()) error = std::move(st);
+      cv.notify_all();
+    }
+
+    std::shared_ptr<ScanOptions> options;
+    std::shared_ptr<ScanContext> context;
+    FragmentIterator fragments;
+    const bool ordered;
+    arrow::internal::Executor* pool;
+    const int max_running;
+
+    std::mutex mutex;
+    std::condition_variable cv;
+
+    std::deque<std::shared_ptr<Slot>> slots;
+    std::unique_ptr<ScanTaskIterator> current_tasks;
+    std::shared_ptr<FragmentProgress> current_fragment;
+    bool fragments_exhausted = false;
+    int num_active_fragments = 0;
+    int num_running = 0;
+    int64_t num_buffered = 0;
+    // Whether a thread is pulling ScanTasks with the mutex released
+    bool fetching = false;
+    bool stopped = false;
+    Status error;
+  };
+
+  std::shared_ptr<Schema> schema_;
+  std::shared_ptr<State> state_;
+};
+
+Result<std::shared_ptr<RecordBatchReader>> ScanFragmentBatches(
+    FragmentIterator fragments, std::shared_ptr<ScanOptions> options,
+    std::shared_ptr<ScanContext> context, bool ordered) {
+  auto schema = options->schema();
+  if (!context->use_threads) {
+    ARROW_ASSIGN_OR_RAISE(auto tasks,
+                          GetScanTaskIterator(std::move(fragments), options, context));
+    return std::make_shared<SerialScanBatchesReader>(std::move(schema), std::move(tasks));
+  }
+  return std::make_shared<ThreadedScanBatchesReader>(
+      std::move(schema), std::move(options), std::move(context), std::move(fragments),
+      ordered);
+}
+
+}  // namespace
+
+Result<std::shared_ptr<RecordBatchReader>> Scanner::ScanBatches() {
+  ARROW_ASSIGN_OR_RAISE(auto fragments, GetFragments());
+  return ScanFragmentBatches(std::move(fragments), scan_options_, scan_context_,
+                             /*ordered=*/true);
+}
+
+Result<std::shared_ptr<RecordBatchReader>> Scanner::ScanBatchesUnordered() {
+  ARROW_ASSIGN_OR_RAISE(auto fragments, GetFragments());
+  return ScanFragmentBatches(std::move(fragments), scan_options_, scan_context_,
+                             /*ordered=*/false);
+}
+
+namespace {
+
+/// Yield the remainders of the fragments which metadata didn't decide (`decide`
+/// returns null for the others). `decide` is called on up to `readahead` fragments
+/// concurrently, on the IO thread pool as it may read file metadata, or inline if
+/// `readahead` is 0.
+class DecideFromMetadataIterator {
+ public:
+  using Decide =
+      std::function<Result<std::shared_ptr<Fragment>>(std::shared_ptr<Fragment>)>;
+
+  DecideFromMetadataIterator(FragmentIterator fragments, Decide decide, int readahead,
+                             StopToken stop_token)
+      : fragments_(std::move(fragments)),
+        decide_(std::move(decide)),
+        readahead_(readahead),
+        stop_token_(std::move(stop_token)) {}
+
+  DecideFromMetadataIterator(DecideFromMetadataIterator&&) = default;
+  DecideFromMetadataIterator& operator=(DecideFromMetadataIterator&&) = default;
+
+  ~DecideFromMetadataIterator() {
+    // `decide` may reference state which doesn't outlive this iterator
+    for (const auto& future : pending_) {
+      future.Wait();
+    }
+  }
+
+  Result<std::shared_ptr<Fragment>> Next() {
+    while (true) {
+      RETURN_NOT_OK(stop_token_.Poll());
+      if (readahead_ == 0) {
+        ARROW_ASSIGN_OR_RAISE(auto fragment, fragments_.Next());
+        if (fragment == nullptr) return nullptr;
+        ARROW_ASSIGN_OR_RAISE(auto remainder, decide_(std::move(fragment)));
+        if (remainder != nullptr) return remainder;
+        continue;
+      }
+
+      while (!fragments_exhausted_ && static_cast<int>(pending_.size()) < readahead_) {
+        ARROW_ASSIGN_OR_RAISE(auto fragment, fragments_.Next());
+        if (fragment == nullptr) {
+          fragments_exhausted_ = true;
+          break;
+        }
+        ARROW_ASSIGN_OR_RAISE(
+            auto future, io::internal::GetIOThreadPool()->Submit(decide_, fragment));
+        pending_.push_back(std::move(future));
+      }
+      if (pending_.empty()) return nullptr;
+
+      auto future = std::move(pending_.front());
+      pending_.pop_front();
+      ARROW_ASSIGN_OR_RAISE(auto remainder, future.result());
+      if (remainder != nullptr) return remainder;
+    }
+  }
+
+ private:
+  FragmentIterator fragments_;
+  Decide decide_;
+  int readahead_;
+  StopToken stop_token_;
+  bool fragments_exhausted_ = false;
+  std::deque<Future<std::shared_ptr<Fragment>>> pending_;
+};
+
+FragmentIterator DecideFromMetadata(FragmentIterator fragments,
+                                    const ScanOptions& options,
+                                    const ScanContext& context,
+                                    DecideFromMetadataIterator::Decide decide) {
+  return FragmentIterator(DecideFromMetadataIterator(
+      std::move(fragments), std::move(decide),
+      context.use_threads ? options.fragment_readahead : 0, context.stop_token));
+}
+
+}  // namespace
+
+Result<int64_t> Scanner::CountRows() {
+  ARROW_ASSIGN_OR_RAISE(auto fragments, GetFragments());
+
+  auto filter = scan_options_->filter;
+  auto num_counted = std::make_shared<std::atomic<int64_t>>(0);
+
+  // Fragment -> the part of the Fragment which metadata didn't decide, if any
+  auto remainders = DecideFromMetadata(
+      std::move(fragments), *scan_options_, *scan_context_,
+      [filter, num_counted](
+          std::shared_ptr<Fragment> fragment) -> Result<std::shared_ptr<Fragment>> {
+        ARROW_ASSIGN_OR_RAISE(auto count, fragment->CountRows(filter));
+        *num_counted += count.num_rows;
+        return std::move(count.remainder);
+      });
+
+  // Scan the remainders without projecting any column, only those referenced
+  // by the filter are materialized.
+  auto options = scan_options_->ReplaceSchema(::arrow::schema({}));
+  ARROW_ASSIGN_OR_RAISE(auto reader,
+                        ScanFragmentBatches(std::move(remainders), std::move(options),
+                                            scan_context_, /*ordered=*/false));
+
+  int64_t num_rows = 0;
+  while (true) {
+    ARROW_ASSIGN_OR_RAISE(auto batch, reader->Next());
+    if (batch == nullptr) break;
+    num_rows += batch->num_rows();
+  }
+  return num_rows + num_counted->load();
+}
+
+namespace {
+
+/// Candidate extrema of a column, gathered from metadata and scanned batches.
+struct ExtremaState {
+  explicit ExtremaState(std::shared_ptr<DataType> type) : type(std::move(type)) {}
+
+  Status Append(const ScalarVector& scalars) {
+    ScalarVector casted;
+    for (const auto& scalar : scalars) {
+      ARROW_ASSIGN_OR_RAISE(auto cast, scalar->CastTo(type));
+      casted.push_back(std::move(cast));
+    }
+
+    std::lock_guard<std::mutex> lock(mutex);
+    extrema.insert(extrema.end(), casted.begin(), casted.end());
+    return Status::OK();
+  }
+
+  Status Append(const std::shared_ptr<Array>& values, compute::ExecContext* ctx) {
+    ARROW_ASSIGN_OR_RAISE(auto min_max,
+                          compute::MinMax(values, compute::MinMaxOptions{}, ctx));
+    const auto& min_max_values =
+        internal::checked_cast<const StructScalar&>(*min_max.scalar()).value;
+    if (!min_max_values[0]->is_valid) {
+      return Status::OK();
+    }
+    return Append(min_max_values);
+  }
+
+  Result<std::shared_ptr<Scalar>> Finish(compute::ExecContext* ctx) {
+    ArrayVector arrays;
+    for (const auto& scalar : extrema) {
+      ARROW_ASSIGN_OR_RAISE(auto array,
+                            MakeArrayFromScalar(*scalar, 1, ctx->memory_pool()));
+      arrays.push_back(std::move(array));
+    }
+
+    std::shared_ptr<Array> values;
+    if (arrays.empty()) {
+      ARROW_ASSIGN_OR_RAISE(values, MakeArrayOfNull(type, 0, ctx->memory_pool()));
+    } else {
+      ARROW_ASSIGN_OR_RAISE(values, Concatenate(arrays, ctx->memory_pool()));
+    }
+
+    ARROW_ASSIGN_OR_RAISE(auto min_max,
+                          compute::MinMax(values, compute::MinMaxOptions{}, ctx));
+    return min_max.scalar();
+  }
+
+  std::shared_ptr<DataType> type;
+  std::mutex mutex;
+  ScalarVector extrema;
+};
+
+}  // namespace
+
+Result<std::shared_ptr<Scalar>> Scanner::MinMax(const std::string& column) {
+  ARROW_ASSIGN_OR_RAISE(auto field, FieldRef(column).GetOne(*schema()));
+  ARROW_ASSIGN_OR_RAISE(auto fragments, GetFragments());
+
+  auto filter = scan_options_->filter;
+  auto state = std::make_shared<ExtremaState>(field->type());
+
+  // Fragment -> the part of the Fragment which metadata didn't decide, if any
+  auto remainders = DecideFromMetadata(
+      std::move(fragments), *scan_options_, *scan_context_,
+      [column, filter, state](
+          std::shared_ptr<Fragment> fragment) -> Result<std::shared_ptr<Fragment>> {
+        ARROW_ASSIGN_OR_RAISE(auto min_max, fragment->MinMax(column, filter));
+        RETURN_NOT_OK(state->Append(min_max.extrema));
+        return std::move(min_max.remainder);
+      });
+
+  auto options = scan_options_->ReplaceSchema(::arrow::schema({field}));
+  ARROW_ASSIGN_OR_RAISE(auto reader,
+                        ScanFragmentBatches(std::move(remainders), std::move(options),
+                                            scan_context_, /*ordered=*/false));
+
+  compute::ExecContext ctx(scan_context_->pool);
+  ctx.set_stop_token(scan_context_->stop_token);
+  while (true) {
+    ARROW_ASSIGN_OR_RAISE(auto batch, reader->Next());
+    if (batch == nullptr) break;
+    RETURN_NOT_OK(state->Append(batch->column(0), &ctx));
+  }
+  return state->Finish(&ctx);
+}
+
 }  // namespace dataset
 }  // namespace arrow
@@ -31,21 +31,42 @@
 #include "arrow/dataset/visibility.h"
 #include "arrow/memory_pool.h"
 #include "arrow/type_fwd.h"
+#include "arrow/util/cancel.h"
 #include "arrow/util/type_fwd.h"
 
 namespace arrow {
 namespace dataset {
 
 constexpr int64_t kDefaultBatchSize = 1 << 20;
+constexpr int32_t kDefaultBatchReadahead = 32;
+constexpr int32_t kDefaultFragmentReadahead = 8;
 
-/// \brief Shared state for a Scan operation
+/// \brief Per-scan resources and controls.
+///
+/// A ScanContext may be shared by all the scans of a query, to attribute and bound
+/// their memory (by using a CappedMemoryPool as `pool`) and to cancel them at once
+/// (through `stop_token`).
 struct ARROW_DS_EXPORT ScanContext {
   /// A pool from which materialized and scanned arrays will be allocated.
   MemoryPool* pool = arrow::default_memory_pool();
 
+  /// A token polled between batches and scan tasks; once a stop was requested,
+  /// the scan fails with the error given to StopSource::RequestStop().
+  StopToken stop_token;
+
   /// Indicate if the Scanner should make use of a ThreadPool.
   bool use_threads = false;
 
+  /// The Executor running scan tasks if use_threads is true, e.g. a NumaThreadPool
+  /// to keep scan tasks on the nodes of their data.  If null, the global CPU thread
+  /// pool is used.
+  internal::Executor* executor = NULLPTR;
+
+  /// An optional cache of decoded column chunks, which may be shared by many scans.
+  /// When set, supporting FileFormats decode column chunks using the cache's pool
+  /// rather than `pool`.
+  std::shared_ptr<ColumnChunkCache> column_cache;
+
   /// Return a threaded or serial TaskGroup according to use_threads.
   std::shared_ptr<internal::TaskGroup> TaskGroup() const;
 };
@@ -74,6 +95,14 @@ class ARROW_DS_EXPORT ScanOptions {
   // Maximum row count for scanned batches.
   int64_t batch_size = kDefaultBatchSize;
 
+  // Maximum number of batches buffered ahead of the consumer by
+  // Scanner::ScanBatches().  Peak memory of a streaming scan is bounded by
+  // roughly (batch_readahead + CPU thread pool capacity) batches.
+  int32_t batch_readahead = kDefaultBatchReadahead;
+
+  // Maximum number of fragments scanned concurrently by Scanner::ScanBatches().
+  int32_t fragment_readahead = kDefaultFragmentReadahead;
+
   // Return a vector of fields that requires materialization.
   //
   // This is usually the union of the fields referenced in the projection and the
@@ -169,6 +198,39 @@ class ARROW_DS_EXPORT Scanner {
   /// Scan result in memory before creating the Table.
   Result<std::shared_ptr<Table>> ToTable();
 
+  /// \brief Stream the scanned record batches, in dataset order.
+  ///
+  /// If ScanContext::use_threads is true, ScanTasks are executed concurrently on
+  /// the CPU thread pool, at most ScanOptions::fragment_readahead fragments at a
+  /// time.  Execution is paused whenever ScanOptions::batch_readahead batches are
+  /// buffered and not yet consumed, so memory usage is bounded by the readahead
+  /// window rather than by the size of the dataset.
+  ///
+  /// Batches are yielded in the same order as ToTable() would assemble them.
+  /// Destroying the reader stops the scan.
+  Result<std::shared_ptr<RecordBatchReader>> ScanBatches();
+
+  /// \brief Same as ScanBatches(), but yield batches as soon as they are
+  /// available, in no particular order.
+  ///
+  /// This avoids stalling the consumer on a slow ScanTask while batches from
+  /// other ScanTasks are ready.
+  Result<std::shared_ptr<RecordBatchReader>> ScanBatchesUnordered();
+
+  /// \brief Count the rows matching the filter.
+  ///
+  /// Partition expressions and Fragment metadata (e.g. Parquet row counts and
+  /// statistics) are used to count rows without reading them; only the Fragments,
+  /// or parts of Fragments, which they don't decide are scanned.
+  Result<int64_t> CountRows();
+
+  /// \brief Compute the min and max of a column over the rows matching the filter.
+  ///
+  /// As with CountRows(), exact metadata is used where available and only the
+  /// undecided parts of the dataset are scanned. The result is a
+  /// struct<min: T, max: T> scalar, as returned by the "min_max" compute function.
+  Result<std::shared_ptr<Scalar>> MinMax(const std::string& column);
+
   /// \brief GetFragments returns an iterator over all Fragments in this scan.
   Result<FragmentIterator> GetFragments();
 
@@ -234,6 +296,33 @@ class ARROW_DS_EXPORT ScannerBuilder {
   /// This option provides a control limiting the memory owned by any RecordBatch.
   Status BatchSize(int64_t batch_size);
 
+  /// \brief Set the maximum number of batches buffered by ScanBatches().
+  ///
+  /// \param[in] batch_readahead the maximum number of batches.
+  /// \returns An error if the number is not greater than 0.
+  Status BatchReadahead(int32_t batch_readahead);
+
+  /// \brief Set the maximum number of fragments scanned concurrently by
+  /// ScanBatches().
+  ///
+  /// \param[in] fragment_readahead the maximum number of fragments.
+  /// \returns An error if the number is not greater than 0.
+  Status FragmentReadahead(int32_t fragment_readahead);
+
+  /// \brief Emit the given columns dictionary encoded, with type
+  /// dictionary(int32(), T) rather than T.
+  ///
+  /// This is intended for partition fields, which are constant within each Fragment.
+  /// Rather than repeating the partition value for every row, each batch will contain
+  /// a dictionary with that value as its single entry and all-zero indices, which are
+  /// shared between batches where possible. Columns which are read from files are
+  /// dictionary encoded. Columns which are already dictionary encoded are unaffected.
+  ///
+  /// \param[in] columns the names of the columns to dictionary encode
+  ///
+  /// \return Failure if any column name does not exist in the dataset's Schema.
+  Status DictionaryEncode(std::vector<std::string> columns);
+
   /// \brief Return the constructed now-immutable Scanner object
   Result<std::shared_ptr<Scanner>> Finish() const;
 
@@ -247,6 +336,7 @@ class ARROW_DS_EXPORT ScannerBuilder {
   std::shared_ptr<ScanContext> scan_context_;
   bool has_projection_ = false;
   std::vector<std::string> project_columns_;
+  std::vector<std::string> dictionary_encode_columns_;
 };
 
 }  // namespace dataset
@@ -0,0 +1,85 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "benchmark/benchmark.h"
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "arrow/dataset/dataset.h"
+#include "arrow/dataset/scanner.h"
+#include "arrow/memory_pool.h"
+#include "arrow/record_batch.h"
+#include "arrow/table.h"
+#include "arrow/testing/generator.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/type.h"
+
+namespace arrow {
+namespace dataset {
+
+// Scan a fragment of a dataset with three string partition fields (as a Hive
+// partitioned dataset keyed by customer name would have) to a Table, materializing the
+// partition fields either as repeated strings or as dictionaries.
+static void ScanPartitionFields(benchmark::State& state) {  // NOLINT non-const reference
+  constexpr int64_t kNumRows = 1 << 20;
+  constexpr int64_t kBatchSize = 1 << 14;
+  const bool dictionary_encode = state.range(0) != 0;
+
+  auto file_schema = schema({field("f64", float64()), field("i32", int32())});
+  std::vector<std::string> partition_fields = {"customer", "region", "product"};
+
+  auto dataset_schema = file_schema;
+  auto partition = literal(true);
+  for (const auto& name : partition_fields) {
+    dataset_schema = dataset_schema->AddField(dataset_schema->num_fields(),
+                                              field(name, utf8()))
+                         .ValueOrDie();
+    partition = and_(partition, equal(field_ref(name),
+                                      literal(name + ": a fairly long partition key")));
+  }
+  partition = partition.Bind(*dataset_schema).ValueOrDie();
+
+  auto fragment = std::make_shared<InMemoryFragment>(
+      RecordBatchVector{ConstantArrayGenerator::Zeroes(kNumRows, file_schema)}, partition);
+
+  auto context = std::make_shared<ScanContext>();
+  ScannerBuilder builder(dataset_schema, fragment, context);
+  ABORT_NOT_OK(builder.BatchSize(kBatchSize));
+  if (dictionary_encode) {
+    ABORT_NOT_OK(builder.DictionaryEncode(partition_fields));
+  }
+  auto scanner = builder.Finish().ValueOrDie();
+
+  int64_t bytes_retained = 0;
+  for (auto _ : state) {
+    ProxyMemoryPool pool(default_memory_pool());
+    context->pool = &pool;
+    auto table = scanner->ToTable().ValueOrDie();
+    bytes_retained = pool.bytes_allocated();
+  }
+
+  state.counters["bytes_retained"] = static_cast<double>(bytes_retained);
+  state.SetItemsProcessed(state.iterations() * kNumRows);
+}
+
+BENCHMARK(ScanPartitionFields)->ArgName("dictionary")->Arg(0)->Arg(1);
+
+}  // namespace dataset
+}  // namespace arrow
@@ -31,10 +31,12 @@ namespace arrow {
 namespace dataset {
 
 inline RecordBatchIterator FilterRecordBatch(RecordBatchIterator it, Expression filter,
-                                             MemoryPool* pool) {
+                                             MemoryPool* pool, StopToken stop_token) {
   return MakeMaybeMapIterator(
       [=](std::shared_ptr<RecordBatch> in) -> Result<std::shared_ptr<RecordBatch>> {
+        RETURN_NOT_OK(stop_token.Poll());
         compute::ExecContext exec_context{pool};
+        exec_context.set_stop_token(stop_token);
         ARROW_ASSIGN_OR_RAISE(Datum mask,
                               ExecuteScalarExpression(filter, Datum(in), &exec_context));
 
@@ -57,13 +59,14 @@ inline RecordBatchIterator FilterRecordBatch(RecordBatchIterator it, Expression
 inline RecordBatchIterator ProjectRecordBatch(RecordBatchIterator it,
                                               RecordBatchProjector* projector,
                                               MemoryPool* pool) {
+  // The RecordBatchProjector is shared across ScanTasks of the same
+  // Fragment. The resize operation of missing columns is not thread safe.
+  // Ensure that each ScanTask gets his own projector, which is reused for all
+  // its batches so that missing columns are materialized once rather than per batch.
+  auto local_projector = std::make_shared<RecordBatchProjector>(*projector);
   return MakeMaybeMapIterator(
       [=](std::shared_ptr<RecordBatch> in) {
-        // The RecordBatchProjector is shared across ScanTasks of the same
-        // Fragment. The resize operation of missing columns is not thread safe.
-        // Ensure that each ScanTask gets his own projector.
-        RecordBatchProjector local_projector{*projector};
-        return local_projector.Project(*in, pool);
+        return local_projector->Project(*in, pool);
       },
       std::move(it));
 }
@@ -84,7 +87,8 @@ class FilterAndProjectScanTask : public ScanTask {
                           SimplifyWithGuarantee(filter_, partition_));
 
     RecordBatchIterator filter_it =
-        FilterRecordBatch(std::move(it), simplified_filter, context_->pool);
+        FilterRecordBatch(std::move(it), simplified_filter, context_->pool,
+                          context_->stop_token);
 
     RETURN_NOT_OK(
         KeyValuePartitioning::SetDefaultValuesFromKeys(partition_, &projector_));
@@ -107,6 +111,7 @@ inline Result<ScanTaskIterator> GetScanTaskIterator(
   // Fragment -> ScanTaskIterator
   auto fn = [options,
              context](std::shared_ptr<Fragment> fragment) -> Result<ScanTaskIterator> {
+    RETURN_NOT_OK(context->stop_token.Poll());
     ARROW_ASSIGN_OR_RAISE(auto scan_task_it, fragment->Scan(options, context));
 
     auto partition = fragment->partition_expression();
@@ -17,13 +17,21 @@
 
 #include "arrow/dataset/scanner.h"
 
+#include <algorithm>
+#include <atomic>
+#include <cstring>
 #include <memory>
+#include <thread>
 
 #include "arrow/dataset/test_util.h"
+#include "arrow/memory_pool.h"
 #include "arrow/record_batch.h"
 #include "arrow/table.h"
 #include "arrow/testing/generator.h"
 #include "arrow/testing/util.h"
+#include "arrow/util/cancel.h"
+#include "arrow/util/numa.h"
+#include "arrow/util/thread_pool.h"
 
 namespace arrow {
 namespace dataset {
@@ -146,6 +154,361 @@ TEST_F(TestScanner, ToTable) {
   AssertTablesEqual(*expected, *actual);
 }
 
+class SequenceGenerator : public InMemoryDataset::RecordBatchGenerator {
+ public:
+  SequenceGenerator(std::shared_ptr<Schema> schema, int64_t num_batches,
+                    int64_t batch_size)
+      : schema_(std::move(schema)), num_batches_(num_batches), batch_size_(batch_size) {}
+
+  // Yield `num_batches` batches, where the rows of the i-th batch are all i.
+  RecordBatchIterator Get() const override {
+    auto schema = schema_;
+    auto batch_size = batch_size_;
+    auto num_generated = num_generated_;
+    int32_t i = 0;
+    return MakeFunctionIterator(
+        [=]() mutable -> Result<std::shared_ptr<RecordBatch>> {
+          if (i == num_batches_) return nullptr;
+          ++*num_generated;
+          ARROW_ASSIGN_OR_RAISE(
+              auto values,
+              ArrayFromBuilderVisitor(int32(), batch_size, [&](Int32Builder* builder) {
+                builder->UnsafeAppend(i);
+              }));
+          ++i;
+          return RecordBatch::Make(schema, batch_size, {values});
+        });
+  }
+
+  int64_t num_generated() const { return num_generated_->load(); }
+
+ private:
+  std::shared_ptr<Schema> schema_;
+  int64_t num_batches_;
+  int64_t batch_size_;
+  std::shared_ptr<std::atomic<int64_t>> num_generated_ =
+      std::make_shared<std::atomic<int64_t>>(0);
+};
+
+class TestScanBatches : public DatasetFixtureMixin {
+ protected:
+  static constexpr int64_t kNumberBatches = 64;
+  static constexpr int64_t kBatchSize = 16;
+
+  void SetUp() override {
+    SetSchema({field("i32", int32())});
+    generator_ = std::make_shared<SequenceGenerator>(schema_, kNumberBatches, kBatchSize);
+  }
+
+  Scanner MakeScanner() {
+    return Scanner{std::make_shared<InMemoryDataset>(schema_, generator_), options_,
+                   ctx_};
+  }
+
+  static std::vector<int32_t> FirstValues(const RecordBatchVector& batches) {
+    std::vector<int32_t> values;
+    for (const auto& batch : batches) {
+      values.push_back(checked_cast<const Int32Array&>(*batch->column(0)).Value(0));
+    }
+    return values;
+  }
+
+  std::vector<int32_t> ExpectedValues() {
+    // Every generated batch is sliced in two by the scan
+    std::vector<int32_t> values;
+    for (int32_t i = 0; i < kNumberBatches; ++i) {
+      values.push_back(i);
+      values.push_back(i);
+    }
+    return values;
+  }
+
+  std::shared_ptr<SequenceGenerator> generator_;
+};
+
+constexpr int64_t TestScanBatches::kNumberBatches;
+constexpr int64_t TestScanBatches::kBatchSize;
+
+TEST_F(TestScanBatches, Ordered) {
+  options_->batch_size = kBatchSize / 2;
+  options_->batch_readahead = 3;
+  options_->fragment_readahead = 2;
+
+  for (bool use_threads : {false, true}) {
+    ctx_->use_threads = use_threads;
+    ASSERT_OK_AND_ASSIGN(auto reader, MakeScanner().ScanBatches());
+    AssertSchemaEqual(*schema_, *reader->schema());
+
+    RecordBatchVector batches;
+    ASSERT_OK(reader->ReadAll(&batches));
+    for (const auto& batch : batches) {
+      ASSERT_OK(batch->ValidateFull());
+      ASSERT_EQ(batch->num_rows(), kBatchSize / 2);
+    }
+    ASSERT_EQ(FirstValues(batches), ExpectedValues());
+  }
+}
+
+TEST_F(TestScanBatches, Unordered) {
+  options_->batch_size = kBatchSize / 2;
+  options_->batch_readahead = 3;
+  options_->fragment_readahead = 4;
+  ctx_->use_threads = true;
+
+  ASSERT_OK_AND_ASSIGN(auto reader, MakeScanner().ScanBatchesUnordered());
+  RecordBatchVector batches;
+  ASSERT_OK(reader->ReadAll(&batches));
+
+  auto values = FirstValues(batches);
+  std::sort(values.begin(), values.end());
+  ASSERT_EQ(values, ExpectedValues());
+}
+
+TEST_F(TestScanBatches, FragmentReadahead) {
+  options_->fragment_readahead = 2;
+  options_->batch_readahead = kNumberBatches;
+  ctx_->use_threads = true;
+
+  for (bool ordered : {true, false}) {
+    generator_ = std::make_shared<SequenceGenerator>(schema_, kNumberBatches, kBatchSize);
+    auto scanner = MakeScanner();
+    ASSERT_OK_AND_ASSIGN(auto reader, ordered ? scanner.ScanBatches()
+                                              : scanner.ScanBatchesUnordered());
+
+    for (int64_t consumed = 1; consumed <= 4; ++consumed) {
+      ASSERT_OK_AND_ASSIGN(auto batch, reader->Next());
+      ASSERT_NE(batch, nullptr);
+      SleepFor(1e-3);
+      // Fragments aren't opened beyond the readahead window
+      ASSERT_LE(generator_->num_generated(), consumed + options_->fragment_readahead);
+    }
+  }
+}
+
+TEST_F(TestScanBatches, EarlyDestruction) {
+  options_->batch_readahead = 2;
+  ctx_->use_threads = true;
+
+  ASSERT_OK_AND_ASSIGN(auto reader, MakeScanner().ScanBatches());
+  ASSERT_OK_AND_ASSIGN(auto batch, reader->Next());
+  ASSERT_NE(batch, nullptr);
+  reader.reset();
+  ASSERT_LT(generator_->num_generated(), kNumberBatches);
+}
+
+TEST_F(TestScanBatches, Executor) {
+  options_->batch_size = kBatchSize / 2;
+  ctx_->use_threads = true;
+  ASSERT_OK_AND_ASSIGN(auto executor, internal::NumaThreadPool::Make(
+                                          internal::NumaTopology::Simulated(2, 2)));
+  ctx_->executor = executor.get();
+
+  ASSERT_OK_AND_ASSIGN(auto reader, MakeScanner().ScanBatches());
+  RecordBatchVector batches;
+  ASSERT_OK(reader->ReadAll(&batches));
+  ASSERT_EQ(FirstValues(batches), ExpectedValues());
+
+  ASSERT_OK_AND_ASSIGN(auto table, MakeScanner().ToTable());
+  ASSERT_EQ(table->num_rows(), kNumberBatches * kBatchSize);
+  ASSERT_OK(executor->Shutdown());
+}
+
+class TestScannerAggregates : public TestScanBatches {
+ protected:
+  void AssertMinMax(Scanner scanner, util::optional<int32_t> min,
+                    util::optional<int32_t> max) {
+    ASSERT_OK_AND_ASSIGN(auto min_max, scanner.MinMax("i32"));
+    const auto& values = checked_cast<const StructScalar&>(*min_max).value;
+    AssertScalarsEqual(min ? Int32Scalar(*min) : Int32Scalar(), *values[0]);
+    AssertScalarsEqual(max ? Int32Scalar(*max) : Int32Scalar(), *values[1]);
+  }
+};
+
+TEST_F(TestScannerAggregates, CountRows) {
+  for (bool use_threads : {false, true}) {
+    ctx_->use_threads = use_threads;
+
+    ASSERT_OK_AND_ASSIGN(auto count, MakeScanner().CountRows());
+    ASSERT_EQ(count, kNumberBatches * kBatchSize);
+
+    SetFilter(less(field_ref("i32"), literal(10)));
+    ASSERT_OK_AND_ASSIGN(count, MakeScanner().CountRows());
+    ASSERT_EQ(count, 10 * kBatchSize);
+
+    SetFilter(literal(false));
+    ASSERT_OK_AND_ASSIGN(count, MakeScanner().CountRows());
+    ASSERT_EQ(count, 0);
+
+    SetFilter(literal(true));
+  }
+}
+
+TEST_F(TestScannerAggregates, CountRowsFromMetadata) {
+  ASSERT_OK_AND_ASSIGN(auto partition_expression,
+                       equal(field_ref("i32"), literal(0)).Bind(*schema_));
+  auto fragment = std::make_shared<InMemoryFragment>(
+      RecordBatchVector{ConstantArrayGenerator::Zeroes(kBatchSize, schema_)},
+      partition_expression);
+
+  // Decided by the partition expression
+  ASSERT_OK_AND_ASSIGN(auto count, fragment->CountRows(literal(true)));
+  ASSERT_EQ(count.num_rows, kBatchSize);
+  ASSERT_EQ(count.remainder, nullptr);
+
+  SetFilter(equal(field_ref("i32"), literal(0)));
+  ASSERT_OK_AND_ASSIGN(count, fragment->CountRows(options_->filter));
+  ASSERT_EQ(count.num_rows, kBatchSize);
+  ASSERT_EQ(count.remainder, nullptr);
+
+  SetFilter(equal(field_ref("i32"), literal(1)));
+  ASSERT_OK_AND_ASSIGN(count, fragment->CountRows(options_->filter));
+  ASSERT_EQ(count.num_rows, 0);
+  ASSERT_EQ(count.remainder, nullptr);
+
+  // Undecided, the whole fragment must be scanned
+  fragment = std::make_shared<InMemoryFragment>(
+      RecordBatchVector{ConstantArrayGenerator::Zeroes(kBatchSize, schema_)});
+  SetFilter(less(field_ref("i32"), literal(10)));
+  ASSERT_OK_AND_ASSIGN(count, fragment->CountRows(options_->filter));
+  ASSERT_EQ(count.num_rows, 0);
+  ASSERT_EQ(count.remainder, fragment);
+}
+
+TEST_F(TestScannerAggregates, MinMax) {
+  for (bool use_threads : {false, true}) {
+    ctx_->use_threads = use_threads;
+
+    AssertMinMax(MakeScanner(), 0, kNumberBatches - 1);
+
+    SetFilter(greater(field_ref("i32"), literal(10)));
+    AssertMinMax(MakeScanner(), 11, kNumberBatches - 1);
+
+    SetFilter(greater(field_ref("i32"), literal(1000)));
+    AssertMinMax(MakeScanner(), util::nullopt, util::nullopt);
+
+    SetFilter(literal(true));
+  }
+
+  ASSERT_RAISES(Invalid, MakeScanner().MinMax("not_a_column"));
+}
+
+// Yields large batches allocated from a given pool.  After `stall_after` batches,
+// the generator stalls (as a slow source would) until the scan is cancelled.
+class LargeBatchGenerator : public InMemoryDataset::RecordBatchGenerator {
+ public:
+  LargeBatchGenerator(std::shared_ptr<Schema> schema, MemoryPool* pool,
+                      int64_t num_batches, int64_t batch_size, int64_t stall_after,
+                      StopToken stop_token)
+      : schema_(std::move(schema)),
+        pool_(pool),
+        num_batches_(num_batches),
+        batch_size_(batch_size),
+        stall_after_(stall_after),
+        stop_token_(std::move(stop_token)) {}
+
+  RecordBatchIterator Get() const override {
+    auto self = this;
+    int64_t i = 0;
+    return MakeFunctionIterator([=]() mutable -> Result<std::shared_ptr<RecordBatch>> {
+      if (i == self->num_batches_) return nullptr;
+      if (i == self->stall_after_) {
+        while (!self->stop_token_.IsStopRequested()) {
+          SleepFor(1e-3);
+        }
+      }
+      ++i;
+      const int64_t size = self->batch_size_ * sizeof(int64_t);
+      ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Buffer> data,
+                            AllocateBuffer(size, self->pool_));
+      std::memset(data->mutable_data(), 0, static_cast<size_t>(size));
+      auto values = std::make_shared<Int64Array>(self->batch_size_, std::move(data));
+      ++*self->num_generated_;
+      return RecordBatch::Make(self->schema_, self->batch_size_, {std::move(values)});
+    });
+  }
+
+  int64_t num_generated() const { return num_generated_->load(); }
+
+ private:
+  std::shared_ptr<Schema> schema_;
+  MemoryPool* pool_;
+  int64_t num_batches_, batch_size_, stall_after_;
+  StopToken stop_token_;
+  std::shared_ptr<std::atomic<int64_t>> num_generated_ =
+      std::make_shared<std::atomic<int64_t>>(0);
+};
+
+class TestScannerCancellation : public DatasetFixtureMixin {
+ protected:
+  // 1024 batches of 8 MB: an 8 GB scan
+  static constexpr int64_t kNumberBatches = 1024;
+  static constexpr int64_t kBatchSize = 1 << 20;
+  static constexpr int64_t kStallAfter = 8;
+
+  void SetUp() override { SetSchema({field("i64", int64())}); }
+
+  // Run `scan` and cancel it from another thread once some batches were produced
+  template <typename ScanFn>
+  void AssertCancelledMidFlight(ScanFn&& scan) {
+    // The limit would be exceeded if the scan wasn't cancelled
+    CappedMemoryPool pool(default_memory_pool(), 32 * kBatchSize * sizeof(int64_t));
+    StopSource stop_source;
+    ctx_->pool = &pool;
+    ctx_->stop_token = stop_source.token();
+    auto generator = std::make_shared<LargeBatchGenerator>(
+        schema_, &pool, kNumberBatches, kBatchSize, kStallAfter, stop_source.token());
+
+    std::thread canceller([&] {
+      while (generator->num_generated() < kStallAfter) {
+        SleepFor(1e-3);
+      }
+      stop_source.RequestStop();
+    });
+    {
+      Scanner scanner{std::make_shared<InMemoryDataset>(schema_, generator), options_,
+                      ctx_};
+      ASSERT_RAISES(Cancelled, scan(&scanner));
+    }
+    canceller.join();
+
+    ASSERT_GE(generator->num_generated(), kStallAfter);
+    ASSERT_LT(generator->num_generated(), kNumberBatches);
+    ASSERT_GT(pool.max_memory(), 0);
+    // All memory allocated by the scan was released
+    ASSERT_EQ(pool.bytes_allocated(), 0);
+  }
+};
+
+constexpr int64_t TestScannerCancellation::kNumberBatches;
+constexpr int64_t TestScannerCancellation::kBatchSize;
+constexpr int64_t TestScannerCancellation::kStallAfter;
+
+TEST_F(TestScannerCancellation, ToTable) {
+  for (bool use_threads : {false, true}) {
+    SCOPED_TRACE(use_threads);
+    ctx_->use_threads = use_threads;
+    AssertCancelledMidFlight(
+        [](Scanner* scanner) { return scanner->ToTable().status(); });
+  }
+}
+
+TEST_F(TestScannerCancellation, ScanBatches) {
+  ctx_->use_threads = true;
+  options_->batch_readahead = 2;
+  AssertCancelledMidFlight([](Scanner* scanner) -> Status {
+    ARROW_ASSIGN_OR_RAISE(auto reader, scanner->ScanBatches());
+    while (true) {
+      ARROW_ASSIGN_OR_RAISE(auto batch, reader->Next());
+      if (batch == nullptr) return Status::OK();
+    }
+  });
+}
+
+TEST_F(TestScannerCancellation, CountRows) {
+  AssertCancelledMidFlight(
+      [](Scanner* scanner) { return scanner->CountRows().status(); });
+}
+
 class TestScannerBuilder : public ::testing::Test {
   void SetUp() override {
     DatasetVector sources;
@@ -197,6 +560,61 @@ TEST_F(TestScannerBuilder, TestFilter) {
                                    equal(field_ref("not_a_column"), literal(true)))));
 }
 
+TEST_F(TestScannerBuilder, TestReadahead) {
+  ScannerBuilder builder(dataset_, ctx_);
+
+  ASSERT_OK(builder.BatchReadahead(1));
+  ASSERT_OK(builder.FragmentReadahead(4));
+  ASSERT_RAISES(Invalid, builder.BatchReadahead(0));
+  ASSERT_RAISES(Invalid, builder.FragmentReadahead(-1));
+
+  ASSERT_OK_AND_ASSIGN(auto scanner, builder.Finish());
+  ASSERT_EQ(scanner->options()->batch_readahead, 1);
+  ASSERT_EQ(scanner->options()->fragment_readahead, 4);
+
+  ASSERT_OK(builder.Project({"i8"}));
+  ASSERT_OK_AND_ASSIGN(scanner, builder.Finish());
+  ASSERT_EQ(scanner->options()->batch_readahead, 1);
+  ASSERT_EQ(scanner->options()->fragment_readahead, 4);
+}
+
+TEST_F(TestScannerBuilder, TestDictionaryEncode) {
+  constexpr int64_t kBatchSize = 1024;
+  auto dataset_schema = schema({field("i32", int32()), field("part", utf8())});
+  auto batch =
+      ConstantArrayGenerator::Zeroes(2 * kBatchSize, schema({field("i32", int32())}));
+  ASSERT_OK_AND_ASSIGN(auto partition,
+                       equal(field_ref("part"), literal("key")).Bind(*dataset_schema));
+  auto fragment = std::make_shared<InMemoryFragment>(RecordBatchVector{batch}, partition);
+
+  ScannerBuilder builder(dataset_schema, fragment, ctx_);
+  ASSERT_OK(builder.BatchSize(kBatchSize));
+  ASSERT_RAISES(Invalid, builder.DictionaryEncode({"not_found_column"}));
+  ASSERT_OK(builder.DictionaryEncode({"part"}));
+  ASSERT_OK_AND_ASSIGN(auto scanner, builder.Finish());
+
+  auto dict_type = dictionary(int32(), utf8());
+  AssertSchemaEqual(*scanner->schema(),
+                    *schema({field("i32", int32()), field("part", dict_type)}));
+
+  ASSERT_OK_AND_ASSIGN(auto table, scanner->ToTable());
+  ASSERT_OK(table->ValidateFull());
+  ASSERT_EQ(table->num_rows(), 2 * kBatchSize);
+
+  // each batch's partition column is a single entry dictionary and zeroed indices,
+  // which are shared by all batches of the scan task
+  auto part = table->GetColumnByName("part");
+  ASSERT_EQ(part->num_chunks(), 2);
+  ASSERT_OK_AND_ASSIGN(auto dictionary, MakeArrayFromScalar(StringScalar("key"), 1));
+  std::shared_ptr<Buffer> indices;
+  for (const auto& chunk : part->chunks()) {
+    const auto& dict_chunk = checked_cast<const DictionaryArray&>(*chunk);
+    AssertArraysEqual(*dictionary, *dict_chunk.dictionary());
+    if (indices == nullptr) indices = dict_chunk.indices()->data()->buffers[1];
+    ASSERT_EQ(dict_chunk.indices()->data()->buffers[1], indices);
+  }
+}
+
 using testing::ElementsAre;
 using testing::IsEmpty;
 
@@ -48,6 +48,7 @@ using FragmentVector = std::vector<std::shared_ptr<Fragment>>;
 
 class FileSource;
 class FileFormat;
+class ColumnChunkCache;
 class FileFragment;
 class FileWriter;
 class FileWriteOptions;
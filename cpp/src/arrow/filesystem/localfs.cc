@@ -36,6 +36,7 @@
 #include "arrow/util/io_util.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/uri.h"
+#include "arrow/util/value_parsing.h"
 #include "arrow/util/windows_fixup.h"
 
 namespace arrow {
@@ -236,7 +237,7 @@ LocalFileSystemOptions LocalFileSystemOptions::Defaults() {
 }
 
 bool LocalFileSystemOptions::Equals(const LocalFileSystemOptions& other) const {
-  return use_mmap == other.use_mmap;
+  return use_mmap == other.use_mmap && use_direct_io == other.use_direct_io;
 }
 
 Result<LocalFileSystemOptions> LocalFileSystemOptions::FromUri(
@@ -260,8 +261,24 @@ Result<LocalFileSystemOptions> LocalFileSystemOptions::FromUri(
     *out_path = uri.path();
   }
 
-  // TODO handle use_mmap option
-  return LocalFileSystemOptions();
+  LocalFileSystemOptions options;
+  ARROW_ASSIGN_OR_RAISE(const auto options_items, uri.query_items());
+  for (const auto& kv : options_items) {
+    bool* option;
+    if (kv.first == "use_mmap") {
+      option = &options.use_mmap;
+    } else if (kv.first == "use_direct_io") {
+      option = &options.use_direct_io;
+    } else {
+      return Status::Invalid("Unexpected query parameter in local URI: '", kv.first,
+                             "'");
+    }
+    const auto& v = kv.second;
+    if (!::arrow::internal::ParseValue<BooleanType>(v.data(), v.size(), option)) {
+      return Status::Invalid("Invalid value for option '", kv.first, "': '", v, "'");
+    }
+  }
+  return options;
 }
 
 LocalFileSystem::LocalFileSystem() : options_(LocalFileSystemOptions::Defaults()) {}
@@ -391,6 +408,8 @@ Result<std::shared_ptr<InputStreamType>> OpenInputStreamGeneric(
     const std::string& path, const LocalFileSystemOptions& options) {
   if (options.use_mmap) {
     return io::MemoryMappedFile::Open(path, io::FileMode::READ);
+  } else if (options.use_direct_io) {
+    return io::ReadableFile::OpenDirect(path);
   } else {
     return io::ReadableFile::Open(path);
   }
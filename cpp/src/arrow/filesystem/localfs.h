@@ -38,11 +38,20 @@ struct ARROW_EXPORT LocalFileSystemOptions {
   /// or a regular one.
   bool use_mmap = false;
 
+  /// Whether OpenInputStream and OpenInputFile return files bypassing the
+  /// OS page cache (see io::ReadableFile::OpenDirect).  Ignored if use_mmap
+  /// is true.
+  bool use_direct_io = false;
+
   /// \brief Initialize with defaults
   static LocalFileSystemOptions Defaults();
 
   bool Equals(const LocalFileSystemOptions& other) const;
 
+  /// \brief Initialize from a "file://" URI
+  ///
+  /// The boolean options above can be given as URI query parameters,
+  /// e.g. "file:///data/table?use_mmap=true".
   static Result<LocalFileSystemOptions> FromUri(const ::arrow::internal::Uri& uri,
                                                 std::string* out_path);
 };
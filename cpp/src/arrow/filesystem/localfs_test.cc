@@ -30,12 +30,14 @@
 #include "arrow/filesystem/test_util.h"
 #include "arrow/filesystem/util_internal.h"
 #include "arrow/testing/gtest_util.h"
+#include "arrow/util/checked_cast.h"
 #include "arrow/util/io_util.h"
 
 namespace arrow {
 namespace fs {
 namespace internal {
 
+using ::arrow::internal::checked_pointer_cast;
 using ::arrow::internal::PlatformFilename;
 using ::arrow::internal::TemporaryDir;
 
@@ -310,6 +312,21 @@ TYPED_TEST(TestLocalFS, FileSystemFromUriFile) {
   this->TestInvalidUri("file:foo/bar");
 }
 
+TYPED_TEST(TestLocalFS, FileSystemFromUriOptions) {
+  this->TestLocalUri("file:///foo/bar?use_mmap=true", "/foo/bar");
+  auto options = checked_pointer_cast<LocalFileSystem>(this->fs_)->options();
+  ASSERT_TRUE(options.use_mmap);
+  ASSERT_FALSE(options.use_direct_io);
+
+  this->TestLocalUri("file:///foo/bar?use_direct_io=1&use_mmap=false", "/foo/bar");
+  options = checked_pointer_cast<LocalFileSystem>(this->fs_)->options();
+  ASSERT_FALSE(options.use_mmap);
+  ASSERT_TRUE(options.use_direct_io);
+
+  this->TestInvalidUri("file:///foo/bar?use_mmap=maybe");
+  this->TestInvalidUri("file:///foo/bar?unknown_option=true");
+}
+
 TYPED_TEST(TestLocalFS, FileSystemFromUriNoScheme) {
   // Concrete test with actual file
   this->TestFileSystemFromUriOrPath(this->local_path_);
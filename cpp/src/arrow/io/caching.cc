@@ -148,6 +148,19 @@ struct ReadRangeCache::Impl {
       entries = std::move(new_entries);
     }
   }
+
+  // Find the entry containing the given range, or entries.end()
+  std::vector<RangeCacheEntry>::iterator FindEntry(const ReadRange& range) {
+    const auto it = std::lower_bound(
+        entries.begin(), entries.end(), range,
+        [](const RangeCacheEntry& entry, const ReadRange& range) {
+          return entry.range.offset + entry.range.length < range.offset + range.length;
+        });
+    if (it != entries.end() && it->range.Contains(range)) {
+      return it;
+    }
+    return entries.end();
+  }
 };
 
 ReadRangeCache::ReadRangeCache(std::shared_ptr<RandomAccessFile> file, AsyncContext ctx,
@@ -163,11 +176,11 @@ ReadRangeCache::~ReadRangeCache() = default;
 Status ReadRangeCache::Cache(std::vector<ReadRange> ranges) {
   ranges = internal::CoalesceReadRanges(std::move(ranges), impl_->options.hole_size_limit,
                                         impl_->options.range_size_limit);
+  auto futures = impl_->file->ReadManyAsync(impl_->ctx, ranges);
   std::vector<RangeCacheEntry> entries;
   entries.reserve(ranges.size());
-  for (const auto& range : ranges) {
-    auto fut = impl_->file->ReadAsync(impl_->ctx, range.offset, range.length);
-    entries.push_back({range, std::move(fut)});
+  for (size_t i = 0; i < ranges.size(); ++i) {
+    entries.push_back({ranges[i], std::move(futures[i])});
   }
 
   impl_->AddEntries(std::move(entries));
@@ -176,21 +189,51 @@ Status ReadRangeCache::Cache(std::vector<ReadRange> ranges) {
 }
 
 Result<std::shared_ptr<Buffer>> ReadRangeCache::Read(ReadRange range) {
+  return ReadAsync(range).result();
+}
+
+Future<std::shared_ptr<Buffer>> ReadRangeCache::ReadAsync(ReadRange range) {
   if (range.length == 0) {
     static const uint8_t byte = 0;
-    return std::make_shared<Buffer>(&byte, 0);
+    return Future<std::shared_ptr<Buffer>>::MakeFinished(
+        std::make_shared<Buffer>(&byte, 0));
+  }
+
+  const auto it = impl_->FindEntry(range);
+  if (it == impl_->entries.end()) {
+    return Future<std::shared_ptr<Buffer>>::MakeFinished(
+        Status::Invalid("ReadRangeCache did not find matching cache entry"));
   }
+  const int64_t offset = range.offset - it->range.offset;
+  const int64_t length = range.length;
+  return it->future.Then([offset, length](const std::shared_ptr<Buffer>& buf)
+                              -> Result<std::shared_ptr<Buffer>> {
+    return SliceBuffer(buf, offset, length);
+  });
+}
 
-  const auto it = std::lower_bound(
-      impl_->entries.begin(), impl_->entries.end(), range,
-      [](const RangeCacheEntry& entry, const ReadRange& range) {
-        return entry.range.offset + entry.range.length < range.offset + range.length;
-      });
-  if (it != impl_->entries.end() && it->range.Contains(range)) {
-    ARROW_ASSIGN_OR_RAISE(auto buf, it->future.result());
-    return SliceBuffer(std::move(buf), range.offset - it->range.offset, range.length);
+Future<> ReadRangeCache::Wait() {
+  std::vector<Future<>> futures;
+  futures.reserve(impl_->entries.size());
+  for (const auto& entry : impl_->entries) {
+    futures.emplace_back(entry.future);
+  }
+  return AllComplete(futures);
+}
+
+Future<> ReadRangeCache::WaitFor(std::vector<ReadRange> ranges) {
+  std::vector<Future<>> futures;
+  futures.reserve(ranges.size());
+  for (const auto& range : ranges) {
+    if (range.length == 0) continue;
+    const auto it = impl_->FindEntry(range);
+    if (it == impl_->entries.end()) {
+      return Future<>::MakeFinished(
+          Status::Invalid("ReadRangeCache did not find matching cache entry"));
+    }
+    futures.emplace_back(it->future);
   }
-  return Status::Invalid("ReadRangeCache did not find matching cache entry");
+  return AllComplete(futures);
 }
 
 }  // namespace internal
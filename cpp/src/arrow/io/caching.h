@@ -24,6 +24,7 @@
 #include <vector>
 
 #include "arrow/io/interfaces.h"
+#include "arrow/util/type_fwd.h"
 #include "arrow/util/visibility.h"
 
 namespace arrow {
@@ -97,8 +98,25 @@ class ARROW_EXPORT ReadRangeCache {
   Status Cache(std::vector<ReadRange> ranges);
 
   /// \brief Read a range previously given to Cache().
+  ///
+  /// This blocks until the range has been fetched; prefer ReadAsync() to avoid
+  /// tying up the calling thread.
   Result<std::shared_ptr<Buffer>> Read(ReadRange range);
 
+  /// \brief Read a range previously given to Cache(), asynchronously.
+  ///
+  /// The returned Future completes on the thread which fetched the range, typically
+  /// an IO thread; use Executor::Transfer() to continue on another executor.
+  Future<std::shared_ptr<Buffer>> ReadAsync(ReadRange range);
+
+  /// \brief Return a Future which completes when all cached ranges have been fetched.
+  Future<> Wait();
+
+  /// \brief Return a Future which completes when the given ranges have been fetched.
+  ///
+  /// The ranges must have been given to Cache() previously.
+  Future<> WaitFor(std::vector<ReadRange> ranges);
+
  protected:
   struct Impl;
   std::unique_ptr<Impl> impl_;
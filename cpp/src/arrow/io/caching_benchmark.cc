@@ -0,0 +1,142 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "benchmark/benchmark.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "arrow/buffer.h"
+#include "arrow/io/caching.h"
+#include "arrow/io/memory.h"
+#include "arrow/io/slow.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/util/future.h"
+#include "arrow/util/thread_pool.h"
+
+namespace arrow {
+namespace io {
+
+using ::arrow::internal::ThreadPool;
+
+static constexpr int64_t kNumRanges = 64;
+static constexpr int64_t kRangeSize = 64 * 1024;
+static constexpr double kReadLatency = 0.002;  // seconds
+static constexpr int kIoThreads = 16;
+
+// Some CPU work standing for the decoding of a fetched range
+static uint64_t Checksum(const Buffer& buffer) {
+  uint64_t checksum = 0;
+  for (int64_t i = 0; i < buffer.size(); ++i) {
+    checksum = checksum * 31 + buffer.data()[i];
+  }
+  return checksum;
+}
+
+struct CachingFixture {
+  CachingFixture() {
+    buffer = *AllocateBuffer(kNumRanges * 2 * kRangeSize);
+    std::fill(buffer->mutable_data(), buffer->mutable_data() + buffer->size(), 0x5a);
+    file = std::make_shared<SlowRandomAccessFile>(std::make_shared<BufferReader>(buffer),
+                                                  kReadLatency, /*seed=*/42);
+    io_pool = *ThreadPool::Make(kIoThreads);
+    // Leave holes between ranges so that they aren't coalesced
+    for (int64_t i = 0; i < kNumRanges; ++i) {
+      ranges.push_back({2 * i * kRangeSize, kRangeSize});
+    }
+  }
+
+  std::unique_ptr<internal::ReadRangeCache> MakeCache() {
+    CacheOptions options = CacheOptions::Defaults();
+    options.hole_size_limit = 0;
+    auto cache = std::unique_ptr<internal::ReadRangeCache>(
+        new internal::ReadRangeCache(file, AsyncContext(io_pool.get()), options));
+    ABORT_NOT_OK(cache->Cache(ranges));
+    return cache;
+  }
+
+  std::shared_ptr<Buffer> buffer;
+  std::shared_ptr<RandomAccessFile> file;
+  std::shared_ptr<ThreadPool> io_pool;
+  std::vector<ReadRange> ranges;
+};
+
+// Consume cached ranges from CPU tasks calling ReadRangeCache::Read(), which block
+// their thread until the range is fetched.
+static void ReadRangeCacheBlocking(
+    benchmark::State& state) {  // NOLINT non-const reference
+  const auto cpu_threads = static_cast<int>(state.range(0));
+  CachingFixture fixture;
+  auto cpu_pool = *ThreadPool::Make(cpu_threads);
+
+  std::atomic<int> blocked{0}, max_blocked{0};
+  for (auto _ : state) {
+    auto cache = fixture.MakeCache();
+    std::vector<Future<uint64_t>> checksums;
+    for (const auto& range : fixture.ranges) {
+      checksums.push_back(*cpu_pool->Submit([&, range]() -> Result<uint64_t> {
+        int n = ++blocked;
+        int max = max_blocked.load();
+        while (n > max && !max_blocked.compare_exchange_weak(max, n)) {
+        }
+        auto maybe_buffer = cache->Read(range);
+        --blocked;
+        ARROW_ASSIGN_OR_RAISE(auto buffer, maybe_buffer);
+        return Checksum(*buffer);
+      }));
+    }
+    for (const auto& checksum : checksums) {
+      ABORT_NOT_OK(checksum.status());
+    }
+  }
+
+  state.counters["blocked_threads"] = max_blocked.load();
+  state.SetBytesProcessed(state.iterations() * kNumRanges * kRangeSize);
+}
+
+// Consume cached ranges with continuations of ReadRangeCache::ReadAsync(), transferred
+// to the CPU pool: no thread waits for IO.
+static void ReadRangeCacheAsync(benchmark::State& state) {  // NOLINT non-const reference
+  const auto cpu_threads = static_cast<int>(state.range(0));
+  CachingFixture fixture;
+  auto cpu_pool = *ThreadPool::Make(cpu_threads);
+
+  for (auto _ : state) {
+    auto cache = fixture.MakeCache();
+    std::vector<Future<>> checksums;
+    for (const auto& range : fixture.ranges) {
+      auto checksum = cpu_pool->Transfer(cache->ReadAsync(range))
+                          .Then([](const std::shared_ptr<Buffer>& buffer) {
+                            benchmark::DoNotOptimize(Checksum(*buffer));
+                          });
+      checksums.push_back(std::move(checksum));
+    }
+    ABORT_NOT_OK(AllComplete(checksums).status());
+  }
+
+  state.counters["blocked_threads"] = 0;
+  state.SetBytesProcessed(state.iterations() * kNumRanges * kRangeSize);
+}
+
+BENCHMARK(ReadRangeCacheBlocking)->Arg(1)->Arg(4)->Arg(16)->UseRealTime();
+BENCHMARK(ReadRangeCacheAsync)->Arg(1)->Arg(4)->Arg(16)->UseRealTime();
+
+}  // namespace io
+}  // namespace arrow
@@ -19,6 +19,7 @@
 
 #include <algorithm>
 #include <cstring>
+#include <deque>
 #include <memory>
 #include <mutex>
 #include <string>
@@ -29,7 +30,9 @@
 #include "arrow/memory_pool.h"
 #include "arrow/status.h"
 #include "arrow/util/compression.h"
+#include "arrow/util/future.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/thread_pool.h"
 
 namespace arrow {
 
@@ -44,7 +47,20 @@ namespace io {
 
 class CompressedOutputStream::Impl {
  public:
-  Impl(MemoryPool* pool, const std::shared_ptr<OutputStream>& raw)
+  virtual ~Impl() = default;
+
+  virtual Result<int64_t> Tell() const = 0;
+  virtual std::shared_ptr<OutputStream> raw() const = 0;
+  virtual Status Write(const void* data, int64_t nbytes) = 0;
+  virtual Status Flush() = 0;
+  virtual Status Close() = 0;
+  virtual Status Abort() = 0;
+  virtual bool closed() = 0;
+};
+
+class CompressedOutputStream::SerialImpl : public CompressedOutputStream::Impl {
+ public:
+  SerialImpl(MemoryPool* pool, const std::shared_ptr<OutputStream>& raw)
       : pool_(pool), raw_(raw), is_open_(false), compressed_pos_(0), total_pos_(0) {}
 
   Status Init(Codec* codec) {
@@ -55,12 +71,12 @@ class CompressedOutputStream::Impl {
     return Status::OK();
   }
 
-  Result<int64_t> Tell() const {
+  Result<int64_t> Tell() const override {
     std::lock_guard<std::mutex> guard(lock_);
     return total_pos_;
   }
 
-  std::shared_ptr<OutputStream> raw() const { return raw_; }
+  std::shared_ptr<OutputStream> raw() const override { return raw_; }
 
   Status FlushCompressed() {
     if (compressed_pos_ > 0) {
@@ -70,7 +86,7 @@ class CompressedOutputStream::Impl {
     return Status::OK();
   }
 
-  Status Write(const void* data, int64_t nbytes) {
+  Status Write(const void* data, int64_t nbytes) override {
     std::lock_guard<std::mutex> guard(lock_);
 
     auto input = reinterpret_cast<const uint8_t*>(data);
@@ -108,7 +124,7 @@ class CompressedOutputStream::Impl {
     return Status::OK();
   }
 
-  Status Flush() {
+  Status Flush() override {
     std::lock_guard<std::mutex> guard(lock_);
 
     while (true) {
@@ -153,7 +169,7 @@ class CompressedOutputStream::Impl {
     return Status::OK();
   }
 
-  Status Close() {
+  Status Close() override {
     std::lock_guard<std::mutex> guard(lock_);
 
     if (is_open_) {
@@ -165,7 +181,7 @@ class CompressedOutputStream::Impl {
     }
   }
 
-  Status Abort() {
+  Status Abort() override {
     std::lock_guard<std::mutex> guard(lock_);
 
     if (is_open_) {
@@ -176,7 +192,7 @@ class CompressedOutputStream::Impl {
     }
   }
 
-  bool closed() {
+  bool closed() override {
     std::lock_guard<std::mutex> guard(lock_);
     return !is_open_;
   }
@@ -197,12 +213,236 @@ class CompressedOutputStream::Impl {
   mutable std::mutex lock_;
 };
 
+namespace {
+
+// Compress `input` as a standalone compressed stream
+Result<std::shared_ptr<Buffer>> CompressFrame(Codec* codec,
+                                              const std::shared_ptr<Buffer>& input,
+                                              MemoryPool* pool) {
+  ARROW_ASSIGN_OR_RAISE(auto compressor, codec->MakeCompressor());
+  ARROW_ASSIGN_OR_RAISE(
+      auto output,
+      AllocateResizableBuffer(codec->MaxCompressedLen(input->size(), input->data()) + 64,
+                              pool));
+  int64_t input_pos = 0;
+  int64_t output_pos = 0;
+
+  while (input_pos < input->size()) {
+    ARROW_ASSIGN_OR_RAISE(
+        auto result,
+        compressor->Compress(input->size() - input_pos, input->data() + input_pos,
+                             output->size() - output_pos,
+                             output->mutable_data() + output_pos));
+    input_pos += result.bytes_read;
+    output_pos += result.bytes_written;
+    if (result.bytes_read == 0) {
+      // Need to enlarge output buffer
+      RETURN_NOT_OK(output->Resize(output->size() * 2));
+    }
+  }
+  while (true) {
+    ARROW_ASSIGN_OR_RAISE(auto result,
+                          compressor->End(output->size() - output_pos,
+                                          output->mutable_data() + output_pos));
+    output_pos += result.bytes_written;
+    if (!result.should_retry) {
+      break;
+    }
+    RETURN_NOT_OK(output->Resize(output->size() * 2));
+  }
+  RETURN_NOT_OK(output->Resize(output_pos));
+  return std::move(output);
+}
+
+}  // namespace
+
+class CompressedOutputStream::ParallelImpl : public CompressedOutputStream::Impl {
+ public:
+  ParallelImpl(MemoryPool* pool, const std::shared_ptr<OutputStream>& raw, Codec* codec,
+               int64_t frame_size)
+      : pool_(pool),
+        raw_(raw),
+        codec_(codec),
+        frame_size_(frame_size),
+        executor_(::arrow::internal::GetCpuThreadPool()),
+        is_open_(false),
+        frame_pos_(0),
+        num_frames_(0),
+        total_pos_(0) {}
+
+  ~ParallelImpl() override {
+    // Compression tasks use the (non-owned) codec, wait for them
+    for (const auto& fut : pending_) {
+      fut.Wait();
+    }
+  }
+
+  Status Init() {
+    switch (codec_->compression_type()) {
+      case Compression::ZSTD:
+      case Compression::LZ4_FRAME:
+      case Compression::GZIP:
+      case Compression::BZ2:
+        break;
+      default:
+        return Status::NotImplemented("Parallel compression not supported for codec '",
+                                      codec_->name(), "'");
+    }
+    if (frame_size_ <= 0) {
+      return Status::Invalid("Compression frame size must be strictly positive");
+    }
+    // Bound the amount of compressed data in flight, while keeping all
+    // threads busy
+    max_pending_ = 2 * executor_->GetCapacity();
+    RETURN_NOT_OK(NewFrame());
+    is_open_ = true;
+    return Status::OK();
+  }
+
+  Result<int64_t> Tell() const override {
+    std::lock_guard<std::mutex> guard(lock_);
+    return total_pos_;
+  }
+
+  std::shared_ptr<OutputStream> raw() const override { return raw_; }
+
+  Status Write(const void* data, int64_t nbytes) override {
+    std::lock_guard<std::mutex> guard(lock_);
+
+    auto input = reinterpret_cast<const uint8_t*>(data);
+    while (nbytes > 0) {
+      const int64_t chunk_size = std::min(nbytes, frame_size_ - frame_pos_);
+      memcpy(frame_->mutable_data() + frame_pos_, input, static_cast<size_t>(chunk_size));
+      frame_pos_ += chunk_size;
+      input += chunk_size;
+      nbytes -= chunk_size;
+      total_pos_ += chunk_size;
+      if (frame_pos_ == frame_size_) {
+        RETURN_NOT_OK(SubmitFrame());
+        RETURN_NOT_OK(NewFrame());
+      }
+    }
+    return Status::OK();
+  }
+
+  Status Flush() override {
+    std::lock_guard<std::mutex> guard(lock_);
+
+    if (frame_pos_ > 0) {
+      RETURN_NOT_OK(SubmitFrame());
+      RETURN_NOT_OK(NewFrame());
+    }
+    return WriteFrames(/*max_pending=*/0);
+  }
+
+  Status Close() override {
+    std::lock_guard<std::mutex> guard(lock_);
+
+    if (is_open_) {
+      is_open_ = false;
+      // Always emit at least one frame, so that empty input produces a valid
+      // compressed stream
+      if (frame_pos_ > 0 || num_frames_ == 0) {
+        RETURN_NOT_OK(SubmitFrame());
+      }
+      frame_.reset();
+      RETURN_NOT_OK(WriteFrames(/*max_pending=*/0));
+      return raw_->Close();
+    } else {
+      return Status::OK();
+    }
+  }
+
+  Status Abort() override {
+    std::lock_guard<std::mutex> guard(lock_);
+
+    if (is_open_) {
+      is_open_ = false;
+      for (const auto& fut : pending_) {
+        fut.Wait();
+      }
+      pending_.clear();
+      frame_.reset();
+      return raw_->Abort();
+    } else {
+      return Status::OK();
+    }
+  }
+
+  bool closed() override {
+    std::lock_guard<std::mutex> guard(lock_);
+    return !is_open_;
+  }
+
+ private:
+  Status NewFrame() {
+    ARROW_ASSIGN_OR_RAISE(frame_, AllocateResizableBuffer(frame_size_, pool_));
+    frame_pos_ = 0;
+    return Status::OK();
+  }
+
+  // Hand the current frame to the thread pool
+  Status SubmitFrame() {
+    RETURN_NOT_OK(frame_->Resize(frame_pos_, /*shrink_to_fit=*/false));
+    std::shared_ptr<Buffer> frame = std::move(frame_);
+    ARROW_ASSIGN_OR_RAISE(auto fut, executor_->Submit(CompressFrame, codec_,
+                                                      std::move(frame), pool_));
+    pending_.push_back(std::move(fut));
+    ++num_frames_;
+    return WriteFrames(max_pending_);
+  }
+
+  // Write out compressed frames in order, waiting until at most `max_pending`
+  // frames remain in flight
+  Status WriteFrames(size_t max_pending) {
+    while (!pending_.empty() &&
+           (pending_.size() > max_pending || pending_.front().is_finished())) {
+      auto fut = std::move(pending_.front());
+      pending_.pop_front();
+      ARROW_ASSIGN_OR_RAISE(auto compressed, fut.result());
+      RETURN_NOT_OK(raw_->Write(compressed));
+    }
+    return Status::OK();
+  }
+
+  MemoryPool* pool_;
+  std::shared_ptr<OutputStream> raw_;
+  // Not owned
+  Codec* codec_;
+  const int64_t frame_size_;
+  ::arrow::internal::Executor* executor_;
+  size_t max_pending_;
+  bool is_open_;
+  // Uncompressed data for the frame being filled
+  std::shared_ptr<ResizableBuffer> frame_;
+  int64_t frame_pos_;
+  // Frames being compressed, in stream order
+  std::deque<Future<std::shared_ptr<Buffer>>> pending_;
+  int64_t num_frames_;
+  // Total number of bytes compressed
+  int64_t total_pos_;
+
+  mutable std::mutex lock_;
+};
+
 Result<std::shared_ptr<CompressedOutputStream>> CompressedOutputStream::Make(
     util::Codec* codec, const std::shared_ptr<OutputStream>& raw, MemoryPool* pool) {
   // CAUTION: codec is not owned
   std::shared_ptr<CompressedOutputStream> res(new CompressedOutputStream);
-  res->impl_.reset(new Impl(pool, std::move(raw)));
-  RETURN_NOT_OK(res->impl_->Init(codec));
+  auto impl = new SerialImpl(pool, std::move(raw));
+  res->impl_.reset(impl);
+  RETURN_NOT_OK(impl->Init(codec));
+  return res;
+}
+
+Result<std::shared_ptr<CompressedOutputStream>> CompressedOutputStream::MakeParallel(
+    util::Codec* codec, const std::shared_ptr<OutputStream>& raw, int64_t frame_size,
+    MemoryPool* pool) {
+  // CAUTION: codec is not owned
+  std::shared_ptr<CompressedOutputStream> res(new CompressedOutputStream);
+  auto impl = new ParallelImpl(pool, std::move(raw), codec, frame_size);
+  res->impl_.reset(impl);
+  RETURN_NOT_OK(impl->Init());
   return res;
 }
 
@@ -229,7 +469,20 @@ std::shared_ptr<OutputStream> CompressedOutputStream::raw() const { return impl_
 
 class CompressedInputStream::Impl {
  public:
-  Impl(MemoryPool* pool, const std::shared_ptr<InputStream>& raw)
+  virtual ~Impl() = default;
+
+  virtual Status Close() = 0;
+  virtual Status Abort() = 0;
+  virtual bool closed() = 0;
+  virtual Result<int64_t> Tell() const = 0;
+  virtual Result<int64_t> Read(int64_t nbytes, void* out) = 0;
+  virtual Result<std::shared_ptr<Buffer>> Read(int64_t nbytes) = 0;
+  virtual std::shared_ptr<InputStream> raw() const = 0;
+};
+
+class CompressedInputStream::SerialImpl : public CompressedInputStream::Impl {
+ public:
+  SerialImpl(MemoryPool* pool, const std::shared_ptr<InputStream>& raw)
       : pool_(pool),
         raw_(raw),
         is_open_(true),
@@ -243,7 +496,7 @@ class CompressedInputStream::Impl {
     return Status::OK();
   }
 
-  Status Close() {
+  Status Close() override {
     if (is_open_) {
       is_open_ = false;
       return raw_->Close();
@@ -252,7 +505,7 @@ class CompressedInputStream::Impl {
     }
   }
 
-  Status Abort() {
+  Status Abort() override {
     if (is_open_) {
       is_open_ = false;
       return raw_->Abort();
@@ -261,9 +514,9 @@ class CompressedInputStream::Impl {
     }
   }
 
-  bool closed() { return !is_open_; }
+  bool closed() override { return !is_open_; }
 
-  Result<int64_t> Tell() const { return total_pos_; }
+  Result<int64_t> Tell() const override { return total_pos_; }
 
   // Read compressed data if necessary
   Status EnsureCompressedData() {
@@ -354,7 +607,7 @@ class CompressedInputStream::Impl {
     return Status::OK();
   }
 
-  Result<int64_t> Read(int64_t nbytes, void* out) {
+  Result<int64_t> Read(int64_t nbytes, void* out) override {
     auto out_data = reinterpret_cast<uint8_t*>(out);
 
     int64_t total_read = 0;
@@ -376,14 +629,14 @@ class CompressedInputStream::Impl {
     return total_read;
   }
 
-  Result<std::shared_ptr<Buffer>> Read(int64_t nbytes) {
+  Result<std::shared_ptr<Buffer>> Read(int64_t nbytes) override {
     ARROW_ASSIGN_OR_RAISE(auto buf, AllocateResizableBuffer(nbytes, pool_));
     ARROW_ASSIGN_OR_RAISE(int64_t bytes_read, Read(nbytes, buf->mutable_data()));
     RETURN_NOT_OK(buf->Resize(bytes_read));
     return std::move(buf);
   }
 
-  std::shared_ptr<InputStream> raw() const { return raw_; }
+  std::shared_ptr<InputStream> raw() const override { return raw_; }
 
  private:
   // Read 64 KB compressed data at a time
@@ -407,14 +660,319 @@ class CompressedInputStream::Impl {
   int64_t total_pos_;
 };
 
+namespace {
+
+// Decompress a standalone compressed frame
+Result<std::shared_ptr<Buffer>> DecompressFrame(Codec* codec,
+                                                const std::shared_ptr<Buffer>& input,
+                                                MemoryPool* pool) {
+  ARROW_ASSIGN_OR_RAISE(auto decompressor, codec->MakeDecompressor());
+  ARROW_ASSIGN_OR_RAISE(
+      auto output,
+      AllocateResizableBuffer(std::max<int64_t>(4 * input->size(), 64 * 1024), pool));
+  int64_t input_pos = 0;
+  int64_t output_pos = 0;
+
+  while (true) {
+    if (output_pos == output->size()) {
+      RETURN_NOT_OK(output->Resize(output->size() * 2));
+    }
+    ARROW_ASSIGN_OR_RAISE(
+        auto result,
+        decompressor->Decompress(input->size() - input_pos, input->data() + input_pos,
+                                 output->size() - output_pos,
+                                 output->mutable_data() + output_pos));
+    input_pos += result.bytes_read;
+    output_pos += result.bytes_written;
+    if (decompressor->IsFinished()) {
+      break;
+    }
+    if (result.need_more_output) {
+      RETURN_NOT_OK(output->Resize(output->size() * 2));
+    } else if (result.bytes_read == 0 && result.bytes_written == 0) {
+      return Status::IOError("Truncated compressed stream");
+    }
+  }
+  RETURN_NOT_OK(output->Resize(output_pos));
+  return std::move(output);
+}
+
+}  // namespace
+
+class CompressedInputStream::ParallelImpl : public CompressedInputStream::Impl {
+ public:
+  ParallelImpl(MemoryPool* pool, const std::shared_ptr<InputStream>& raw, Codec* codec)
+      : pool_(pool),
+        raw_(raw),
+        codec_(codec),
+        executor_(::arrow::internal::GetCpuThreadPool()),
+        is_open_(true),
+        splittable_(true),
+        raw_eof_(false),
+        compressed_pos_(0),
+        decompressed_pos_(0),
+        total_pos_(0) {}
+
+  ~ParallelImpl() override { WaitPending(); }
+
+  Status Init() {
+    max_pending_ = 2 * executor_->GetCapacity();
+    return Status::OK();
+  }
+
+  Status Close() override {
+    if (is_open_) {
+      is_open_ = false;
+      WaitPending();
+      return raw_->Close();
+    } else {
+      return Status::OK();
+    }
+  }
+
+  Status Abort() override {
+    if (is_open_) {
+      is_open_ = false;
+      WaitPending();
+      return raw_->Abort();
+    } else {
+      return Status::OK();
+    }
+  }
+
+  bool closed() override { return !is_open_; }
+
+  Result<int64_t> Tell() const override { return total_pos_; }
+
+  Result<int64_t> Read(int64_t nbytes, void* out) override {
+    auto out_data = reinterpret_cast<uint8_t*>(out);
+
+    int64_t total_read = 0;
+    bool has_data = true;
+
+    while (nbytes - total_read > 0 && has_data) {
+      total_read += ReadFromDecompressed(nbytes - total_read, out_data + total_read);
+      if (nbytes == total_read) {
+        break;
+      }
+      RETURN_NOT_OK(RefillDecompressed(&has_data));
+    }
+
+    total_pos_ += total_read;
+    return total_read;
+  }
+
+  Result<std::shared_ptr<Buffer>> Read(int64_t nbytes) override {
+    if (decompressed_ && decompressed_->size() - decompressed_pos_ >= nbytes) {
+      // Zero-copy slice of the current decompressed frame
+      auto buf = SliceBuffer(decompressed_, decompressed_pos_, nbytes);
+      decompressed_pos_ += nbytes;
+      total_pos_ += nbytes;
+      return buf;
+    }
+    ARROW_ASSIGN_OR_RAISE(auto buf, AllocateResizableBuffer(nbytes, pool_));
+    ARROW_ASSIGN_OR_RAISE(int64_t bytes_read, Read(nbytes, buf->mutable_data()));
+    RETURN_NOT_OK(buf->Resize(bytes_read));
+    return std::move(buf);
+  }
+
+  std::shared_ptr<InputStream> raw() const override { return raw_; }
+
+ private:
+  // Read 1 MB compressed data at a time
+  static const int64_t kChunkSize = 1024 * 1024;
+  // Frames larger than this are decompressed serially, to bound memory usage
+  static const int64_t kMaxFrameSize = 16 * 1024 * 1024;
+  // Decompress 1 MB at a time when decompressing serially
+  static const int64_t kDecompressSize = 1024 * 1024;
+
+  void WaitPending() {
+    // Decompression tasks use the (non-owned) codec, wait for them
+    for (const auto& fut : pending_) {
+      fut.Wait();
+    }
+    pending_.clear();
+  }
+
+  int64_t CompressedAvailable() const {
+    return compressed_ ? compressed_->size() - compressed_pos_ : 0;
+  }
+
+  // Append a chunk of raw data to the compressed_ buffer
+  Status ReadCompressed() {
+    ARROW_ASSIGN_OR_RAISE(auto chunk, raw_->Read(kChunkSize));
+    if (chunk->size() == 0) {
+      raw_eof_ = true;
+      return Status::OK();
+    }
+    const int64_t avail = CompressedAvailable();
+    if (avail == 0) {
+      compressed_ = std::move(chunk);
+    } else {
+      ARROW_ASSIGN_OR_RAISE(auto combined, AllocateBuffer(avail + chunk->size(), pool_));
+      memcpy(combined->mutable_data(), compressed_->data() + compressed_pos_,
+             static_cast<size_t>(avail));
+      memcpy(combined->mutable_data() + avail, chunk->data(),
+             static_cast<size_t>(chunk->size()));
+      compressed_ = std::move(combined);
+    }
+    compressed_pos_ = 0;
+    return Status::OK();
+  }
+
+  // Submit complete frames for decompression, until enough are in flight
+  // or the next frame must be decompressed serially
+  Status ScheduleFrames() {
+    while (!decompressor_ && pending_.size() < max_pending_) {
+      const int64_t avail = CompressedAvailable();
+      if (avail == 0) {
+        if (raw_eof_) {
+          break;
+        }
+        RETURN_NOT_OK(ReadCompressed());
+        continue;
+      }
+      if (splittable_) {
+        auto maybe_frame_size =
+            codec_->FrameCompressedSize(avail, compressed_->data() + compressed_pos_);
+        if (maybe_frame_size.status().IsNotImplemented()) {
+          splittable_ = false;
+        } else {
+          ARROW_ASSIGN_OR_RAISE(const int64_t frame_size, maybe_frame_size);
+          if (frame_size > 0) {
+            auto frame = SliceBuffer(compressed_, compressed_pos_, frame_size);
+            compressed_pos_ += frame_size;
+            ARROW_ASSIGN_OR_RAISE(auto fut, executor_->Submit(DecompressFrame, codec_,
+                                                              std::move(frame), pool_));
+            pending_.push_back(std::move(fut));
+            continue;
+          }
+          if (!raw_eof_ && avail < kMaxFrameSize) {
+            // Incomplete frame
+            RETURN_NOT_OK(ReadCompressed());
+            continue;
+          }
+          // Frame is too large or truncated, fall back on serial decompression
+        }
+      }
+      ARROW_ASSIGN_OR_RAISE(decompressor_, codec_->MakeDecompressor());
+    }
+    return Status::OK();
+  }
+
+  // Decompress some data from the current frame using decompressor_
+  Status DecompressSerially() {
+    if (CompressedAvailable() == 0) {
+      RETURN_NOT_OK(ReadCompressed());
+      if (CompressedAvailable() == 0) {
+        return Status::IOError("Truncated compressed stream");
+      }
+    }
+    int64_t decompress_size = kDecompressSize;
+
+    while (true) {
+      ARROW_ASSIGN_OR_RAISE(auto output, AllocateResizableBuffer(decompress_size, pool_));
+
+      int64_t input_len = compressed_->size() - compressed_pos_;
+      const uint8_t* input = compressed_->data() + compressed_pos_;
+
+      ARROW_ASSIGN_OR_RAISE(auto result,
+                            decompressor_->Decompress(input_len, input, output->size(),
+                                                      output->mutable_data()));
+      compressed_pos_ += result.bytes_read;
+      if (result.bytes_written > 0 || !result.need_more_output || input_len == 0) {
+        RETURN_NOT_OK(output->Resize(result.bytes_written));
+        decompressed_ = std::move(output);
+        decompressed_pos_ = 0;
+        break;
+      }
+      // Need to enlarge output buffer
+      decompress_size *= 2;
+    }
+    if (decompressor_->IsFinished()) {
+      decompressor_.reset();
+    }
+    return Status::OK();
+  }
+
+  int64_t ReadFromDecompressed(int64_t nbytes, uint8_t* out) {
+    int64_t readable = decompressed_ ? (decompressed_->size() - decompressed_pos_) : 0;
+    int64_t read_bytes = std::min(readable, nbytes);
+
+    if (read_bytes > 0) {
+      memcpy(out, decompressed_->data() + decompressed_pos_, read_bytes);
+      decompressed_pos_ += read_bytes;
+
+      if (decompressed_pos_ == decompressed_->size()) {
+        // Decompressed data is exhausted, release buffer
+        decompressed_.reset();
+      }
+    }
+
+    return read_bytes;
+  }
+
+  Status RefillDecompressed(bool* has_data) {
+    RETURN_NOT_OK(ScheduleFrames());
+    if (!pending_.empty()) {
+      auto fut = std::move(pending_.front());
+      pending_.pop_front();
+      ARROW_ASSIGN_OR_RAISE(decompressed_, fut.result());
+      decompressed_pos_ = 0;
+      *has_data = true;
+      // Keep the pipeline full
+      return ScheduleFrames();
+    }
+    if (decompressor_) {
+      *has_data = true;
+      return DecompressSerially();
+    }
+    *has_data = false;
+    return Status::OK();
+  }
+
+  MemoryPool* pool_;
+  std::shared_ptr<InputStream> raw_;
+  // Not owned
+  Codec* codec_;
+  ::arrow::internal::Executor* executor_;
+  size_t max_pending_;
+  bool is_open_;
+  // Whether the codec can find frame boundaries
+  bool splittable_;
+  bool raw_eof_;
+  std::shared_ptr<Buffer> compressed_;
+  // Position in compressed buffer
+  int64_t compressed_pos_;
+  // Frames being decompressed, in stream order
+  std::deque<Future<std::shared_ptr<Buffer>>> pending_;
+  // Decompressor for the current frame, if decompressed serially
+  std::shared_ptr<Decompressor> decompressor_;
+  std::shared_ptr<Buffer> decompressed_;
+  // Position in decompressed buffer
+  int64_t decompressed_pos_;
+  // Total number of bytes decompressed
+  int64_t total_pos_;
+};
+
 Result<std::shared_ptr<CompressedInputStream>> CompressedInputStream::Make(
     Codec* codec, const std::shared_ptr<InputStream>& raw, MemoryPool* pool) {
   // CAUTION: codec is not owned
   std::shared_ptr<CompressedInputStream> res(new CompressedInputStream);
-  res->impl_.reset(new Impl(pool, std::move(raw)));
-  RETURN_NOT_OK(res->impl_->Init(codec));
+  auto impl = new SerialImpl(pool, std::move(raw));
+  res->impl_.reset(impl);
+  RETURN_NOT_OK(impl->Init(codec));
+  return res;
+}
+
+Result<std::shared_ptr<CompressedInputStream>> CompressedInputStream::MakeParallel(
+    Codec* codec, const std::shared_ptr<InputStream>& raw, MemoryPool* pool) {
+  // CAUTION: codec is not owned
+  std::shared_ptr<CompressedInputStream> res(new CompressedInputStream);
+  auto impl = new ParallelImpl(pool, std::move(raw), codec);
+  res->impl_.reset(impl);
+  RETURN_NOT_OK(impl->Init());
   return res;
-  return Status::OK();
 }
 
 CompressedInputStream::~CompressedInputStream() { internal::CloseFromDestructor(this); }
@@ -48,6 +48,22 @@ class ARROW_EXPORT CompressedOutputStream : public OutputStream {
       util::Codec* codec, const std::shared_ptr<OutputStream>& raw,
       MemoryPool* pool = default_memory_pool());
 
+  static constexpr int64_t kDefaultFrameSize = 1 << 20;
+
+  /// \brief Create a compressed output stream compressing in parallel
+  ///
+  /// The input is split into chunks of `frame_size` bytes which are compressed
+  /// as independent frames on the CPU thread pool, and written out in order.
+  /// The result is a valid compressed stream for codecs allowing concatenation
+  /// of compressed streams (ZSTD, LZ4_FRAME, GZIP, BZ2); other codecs are
+  /// rejected.  Compression ratio is slightly worse than with Make(), since
+  /// each frame is compressed without knowledge of previous data.
+  ///
+  /// Flush() waits for all pending frames to be compressed and written.
+  static Result<std::shared_ptr<CompressedOutputStream>> MakeParallel(
+      util::Codec* codec, const std::shared_ptr<OutputStream>& raw,
+      int64_t frame_size = kDefaultFrameSize, MemoryPool* pool = default_memory_pool());
+
   // OutputStream interface
 
   /// \brief Close the compressed output stream.  This implicitly closes the
@@ -73,6 +89,8 @@ class ARROW_EXPORT CompressedOutputStream : public OutputStream {
   CompressedOutputStream() = default;
 
   class ARROW_NO_EXPORT Impl;
+  class ARROW_NO_EXPORT SerialImpl;
+  class ARROW_NO_EXPORT ParallelImpl;
   std::unique_ptr<Impl> impl_;
 };
 
@@ -86,6 +104,18 @@ class ARROW_EXPORT CompressedInputStream
       util::Codec* codec, const std::shared_ptr<InputStream>& raw,
       MemoryPool* pool = default_memory_pool());
 
+  /// \brief Create a compressed input stream decompressing in parallel
+  ///
+  /// For codecs able to locate frame boundaries (ZSTD, LZ4_FRAME, see
+  /// util::Codec::FrameCompressedSize()), compressed frames are read ahead
+  /// and decompressed concurrently on the CPU thread pool.  This mostly
+  /// benefits streams written by CompressedOutputStream::MakeParallel();
+  /// frames larger than a few megabytes and other codecs are decompressed
+  /// serially, as with Make().
+  static Result<std::shared_ptr<CompressedInputStream>> MakeParallel(
+      util::Codec* codec, const std::shared_ptr<InputStream>& raw,
+      MemoryPool* pool = default_memory_pool());
+
   // InputStream interface
 
   bool closed() const override;
@@ -108,6 +138,8 @@ class ARROW_EXPORT CompressedInputStream
   Result<std::shared_ptr<Buffer>> DoRead(int64_t nbytes);
 
   class ARROW_NO_EXPORT Impl;
+  class ARROW_NO_EXPORT SerialImpl;
+  class ARROW_NO_EXPORT ParallelImpl;
   std::unique_ptr<Impl> impl_;
 };
 
@@ -80,10 +80,13 @@ std::shared_ptr<Buffer> CompressDataOneShot(Codec* codec,
 }
 
 Status RunCompressedInputStream(Codec* codec, std::shared_ptr<Buffer> compressed,
-                                int64_t* stream_pos, std::vector<uint8_t>* out) {
+                                int64_t* stream_pos, std::vector<uint8_t>* out,
+                                bool parallel = false) {
   // Create compressed input stream
   auto buffer_reader = std::make_shared<BufferReader>(compressed);
-  ARROW_ASSIGN_OR_RAISE(auto stream, CompressedInputStream::Make(codec, buffer_reader));
+  ARROW_ASSIGN_OR_RAISE(
+      auto stream, parallel ? CompressedInputStream::MakeParallel(codec, buffer_reader)
+                            : CompressedInputStream::Make(codec, buffer_reader));
 
   std::vector<uint8_t> decompressed;
   int64_t decompressed_size = 0;
@@ -106,17 +109,19 @@ Status RunCompressedInputStream(Codec* codec, std::shared_ptr<Buffer> compressed
 }
 
 Status RunCompressedInputStream(Codec* codec, std::shared_ptr<Buffer> compressed,
-                                std::vector<uint8_t>* out) {
-  return RunCompressedInputStream(codec, compressed, nullptr, out);
+                                std::vector<uint8_t>* out, bool parallel = false) {
+  return RunCompressedInputStream(codec, compressed, nullptr, out, parallel);
 }
 
-void CheckCompressedInputStream(Codec* codec, const std::vector<uint8_t>& data) {
+void CheckCompressedInputStream(Codec* codec, const std::vector<uint8_t>& data,
+                                bool parallel = false) {
   // Create compressed data
   auto compressed = CompressDataOneShot(codec, data);
 
   std::vector<uint8_t> decompressed;
   int64_t stream_pos = -1;
-  ASSERT_OK(RunCompressedInputStream(codec, compressed, &stream_pos, &decompressed));
+  ASSERT_OK(RunCompressedInputStream(codec, compressed, &stream_pos, &decompressed,
+                                     parallel));
 
   ASSERT_EQ(decompressed.size(), data.size());
   ASSERT_EQ(decompressed, data);
@@ -124,10 +129,15 @@ void CheckCompressedInputStream(Codec* codec, const std::vector<uint8_t>& data)
 }
 
 void CheckCompressedOutputStream(Codec* codec, const std::vector<uint8_t>& data,
-                                 bool do_flush) {
+                                 bool do_flush, bool parallel = false) {
   // Create compressed output stream
   ASSERT_OK_AND_ASSIGN(auto buffer_writer, BufferOutputStream::Create());
-  ASSERT_OK_AND_ASSIGN(auto stream, CompressedOutputStream::Make(codec, buffer_writer));
+  // Use small frames to exercise the parallel compression pipeline
+  const int64_t frame_size = 100 * 1000;
+  ASSERT_OK_AND_ASSIGN(
+      auto stream, parallel ? CompressedOutputStream::MakeParallel(codec, buffer_writer,
+                                                                   frame_size)
+                            : CompressedOutputStream::Make(codec, buffer_writer));
   ASSERT_OK_AND_EQ(0, stream->Tell());
 
   const uint8_t* input = data.data();
@@ -147,6 +157,17 @@ void CheckCompressedOutputStream(Codec* codec, const std::vector<uint8_t>& data,
 
   // Get compressed data and decompress it
   ASSERT_OK_AND_ASSIGN(auto compressed, buffer_writer->Finish());
+  if (parallel) {
+    // The output is made of several frames, which one-shot decompression
+    // doesn't support
+    for (bool parallel_read : {false, true}) {
+      std::vector<uint8_t> decompressed;
+      ASSERT_OK(
+          RunCompressedInputStream(codec, compressed, &decompressed, parallel_read));
+      ASSERT_EQ(decompressed, data);
+    }
+    return;
+  }
   std::vector<uint8_t> decompressed(data.size());
   ASSERT_OK(codec->Decompress(compressed->size(), compressed->data(), decompressed.size(),
                               decompressed.data()));
@@ -221,6 +242,35 @@ TEST_P(CompressedInputStreamTest, ConcatenatedStreams) {
   ASSERT_EQ(decompressed, expected);
 }
 
+TEST_P(CompressedInputStreamTest, Parallel) {
+  auto codec = MakeCodec();
+  CheckCompressedInputStream(codec.get(), MakeCompressibleData(COMPRESSIBLE_DATA_SIZE),
+                             /*parallel=*/true);
+  CheckCompressedInputStream(codec.get(), MakeRandomData(RANDOM_DATA_SIZE),
+                             /*parallel=*/true);
+
+  // Truncated data
+  auto data = MakeRandomData(10000);
+  auto compressed = CompressDataOneShot(codec.get(), data);
+  auto truncated = SliceBuffer(compressed, 0, compressed->size() - 3);
+  std::vector<uint8_t> decompressed;
+  ASSERT_RAISES(IOError, RunCompressedInputStream(codec.get(), truncated, &decompressed,
+                                                  /*parallel=*/true));
+
+  // Concatenated streams
+  std::vector<std::shared_ptr<Buffer>> buffers;
+  std::vector<uint8_t> expected;
+  for (int i = 0; i < 50; ++i) {
+    auto chunk = MakeCompressibleData(100 + i * 50);
+    buffers.push_back(CompressDataOneShot(codec.get(), chunk));
+    std::copy(chunk.begin(), chunk.end(), std::back_inserter(expected));
+  }
+  ASSERT_OK_AND_ASSIGN(auto concatenated, ConcatenateBuffers(buffers));
+  ASSERT_OK(RunCompressedInputStream(codec.get(), concatenated, &decompressed,
+                                     /*parallel=*/true));
+  ASSERT_EQ(decompressed, expected);
+}
+
 TEST_P(CompressedOutputStreamTest, CompressibleData) {
   auto codec = MakeCodec();
   auto data = MakeCompressibleData(COMPRESSIBLE_DATA_SIZE);
@@ -237,6 +287,26 @@ TEST_P(CompressedOutputStreamTest, RandomData) {
   CheckCompressedOutputStream(codec.get(), data, true /* do_flush */);
 }
 
+TEST_P(CompressedOutputStreamTest, Parallel) {
+  auto codec = MakeCodec();
+  if (GetCompression() == Compression::BROTLI) {
+    ASSERT_OK_AND_ASSIGN(auto buffer_writer, BufferOutputStream::Create());
+    ASSERT_RAISES(NotImplemented,
+                  CompressedOutputStream::MakeParallel(codec.get(), buffer_writer));
+    return;
+  }
+  auto data = MakeCompressibleData(COMPRESSIBLE_DATA_SIZE);
+  CheckCompressedOutputStream(codec.get(), data, /*do_flush=*/false, /*parallel=*/true);
+  data = MakeRandomData(RANDOM_DATA_SIZE);
+  CheckCompressedOutputStream(codec.get(), data, /*do_flush=*/false, /*parallel=*/true);
+  // Each flush ends a frame, keep the number of frames reasonable
+  data = MakeCompressibleData(200 * 1000);
+  CheckCompressedOutputStream(codec.get(), data, /*do_flush=*/true, /*parallel=*/true);
+
+  // Empty stream
+  CheckCompressedOutputStream(codec.get(), {}, /*do_flush=*/false, /*parallel=*/true);
+}
+
 // NOTES:
 // - Snappy doesn't support streaming decompression
 // - BZ2 doesn't support one-shot compression
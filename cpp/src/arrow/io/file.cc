@@ -36,6 +36,7 @@
 #include <cerrno>
 #include <cstdint>
 #include <cstring>
+#include <map>
 #include <memory>
 #include <mutex>
 #include <sstream>
@@ -47,17 +48,20 @@
 
 #include "arrow/io/file.h"
 #include "arrow/io/interfaces.h"
+#include "arrow/io/uring_internal.h"
 #include "arrow/io/util_internal.h"
 
 #include "arrow/buffer.h"
 #include "arrow/memory_pool.h"
 #include "arrow/status.h"
+#include "arrow/util/checked_cast.h"
 #include "arrow/util/future.h"
 #include "arrow/util/io_util.h"
 #include "arrow/util/logging.h"
 
 namespace arrow {
 
+using internal::checked_pointer_cast;
 using internal::IOErrorFromErrno;
 
 namespace io {
@@ -233,6 +237,138 @@ class OSFile {
   std::atomic<bool> need_seeking_;
 };
 
+// ----------------------------------------------------------------------
+// Aligned buffers for direct I/O
+
+namespace {
+
+// Direct I/O requires file offsets, read lengths and memory addresses to be
+// aligned on the logical block size of the underlying device.  4096 is a
+// multiple of all common block sizes.
+constexpr int64_t kDirectIOAlignment = 4096;
+
+// The maximum number of bytes retained for reuse by an AlignedBufferPool
+constexpr int64_t kMaxRetainedAlignedBytes = 16 * 1024 * 1024;
+
+int64_t AlignDown(int64_t value) { return value & ~(kDirectIOAlignment - 1); }
+
+int64_t AlignUp(int64_t value) { return AlignDown(value + kDirectIOAlignment - 1); }
+
+// A pool of aligned memory blocks allocated from a MemoryPool.  Freed blocks
+// are recycled, so that large scans don't pay for allocation and page faults
+// on every read.
+class AlignedBufferPool : public std::enable_shared_from_this<AlignedBufferPool> {
+ public:
+  explicit AlignedBufferPool(MemoryPool* pool) : pool_(pool) {}
+
+  ~AlignedBufferPool() {
+    for (const auto& block : free_blocks_) {
+      pool_->Free(block.second, block.first + kDirectIOAlignment);
+    }
+  }
+
+  // Allocate a buffer of the given size; its capacity is rounded up to the alignment
+  Result<std::shared_ptr<ResizableBuffer>> Allocate(int64_t size);
+
+  void Release(uint8_t* raw_data, int64_t capacity) {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (retained_bytes_ + capacity <= kMaxRetainedAlignedBytes) {
+        free_blocks_.emplace(capacity, raw_data);
+        retained_bytes_ += capacity;
+        return;
+      }
+    }
+    pool_->Free(raw_data, capacity + kDirectIOAlignment);
+  }
+
+ private:
+  MemoryPool* pool_;
+  std::mutex mutex_;
+  // Free blocks, keyed by capacity
+  std::multimap<int64_t, uint8_t*> free_blocks_;
+  int64_t retained_bytes_ = 0;
+};
+
+class AlignedBuffer : public ResizableBuffer {
+ public:
+  AlignedBuffer(std::shared_ptr<AlignedBufferPool> pool, uint8_t* raw_data,
+                int64_t capacity)
+      : ResizableBuffer(AlignData(raw_data), 0),
+        pool_(std::move(pool)),
+        raw_data_(raw_data) {
+    capacity_ = capacity;
+  }
+
+  ~AlignedBuffer() override { pool_->Release(raw_data_, capacity_); }
+
+  Status Resize(const int64_t new_size, bool shrink_to_fit = true) override {
+    RETURN_NOT_OK(Reserve(new_size));
+    size_ = new_size;
+    return Status::OK();
+  }
+
+  Status Reserve(const int64_t new_capacity) override {
+    if (new_capacity > capacity_) {
+      return Status::Invalid("Cannot grow a direct I/O buffer");
+    }
+    return Status::OK();
+  }
+
+ private:
+  static uint8_t* AlignData(uint8_t* raw_data) {
+    const auto addr = reinterpret_cast<uintptr_t>(raw_data);
+    return reinterpret_cast<uint8_t*>((addr + kDirectIOAlignment - 1) &
+                                      ~static_cast<uintptr_t>(kDirectIOAlignment - 1));
+  }
+
+  std::shared_ptr<AlignedBufferPool> pool_;
+  uint8_t* raw_data_;
+};
+
+Result<std::shared_ptr<ResizableBuffer>> AlignedBufferPool::Allocate(int64_t size) {
+  const int64_t capacity = std::max(AlignUp(size), kDirectIOAlignment);
+  uint8_t* raw_data = nullptr;
+  int64_t raw_capacity = capacity;
+  {
+    // Reuse the smallest free block that is large enough, but not wastefully so
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = free_blocks_.lower_bound(capacity);
+    if (it != free_blocks_.end() && it->first <= 2 * capacity) {
+      raw_capacity = it->first;
+      raw_data = it->second;
+      retained_bytes_ -= raw_capacity;
+      free_blocks_.erase(it);
+    }
+  }
+  if (raw_data == nullptr) {
+    // MemoryPool allocations are only 64-byte aligned: over-allocate
+    RETURN_NOT_OK(pool_->Allocate(raw_capacity + kDirectIOAlignment, &raw_data));
+  }
+  auto buffer =
+      std::make_shared<AlignedBuffer>(shared_from_this(), raw_data, raw_capacity);
+  RETURN_NOT_OK(buffer->Resize(size));
+  return std::move(buffer);
+}
+
+// Slice the requested range out of a (possibly short) aligned read
+std::shared_ptr<Buffer> SliceAligned(std::shared_ptr<Buffer> buffer, int64_t offset,
+                                     int64_t nbytes) {
+  const int64_t size = buffer->size();
+  const int64_t available = std::max<int64_t>(0, size - offset);
+  return SliceBuffer(std::move(buffer), std::min(offset, size),
+                     std::min(nbytes, available));
+}
+
+Future<std::shared_ptr<Buffer>> SliceAlignedAsync(Future<std::shared_ptr<Buffer>> fut,
+                                                  int64_t offset, int64_t nbytes) {
+  return fut.Then([offset, nbytes](const std::shared_ptr<Buffer>& buffer) {
+    return SliceAligned(buffer, offset, nbytes);
+  });
+}
+
+}  // namespace
+
 // ----------------------------------------------------------------------
 // ReadableFile implementation
 
@@ -240,10 +376,48 @@ class ReadableFile::ReadableFileImpl : public OSFile {
  public:
   explicit ReadableFileImpl(MemoryPool* pool) : OSFile(), pool_(pool) {}
 
-  Status Open(const std::string& path) { return OpenReadable(path); }
+  Status Open(const std::string& path, bool direct_io = false) {
+    RETURN_NOT_OK(OpenReadable(path));
+    if (direct_io) {
+      RETURN_NOT_OK(EnableDirectIO());
+    }
+    return Status::OK();
+  }
   Status Open(int fd) { return OpenReadable(fd); }
 
+  bool direct_io() const { return aligned_pool_ != nullptr; }
+
+  Result<int64_t> Read(int64_t nbytes, void* out) {
+    if (!direct_io()) {
+      return OSFile::Read(nbytes, out);
+    }
+    RETURN_NOT_OK(CheckClosed());
+    RETURN_NOT_OK(CheckPositioned());
+    ARROW_ASSIGN_OR_RAISE(auto position, Tell());
+    ARROW_ASSIGN_OR_RAISE(auto buffer, ReadAlignedAt(position, nbytes));
+    std::memcpy(out, buffer->data(), static_cast<size_t>(buffer->size()));
+    RETURN_NOT_OK(::arrow::internal::FileSeek(fd_, position + buffer->size()));
+    return buffer->size();
+  }
+
+  Result<int64_t> ReadAt(int64_t position, int64_t nbytes, void* out) {
+    if (!direct_io()) {
+      return OSFile::ReadAt(position, nbytes, out);
+    }
+    ARROW_ASSIGN_OR_RAISE(auto buffer, ReadBufferAt(position, nbytes));
+    std::memcpy(out, buffer->data(), static_cast<size_t>(buffer->size()));
+    return buffer->size();
+  }
+
   Result<std::shared_ptr<Buffer>> ReadBuffer(int64_t nbytes) {
+    if (direct_io()) {
+      RETURN_NOT_OK(CheckClosed());
+      RETURN_NOT_OK(CheckPositioned());
+      ARROW_ASSIGN_OR_RAISE(auto position, Tell());
+      ARROW_ASSIGN_OR_RAISE(auto buffer, ReadAlignedAt(position, nbytes));
+      RETURN_NOT_OK(::arrow::internal::FileSeek(fd_, position + buffer->size()));
+      return buffer;
+    }
     ARROW_ASSIGN_OR_RAISE(auto buffer, AllocateResizableBuffer(nbytes, pool_));
 
     ARROW_ASSIGN_OR_RAISE(int64_t bytes_read, Read(nbytes, buffer->mutable_data()));
@@ -255,6 +429,12 @@ class ReadableFile::ReadableFileImpl : public OSFile {
   }
 
   Result<std::shared_ptr<Buffer>> ReadBufferAt(int64_t position, int64_t nbytes) {
+    if (direct_io()) {
+      RETURN_NOT_OK(CheckClosed());
+      RETURN_NOT_OK(internal::ValidateRange(position, nbytes));
+      need_seeking_.store(true);
+      return ReadAlignedAt(position, nbytes);
+    }
     ARROW_ASSIGN_OR_RAISE(auto buffer, AllocateResizableBuffer(nbytes, pool_));
 
     ARROW_ASSIGN_OR_RAISE(int64_t bytes_read,
@@ -266,10 +446,72 @@ class ReadableFile::ReadableFileImpl : public OSFile {
     return std::move(buffer);
   }
 
+  std::vector<Future<std::shared_ptr<Buffer>>> ReadManyAsync(
+      internal::IoUring* ring, const std::vector<ReadRange>& ranges,
+      std::shared_ptr<ReadableFile> owner) {
+    std::vector<Future<std::shared_ptr<Buffer>>> futures(ranges.size());
+    // Invalid ranges only fail their own Future, the other ones are still read
+    std::vector<ReadRange> valid_ranges;
+    std::vector<size_t> valid_indices;
+    valid_ranges.reserve(ranges.size());
+    valid_indices.reserve(ranges.size());
+    const Status closed_st = CheckClosed();
+    for (size_t i = 0; i < ranges.size(); ++i) {
+      Status st = closed_st.ok()
+                      ? internal::ValidateRange(ranges[i].offset, ranges[i].length)
+                      : closed_st;
+      if (st.ok()) {
+        valid_ranges.push_back(ranges[i]);
+        valid_indices.push_back(i);
+      } else {
+        futures[i] = Future<std::shared_ptr<Buffer>>::MakeFinished(std::move(st));
+      }
+    }
+    if (valid_ranges.empty()) {
+      return futures;
+    }
+    // ReadAt() leaves the file position undefined
+    need_seeking_.store(true);
+    if (!direct_io()) {
+      // The file may have grown since it was opened, let EOF decide the lengths
+      auto valid_futures = ring->SubmitReads(fd_, /*file_size=*/-1, valid_ranges, pool_,
+                                             std::move(owner));
+      for (size_t i = 0; i < valid_futures.size(); ++i) {
+        futures[valid_indices[i]] = std::move(valid_futures[i]);
+      }
+      return futures;
+    }
+
+    // Read the enclosing aligned ranges, then slice the results
+    std::vector<ReadRange> aligned_ranges;
+    aligned_ranges.reserve(valid_ranges.size());
+    for (const auto& range : valid_ranges) {
+      const int64_t start = AlignDown(range.offset);
+      aligned_ranges.push_back({start, AlignUp(range.offset + range.length) - start});
+    }
+    std::shared_ptr<AlignedBufferPool> aligned_pool = aligned_pool_;
+    auto aligned_futures = ring->SubmitReads(
+        fd_, size_, aligned_ranges,
+        [aligned_pool](int64_t size) { return aligned_pool->Allocate(size); },
+        std::move(owner));
+    for (size_t i = 0; i < aligned_futures.size(); ++i) {
+      const auto& range = valid_ranges[i];
+      futures[valid_indices[i]] =
+          SliceAlignedAsync(std::move(aligned_futures[i]),
+                            range.offset - aligned_ranges[i].offset, range.length);
+    }
+    return futures;
+  }
+
   Status WillNeed(const std::vector<ReadRange>& ranges) {
     RETURN_NOT_OK(CheckClosed());
     for (const auto& range : ranges) {
       RETURN_NOT_OK(internal::ValidateRange(range.offset, range.length));
+      if (direct_io()) {
+        // Direct reads don't go through the page cache, prefetching into it
+        // would be counter-productive.  Use ReadAsync() instead.
+        continue;
+      }
 #if defined(POSIX_FADV_WILLNEED)
       if (posix_fadvise(fd_, range.offset, range.length, POSIX_FADV_WILLNEED)) {
         return IOErrorFromErrno(errno, "posix_fadvise failed");
@@ -288,7 +530,74 @@ class ReadableFile::ReadableFileImpl : public OSFile {
   }
 
  private:
+  Status EnableDirectIO() {
+#if defined(O_DIRECT)
+    const int flags = fcntl(fd_, F_GETFL);
+    if (flags == -1) {
+      return IOErrorFromErrno(errno, "fcntl(fd, F_GETFL) failed");
+    }
+    if (fcntl(fd_, F_SETFL, flags | O_DIRECT) == -1) {
+      // Some filesystems (e.g. tmpfs) don't support direct I/O
+      if (errno == EINVAL) {
+        return Status::OK();
+      }
+      return IOErrorFromErrno(errno, "fcntl(fd, F_SETFL, O_DIRECT) failed");
+    }
+#elif defined(F_NOCACHE)  // macOS
+    if (fcntl(fd_, F_NOCACHE, 1) == -1) {
+      return IOErrorFromErrno(errno, "fcntl(fd, F_NOCACHE, 1) failed");
+    }
+#else
+    // Unsupported platform: reads go through the page cache
+    return Status::OK();
+#endif
+    aligned_pool_ = std::make_shared<AlignedBufferPool>(pool_);
+    return Status::OK();
+  }
+
+  // Read the aligned range enclosing [position, position + nbytes) and return
+  // a slice of it.
+  Result<std::shared_ptr<Buffer>> ReadAlignedAt(int64_t position, int64_t nbytes) {
+    const int64_t start = AlignDown(position);
+    const int64_t end = AlignUp(position + nbytes);
+    ARROW_ASSIGN_OR_RAISE(auto buffer, aligned_pool_->Allocate(end - start));
+    ARROW_ASSIGN_OR_RAISE(auto bytes_read,
+                          ReadDirect(start, end - start, buffer->mutable_data()));
+    RETURN_NOT_OK(buffer->Resize(bytes_read));
+    return SliceAligned(std::move(buffer), position - start, nbytes);
+  }
+
+  // Like FileReadAt(), but doesn't attempt reading at EOF, where the
+  // position might not be aligned anymore.
+  Result<int64_t> ReadDirect(int64_t position, int64_t nbytes, uint8_t* out) {
+#ifdef _WIN32
+    return Status::NotImplemented("Direct I/O is not supported on Windows");
+#else
+    const int64_t expected = std::max<int64_t>(0, std::min(nbytes, size_ - position));
+    int64_t bytes_read = 0;
+    while (bytes_read < expected) {
+      // Keep chunks aligned, and below the Linux limit of 0x7ffff000 bytes per read
+      const int64_t chunk_size = std::min<int64_t>(nbytes - bytes_read, 1LL << 30);
+      const auto ret = pread(fd_, out + bytes_read, static_cast<size_t>(chunk_size),
+                             static_cast<off_t>(position + bytes_read));
+      if (ret == -1) {
+        if (errno == EINTR) {
+          continue;
+        }
+        return IOErrorFromErrno(errno, "Error reading bytes from file");
+      }
+      if (ret == 0) {
+        break;
+      }
+      bytes_read += ret;
+    }
+    return bytes_read;
+#endif
+  }
+
   MemoryPool* pool_;
+  // Non-null iff reads bypass the page cache
+  std::shared_ptr<AlignedBufferPool> aligned_pool_;
 };
 
 ReadableFile::ReadableFile(MemoryPool* pool) { impl_.reset(new ReadableFileImpl(pool)); }
@@ -302,6 +611,13 @@ Result<std::shared_ptr<ReadableFile>> ReadableFile::Open(const std::string& path
   return file;
 }
 
+Result<std::shared_ptr<ReadableFile>> ReadableFile::OpenDirect(const std::string& path,
+                                                               MemoryPool* pool) {
+  auto file = std::shared_ptr<ReadableFile>(new ReadableFile(pool));
+  RETURN_NOT_OK(file->impl_->Open(path, /*direct_io=*/true));
+  return file;
+}
+
 Result<std::shared_ptr<ReadableFile>> ReadableFile::Open(int fd, MemoryPool* pool) {
   auto file = std::shared_ptr<ReadableFile>(new ReadableFile(pool));
   RETURN_NOT_OK(file->impl_->Open(fd));
@@ -316,6 +632,28 @@ Status ReadableFile::WillNeed(const std::vector<ReadRange>& ranges) {
   return impl_->WillNeed(ranges);
 }
 
+Future<std::shared_ptr<Buffer>> ReadableFile::ReadAsync(const AsyncContext& ctx,
+                                                        int64_t position,
+                                                        int64_t nbytes) {
+  auto ring = internal::IoUring::GetInstance();
+  if (ring == nullptr) {
+    return RandomAccessFile::ReadAsync(ctx, position, nbytes);
+  }
+  auto futures = impl_->ReadManyAsync(
+      ring, {{position, nbytes}}, checked_pointer_cast<ReadableFile>(shared_from_this()));
+  return std::move(futures[0]);
+}
+
+std::vector<Future<std::shared_ptr<Buffer>>> ReadableFile::ReadManyAsync(
+    const AsyncContext& ctx, const std::vector<ReadRange>& ranges) {
+  auto ring = internal::IoUring::GetInstance();
+  if (ring == nullptr) {
+    return RandomAccessFile::ReadManyAsync(ctx, ranges);
+  }
+  return impl_->ReadManyAsync(ring, ranges,
+                              checked_pointer_cast<ReadableFile>(shared_from_this()));
+}
+
 Result<int64_t> ReadableFile::DoTell() const { return impl_->Tell(); }
 
 Result<int64_t> ReadableFile::DoRead(int64_t nbytes, void* out) {
@@ -340,6 +678,8 @@ Status ReadableFile::DoSeek(int64_t pos) { return impl_->Seek(pos); }
 
 int ReadableFile::file_descriptor() const { return impl_->fd(); }
 
+bool ReadableFile::direct_io() const { return impl_->direct_io(); }
+
 // ----------------------------------------------------------------------
 // FileOutputStream
 
@@ -97,6 +97,22 @@ class ARROW_EXPORT ReadableFile
   static Result<std::shared_ptr<ReadableFile>> Open(
       const std::string& path, MemoryPool* pool = default_memory_pool());
 
+  /// \brief Open a local file for reading, bypassing the OS page cache
+  /// \param[in] path with UTF8 encoding
+  /// \param[in] pool a MemoryPool for memory allocations
+  /// \return ReadableFile instance
+  ///
+  /// Reads use direct I/O (O_DIRECT on Linux, F_NOCACHE on macOS), so that
+  /// large scans neither evict other data from the page cache nor pay for
+  /// an extra copy out of it.  Reads are widened to aligned ranges using a
+  /// recycled pool of aligned buffers; the Buffers returned by ReadAt() and
+  /// ReadAsync() are zero-copy slices of them.
+  ///
+  /// If the platform or filesystem doesn't support direct I/O, the file is
+  /// read through the page cache instead (see direct_io()).
+  static Result<std::shared_ptr<ReadableFile>> OpenDirect(
+      const std::string& path, MemoryPool* pool = default_memory_pool());
+
   /// \brief Open a local file for reading
   /// \param[in] fd file descriptor
   /// \param[in] pool a MemoryPool for memory allocations
@@ -111,6 +127,24 @@ class ARROW_EXPORT ReadableFile
 
   int file_descriptor() const;
 
+  /// \brief Whether reads bypass the OS page cache
+  bool direct_io() const;
+
+  /// \brief Read data asynchronously
+  ///
+  /// On Linux, if supported by the running kernel, the read is submitted
+  /// to a process-wide io_uring instance and doesn't occupy a thread of the
+  /// context's executor while in flight.  Otherwise, this falls back on the
+  /// default executor-based implementation.
+  Future<std::shared_ptr<Buffer>> ReadAsync(const AsyncContext& ctx, int64_t position,
+                                            int64_t nbytes) override;
+
+  /// \brief Read data asynchronously for several ranges at once
+  ///
+  /// When io_uring is used, all reads are submitted in a single batch.
+  std::vector<Future<std::shared_ptr<Buffer>>> ReadManyAsync(
+      const AsyncContext& ctx, const std::vector<ReadRange>& ranges) override;
+
   Status WillNeed(const std::vector<ReadRange>& ranges) override;
 
  private:
@@ -17,7 +17,9 @@
 
 #include "arrow/io/buffered.h"
 #include "arrow/io/file.h"
+#include "arrow/io/uring_internal.h"
 #include "arrow/testing/gtest_util.h"
+#include "arrow/util/future.h"
 #include "arrow/util/io_util.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/windows_compatibility.h"
@@ -28,6 +30,7 @@
 #include <atomic>
 #include <cstdlib>
 #include <iostream>
+#include <random>
 #include <thread>
 #include <valarray>
 
@@ -39,6 +42,7 @@
 
 #include <fcntl.h>
 #include <poll.h>
+#include <sys/mman.h>
 #include <unistd.h>
 
 #endif
@@ -298,4 +302,145 @@ BENCHMARK(BufferedOutputStreamSmallWritesToNull)->UseRealTime();
 BENCHMARK(BufferedOutputStreamSmallWritesToPipe)->UseRealTime();
 BENCHMARK(BufferedOutputStreamLargeWritesToPipe)->UseRealTime();
 
+// Benchmark random reads of a local file at various queue depths
+//
+// Each iteration issues `queue depth` concurrent random 4 KiB reads through
+// ReadManyAsync() and waits for all of them.  The "ThreadPool" variant forces
+// the default executor-based implementation, to compare against io_uring.
+
+constexpr int64_t kRandomReadFileSize = 64 * 1024 * 1024;
+constexpr int64_t kRandomReadSize = 4096;
+
+static std::string MakeRandomReadFile(internal::TemporaryDir* temp_dir) {
+  auto path = temp_dir->path().ToString() + "random_read.bin";
+  auto stream = *io::FileOutputStream::Open(path);
+  std::string chunk(1024 * 1024, 'x');
+  for (int64_t i = 0; i < kRandomReadFileSize; i += chunk.size()) {
+    ABORT_NOT_OK(stream->Write(chunk));
+  }
+  ABORT_NOT_OK(stream->Close());
+  return path;
+}
+
+static void BenchmarkRandomReads(benchmark::State& state, bool use_thread_pool) {
+  const int64_t queue_depth = state.range(0);
+  auto temp_dir = *internal::TemporaryDir::Make("file-benchmark-");
+  auto file = *io::ReadableFile::Open(MakeRandomReadFile(temp_dir.get()));
+
+  std::default_random_engine rng(42);
+  std::uniform_int_distribution<int64_t> offsets(
+      0, kRandomReadFileSize / kRandomReadSize - 1);
+  std::vector<io::ReadRange> ranges(queue_depth);
+  io::AsyncContext ctx;
+
+  for (auto _ : state) {
+    for (auto& range : ranges) {
+      range = {offsets(rng) * kRandomReadSize, kRandomReadSize};
+    }
+    auto futures = use_thread_pool ? file->RandomAccessFile::ReadManyAsync(ctx, ranges)
+                                   : file->ReadManyAsync(ctx, ranges);
+    for (const auto& fut : futures) {
+      ABORT_NOT_OK(fut.status());
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * queue_depth);
+  state.SetBytesProcessed(state.iterations() * queue_depth * kRandomReadSize);
+}
+
+static void ReadableFileRandomReadsThreadPool(
+    benchmark::State& state) {  // NOLINT non-const reference
+  BenchmarkRandomReads(state, /*use_thread_pool=*/true);
+}
+
+static void ReadableFileRandomReadsIoUring(
+    benchmark::State& state) {  // NOLINT non-const reference
+  if (io::internal::IoUring::GetInstance() == nullptr) {
+    state.SkipWithError("io_uring not available");
+    return;
+  }
+  BenchmarkRandomReads(state, /*use_thread_pool=*/false);
+}
+
+BENCHMARK(ReadableFileRandomReadsThreadPool)
+    ->RangeMultiplier(4)
+    ->Range(1, 256)
+    ->UseRealTime();
+BENCHMARK(ReadableFileRandomReadsIoUring)
+    ->RangeMultiplier(4)
+    ->Range(1, 256)
+    ->UseRealTime();
+
+// Benchmark sequential scans of a local file, through the page cache or not
+//
+// The file is evicted from the page cache before each iteration.  The
+// "page_cache_fraction" counter reports the fraction of the file left resident
+// in the page cache by the scan (Linux only).
+
+constexpr int64_t kSequentialReadSize = 1024 * 1024;
+
+#ifdef __linux__
+static void EvictFromPageCache(int fd) {
+  ARROW_UNUSED(fdatasync(fd));
+  ARROW_UNUSED(posix_fadvise(fd, 0, 0, POSIX_FADV_DONTNEED));
+}
+
+static double PageCacheFraction(int fd, int64_t size) {
+  void* addr = mmap(nullptr, static_cast<size_t>(size), PROT_READ, MAP_SHARED, fd, 0);
+  if (addr == MAP_FAILED) {
+    return -1;
+  }
+  const int64_t page_size = sysconf(_SC_PAGESIZE);
+  std::vector<unsigned char> residency((size + page_size - 1) / page_size);
+  double fraction = -1;
+  if (mincore(addr, static_cast<size_t>(size), residency.data()) == 0) {
+    const auto resident = std::count_if(residency.begin(), residency.end(),
+                                        [](unsigned char c) { return c & 1; });
+    fraction = static_cast<double>(resident) / residency.size();
+  }
+  munmap(addr, static_cast<size_t>(size));
+  return fraction;
+}
+#endif
+
+static void BenchmarkSequentialReads(benchmark::State& state, bool direct_io) {
+  auto temp_dir = *internal::TemporaryDir::Make("file-benchmark-");
+  const auto path = MakeRandomReadFile(temp_dir.get());
+  auto file = direct_io ? *io::ReadableFile::OpenDirect(path)
+                        : *io::ReadableFile::Open(path);
+  if (direct_io && !file->direct_io()) {
+    state.SkipWithError("direct I/O not supported by filesystem");
+    return;
+  }
+
+  for (auto _ : state) {
+    state.PauseTiming();
+#ifdef __linux__
+    EvictFromPageCache(file->file_descriptor());
+#endif
+    state.ResumeTiming();
+    for (int64_t pos = 0; pos < kRandomReadFileSize; pos += kSequentialReadSize) {
+      auto buffer = *file->ReadAt(pos, kSequentialReadSize);
+      benchmark::DoNotOptimize(buffer);
+    }
+  }
+  state.SetBytesProcessed(state.iterations() * kRandomReadFileSize);
+#ifdef __linux__
+  state.counters["page_cache_fraction"] =
+      PageCacheFraction(file->file_descriptor(), kRandomReadFileSize);
+#endif
+}
+
+static void ReadableFileSequentialReadsBuffered(
+    benchmark::State& state) {  // NOLINT non-const reference
+  BenchmarkSequentialReads(state, /*direct_io=*/false);
+}
+
+static void ReadableFileSequentialReadsDirect(
+    benchmark::State& state) {  // NOLINT non-const reference
+  BenchmarkSequentialReads(state, /*direct_io=*/true);
+}
+
+BENCHMARK(ReadableFileSequentialReadsBuffered)->UseRealTime();
+BENCHMARK(ReadableFileSequentialReadsDirect)->UseRealTime();
+
 }  // namespace arrow
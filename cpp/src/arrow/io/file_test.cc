@@ -384,6 +384,162 @@ TEST_F(TestReadableFile, ReadAsync) {
   AssertBufferEqual(*buf2, "test");
 }
 
+TEST_F(TestReadableFile, ReadManyAsync) {
+  MakeTestFile();
+  OpenFile();
+
+  auto futs = file_->ReadManyAsync({}, {{1, 10}, {0, 4}, {2, 0}, {8, 3}});
+  ASSERT_EQ(futs.size(), 4);
+  ASSERT_OK_AND_ASSIGN(auto buf1, futs[0].result());
+  ASSERT_OK_AND_ASSIGN(auto buf2, futs[1].result());
+  ASSERT_OK_AND_ASSIGN(auto buf3, futs[2].result());
+  ASSERT_OK_AND_ASSIGN(auto buf4, futs[3].result());
+  AssertBufferEqual(*buf1, "estdata");
+  AssertBufferEqual(*buf2, "test");
+  AssertBufferEqual(*buf3, "");
+  AssertBufferEqual(*buf4, "");
+
+  // An invalid range doesn't affect the other ones
+  futs = file_->ReadManyAsync({}, {{0, 4}, {-1, 3}, {4, 4}, {1, -2}});
+  ASSERT_EQ(futs.size(), 4);
+  ASSERT_OK_AND_ASSIGN(buf1, futs[0].result());
+  ASSERT_RAISES(Invalid, futs[1].result());
+  ASSERT_OK_AND_ASSIGN(buf3, futs[2].result());
+  ASSERT_RAISES(Invalid, futs[3].result());
+  AssertBufferEqual(*buf1, "test");
+  AssertBufferEqual(*buf3, "data");
+
+  ASSERT_OK(file_->Close());
+  futs = file_->ReadManyAsync({}, {{0, 4}});
+  ASSERT_RAISES(Invalid, futs[0].result());
+}
+
+TEST_F(TestReadableFile, ReadManyAsyncGrowingFile) {
+  MakeTestFile();
+  OpenFile();
+
+  // Data appended after opening the file is visible to reads
+  {
+    std::ofstream stream;
+    stream.open(path_.c_str(), std::ios::app);
+    stream << "moredata";
+  }
+  auto futs = file_->ReadManyAsync({}, {{4, 8}, {12, 10}, {16, 4}});
+  ASSERT_OK_AND_ASSIGN(auto buf1, futs[0].result());
+  ASSERT_OK_AND_ASSIGN(auto buf2, futs[1].result());
+  ASSERT_OK_AND_ASSIGN(auto buf3, futs[2].result());
+  AssertBufferEqual(*buf1, "datamore");
+  AssertBufferEqual(*buf2, "data");
+  AssertBufferEqual(*buf3, "");
+}
+
+TEST_F(TestReadableFile, ReadManyAsyncDeepQueue) {
+  // More reads than the io_uring queue depth, if available
+  const int64_t kNumReads = 2000;
+  std::string data(kNumReads, 'x');
+  for (int64_t i = 0; i < kNumReads; ++i) {
+    data[i] = static_cast<char>('a' + i % 26);
+  }
+  {
+    std::ofstream stream;
+    stream.open(path_.c_str());
+    stream << data;
+  }
+  OpenFile();
+
+  std::vector<ReadRange> ranges;
+  for (int64_t i = 0; i < kNumReads; ++i) {
+    ranges.push_back({(i * 7) % kNumReads, 1});
+  }
+  auto futs = file_->ReadManyAsync({}, ranges);
+  ASSERT_EQ(futs.size(), ranges.size());
+  for (size_t i = 0; i < futs.size(); ++i) {
+    ASSERT_OK_AND_ASSIGN(auto buf, futs[i].result());
+    AssertBufferEqual(*buf, data.substr(ranges[i].offset, 1));
+  }
+}
+
+class TestReadableFileDirect : public TestReadableFile {
+ public:
+  void MakeLargeTestFile() {
+    // Span several direct I/O blocks, ending on an unaligned size
+    data_.resize(3 * 4096 + 123);
+    for (size_t i = 0; i < data_.size(); ++i) {
+      data_[i] = static_cast<char>('a' + i % 26);
+    }
+    std::ofstream stream;
+    stream.open(path_.c_str());
+    stream << data_;
+  }
+
+  void OpenFile() { ASSERT_OK_AND_ASSIGN(file_, ReadableFile::OpenDirect(path_)); }
+
+ protected:
+  std::string data_;
+};
+
+TEST_F(TestReadableFileDirect, ReadAt) {
+  MakeLargeTestFile();
+  OpenFile();
+  ASSERT_OK_AND_EQ(static_cast<int64_t>(data_.size()), file_->GetSize());
+
+  for (const auto& range : std::vector<ReadRange>{
+           {0, 10}, {4095, 2}, {4096, 4096}, {100, 9000}, {12300, 1000}, {20000, 5}}) {
+    ASSERT_OK_AND_ASSIGN(auto buffer, file_->ReadAt(range.offset, range.length));
+    AssertBufferEqual(*buffer, data_.substr(std::min<size_t>(range.offset, data_.size()),
+                                            range.length));
+    std::string out(range.length, '\0');
+    ASSERT_OK_AND_ASSIGN(auto bytes_read,
+                         file_->ReadAt(range.offset, range.length, &out[0]));
+    out.resize(bytes_read);
+    ASSERT_EQ(out, data_.substr(std::min<size_t>(range.offset, data_.size()),
+                                range.length));
+  }
+  ASSERT_RAISES(Invalid, file_->ReadAt(-1, 1));
+}
+
+TEST_F(TestReadableFileDirect, Read) {
+  MakeLargeTestFile();
+  OpenFile();
+
+  ASSERT_OK_AND_ASSIGN(auto buffer, file_->Read(5));
+  AssertBufferEqual(*buffer, data_.substr(0, 5));
+  char out[5000];
+  ASSERT_OK_AND_EQ(5000, file_->Read(5000, out));
+  ASSERT_EQ(std::string(out, 5000), data_.substr(5, 5000));
+  ASSERT_OK_AND_EQ(5005, file_->Tell());
+  ASSERT_OK_AND_ASSIGN(buffer, file_->Read(100000));
+  AssertBufferEqual(*buffer, data_.substr(5005));
+  ASSERT_OK_AND_ASSIGN(buffer, file_->Read(10));
+  ASSERT_EQ(0, buffer->size());
+}
+
+TEST_F(TestReadableFileDirect, ReadAsync) {
+  MakeLargeTestFile();
+  OpenFile();
+
+  auto futs = file_->ReadManyAsync({}, {{1, 10}, {4000, 5000}, {12000, 1000}, {7, 0}});
+  ASSERT_OK_AND_ASSIGN(auto buf1, futs[0].result());
+  ASSERT_OK_AND_ASSIGN(auto buf2, futs[1].result());
+  ASSERT_OK_AND_ASSIGN(auto buf3, futs[2].result());
+  ASSERT_OK_AND_ASSIGN(auto buf4, futs[3].result());
+  AssertBufferEqual(*buf1, data_.substr(1, 10));
+  AssertBufferEqual(*buf2, data_.substr(4000, 5000));
+  AssertBufferEqual(*buf3, data_.substr(12000));
+  AssertBufferEqual(*buf4, "");
+
+  futs = file_->ReadManyAsync({}, {{-1, 10}, {4090, 10}});
+  ASSERT_RAISES(Invalid, futs[0].result());
+  ASSERT_OK_AND_ASSIGN(buf1, futs[1].result());
+  AssertBufferEqual(*buf1, data_.substr(4090, 10));
+
+  auto fut = file_->ReadAsync({}, 3, 4);
+  ASSERT_OK_AND_ASSIGN(auto buf5, fut.result());
+  AssertBufferEqual(*buf5, data_.substr(3, 4));
+
+  ASSERT_OK(file_->WillNeed({{0, 100}}));
+}
+
 TEST_F(TestReadableFile, SeekingRequired) {
   MakeTestFile();
   OpenFile();
@@ -460,6 +616,23 @@ TEST_F(TestReadableFile, CustomMemoryPool) {
   ASSERT_EQ(2, pool.num_allocations());
 }
 
+TEST_F(TestReadableFileDirect, CustomMemoryPool) {
+  MakeLargeTestFile();
+
+  MyMemoryPool pool;
+  ASSERT_OK_AND_ASSIGN(file_, ReadableFile::OpenDirect(path_, &pool));
+  if (!file_->direct_io()) {
+    GTEST_SKIP() << "Direct I/O not supported by filesystem";
+  }
+  // Freed buffers are recycled for later reads
+  for (int i = 0; i < 5; ++i) {
+    ASSERT_OK_AND_ASSIGN(auto buffer, file_->ReadAt(10, 100));
+  }
+  ASSERT_EQ(1, pool.num_allocations());
+  // Retained buffers are returned to the pool on destruction
+  file_.reset();
+}
+
 TEST_F(TestReadableFile, ThreadSafety) {
   std::string data = "foobar";
   {
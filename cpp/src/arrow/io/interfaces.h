@@ -237,6 +237,13 @@ class ARROW_EXPORT RandomAccessFile
   virtual Future<std::shared_ptr<Buffer>> ReadAsync(const AsyncContext&, int64_t position,
                                                     int64_t nbytes);
 
+  /// EXPERIMENTAL: Read data asynchronously for several ranges at once.
+  ///
+  /// The default implementation calls ReadAsync() for each range.  Subclasses
+  /// may override it to submit all reads to the underlying system at once.
+  virtual std::vector<Future<std::shared_ptr<Buffer>>> ReadManyAsync(
+      const AsyncContext&, const std::vector<ReadRange>& ranges);
+
   /// EXPERIMENTAL: Inform that the given ranges may be read soon.
   ///
   /// Some implementations might arrange to prefetch some of the data.
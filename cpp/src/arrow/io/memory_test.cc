@@ -729,6 +729,35 @@ TEST(RangeReadCache, Basics) {
   ASSERT_RAISES(Invalid, cache.Read({25, 2}));
 }
 
+TEST(RangeReadCache, Async) {
+  std::string data = "abcdefghijklmnopqrstuvwxyz";
+
+  auto file = std::make_shared<BufferReader>(Buffer(data));
+  CacheOptions options = CacheOptions::Defaults();
+  options.hole_size_limit = 2;
+  options.range_size_limit = 10;
+  internal::ReadRangeCache cache(file, {}, options);
+
+  ASSERT_OK(cache.Cache({{1, 2}, {3, 2}, {8, 2}, {20, 2}, {25, 0}}));
+  ASSERT_OK(cache.WaitFor({{1, 2}, {20, 2}, {25, 0}}).status());
+  ASSERT_OK(cache.Wait().status());
+
+  auto fut = cache.ReadAsync({3, 2});
+  ASSERT_OK_AND_ASSIGN(auto buf, fut.result());
+  AssertBufferEqual(*buf, "de");
+  fut = cache.ReadAsync({25, 0});
+  ASSERT_OK_AND_ASSIGN(buf, fut.result());
+  AssertBufferEqual(*buf, "");
+
+  // Continuations run without blocking the caller
+  auto length = cache.ReadAsync({8, 2}).Then(
+      [](const std::shared_ptr<Buffer>& buf) { return buf->size(); });
+  ASSERT_OK_AND_EQ(2, length.result());
+
+  ASSERT_RAISES(Invalid, cache.ReadAsync({20, 3}).result());
+  ASSERT_RAISES(Invalid, cache.WaitFor({{0, 3}}).status());
+}
+
 TEST(CacheOptions, Basics) {
   auto check = [](const CacheOptions actual, const double expected_hole_size_limit_MiB,
                   const double expected_range_size_limit_MiB) -> void {
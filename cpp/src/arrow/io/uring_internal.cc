@@ -0,0 +1,510 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/io/uring_internal.h"
+
+#include <algorithm>
+#include <utility>
+
+#include "arrow/buffer.h"
+#include "arrow/memory_pool.h"
+#include "arrow/result.h"
+#include "arrow/status.h"
+#include "arrow/util/io_util.h"
+#include "arrow/util/logging.h"
+
+#ifdef ARROW_HAVE_IO_URING
+
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <cerrno>
+#include <condition_variable>
+#include <cstring>
+#include <mutex>
+#include <thread>
+
+// The io_uring syscall numbers are the same on all architectures supported
+// by Arrow, but older libc headers may not define them.
+#ifndef __NR_io_uring_setup
+#define __NR_io_uring_setup 425
+#endif
+#ifndef __NR_io_uring_enter
+#define __NR_io_uring_enter 426
+#endif
+
+#endif  // ARROW_HAVE_IO_URING
+
+namespace arrow {
+
+using internal::IOErrorFromErrno;
+
+namespace io {
+namespace internal {
+
+#ifdef ARROW_HAVE_IO_URING
+
+namespace {
+
+constexpr unsigned kQueueEntries = 256;
+
+int IoUringSetup(unsigned entries, struct io_uring_params* params) {
+  return static_cast<int>(syscall(__NR_io_uring_setup, entries, params));
+}
+
+int IoUringEnter(int ring_fd, unsigned to_submit, unsigned min_complete,
+                 unsigned flags) {
+  return static_cast<int>(syscall(__NR_io_uring_enter, ring_fd, to_submit, min_complete,
+                                  flags, nullptr, 0));
+}
+
+template <typename T>
+T* RingPointer(void* base, uint32_t offset) {
+  return reinterpret_cast<T*>(reinterpret_cast<uint8_t*>(base) + offset);
+}
+
+// A single positional read, possibly resubmitted several times on short reads
+struct ReadRequest {
+  int fd;
+  int64_t position;
+  int64_t nbytes;
+  // The number of bytes available before EOF (can be smaller than nbytes)
+  int64_t expected;
+  int64_t bytes_read;
+  std::shared_ptr<ResizableBuffer> buffer;
+  Future<std::shared_ptr<Buffer>> future;
+  std::shared_ptr<void> keepalive;
+  struct iovec iov;
+};
+
+}  // namespace
+
+class IoUring::Impl {
+ public:
+  ~Impl() {
+    if (completion_thread_.joinable()) {
+      {
+        // Wake up and stop the completion thread by submitting a no-op
+        // with null user data
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto sqe = NextSqe();
+        std::memset(sqe, 0, sizeof(*sqe));
+        sqe->opcode = IORING_OP_NOP;
+        sqe->user_data = 0;
+        ARROW_CHECK_OK(SubmitPendingUnlocked(/*num_sqes=*/1));
+      }
+      completion_thread_.join();
+    }
+    if (sqes_ != nullptr) {
+      munmap(sqes_, sqes_size_);
+    }
+    if (cq_ring_ != nullptr && cq_ring_ != sq_ring_) {
+      munmap(cq_ring_, cq_ring_size_);
+    }
+    if (sq_ring_ != nullptr) {
+      munmap(sq_ring_, sq_ring_size_);
+    }
+    if (ring_fd_ != -1) {
+      close(ring_fd_);
+    }
+  }
+
+  Status Init(unsigned entries) {
+    struct io_uring_params params;
+    std::memset(&params, 0, sizeof(params));
+    ring_fd_ = IoUringSetup(entries, &params);
+    if (ring_fd_ < 0) {
+      ring_fd_ = -1;
+      return IOErrorFromErrno(errno, "io_uring_setup failed");
+    }
+    sq_entries_ = params.sq_entries;
+    cq_entries_ = params.cq_entries;
+
+    sq_ring_size_ = params.sq_off.array + params.sq_entries * sizeof(uint32_t);
+    cq_ring_size_ = params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe);
+    const bool single_mmap = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+    if (single_mmap) {
+      sq_ring_size_ = cq_ring_size_ = std::max(sq_ring_size_, cq_ring_size_);
+    }
+
+    ARROW_ASSIGN_OR_RAISE(sq_ring_, MapRing(sq_ring_size_, IORING_OFF_SQ_RING));
+    if (single_mmap) {
+      cq_ring_ = sq_ring_;
+    } else {
+      ARROW_ASSIGN_OR_RAISE(cq_ring_, MapRing(cq_ring_size_, IORING_OFF_CQ_RING));
+    }
+    sqes_size_ = params.sq_entries * sizeof(struct io_uring_sqe);
+    ARROW_ASSIGN_OR_RAISE(auto sqes, MapRing(sqes_size_, IORING_OFF_SQES));
+    sqes_ = reinterpret_cast<struct io_uring_sqe*>(sqes);
+
+    sq_head_ = RingPointer<uint32_t>(sq_ring_, params.sq_off.head);
+    sq_tail_ = RingPointer<uint32_t>(sq_ring_, params.sq_off.tail);
+    sq_mask_ = *RingPointer<uint32_t>(sq_ring_, params.sq_off.ring_mask);
+    sq_array_ = RingPointer<uint32_t>(sq_ring_, params.sq_off.array);
+    cq_head_ = RingPointer<uint32_t>(cq_ring_, params.cq_off.head);
+    cq_tail_ = RingPointer<uint32_t>(cq_ring_, params.cq_off.tail);
+    cq_mask_ = *RingPointer<uint32_t>(cq_ring_, params.cq_off.ring_mask);
+    cqes_ = RingPointer<struct io_uring_cqe>(cq_ring_, params.cq_off.cqes);
+
+    completion_thread_ = std::thread([this] { CompletionLoop(); });
+    return Status::OK();
+  }
+
+  int queue_depth() const { return static_cast<int>(cq_entries_); }
+
+  std::vector<Future<std::shared_ptr<Buffer>>> SubmitReads(
+      int fd, int64_t file_size, const std::vector<ReadRange>& ranges,
+      const BufferAllocator& allocate, std::shared_ptr<void> keepalive) {
+    std::vector<Future<std::shared_ptr<Buffer>>> futures;
+    futures.reserve(ranges.size());
+
+    std::vector<ReadRequest*> requests;
+    requests.reserve(ranges.size());
+    for (const auto& range : ranges) {
+      auto fut = Future<std::shared_ptr<Buffer>>::Make();
+      futures.push_back(fut);
+      auto maybe_buffer = allocate(range.length);
+      if (!maybe_buffer.ok()) {
+        fut.MarkFinished(maybe_buffer.status());
+        continue;
+      }
+      std::shared_ptr<ResizableBuffer> buffer = *std::move(maybe_buffer);
+      const int64_t expected =
+          file_size < 0
+              ? range.length
+              : std::max<int64_t>(0, std::min(range.length, file_size - range.offset));
+      if (expected == 0) {
+        Status st = buffer->Resize(0);
+        if (st.ok()) {
+          fut.MarkFinished(std::move(buffer));
+        } else {
+          fut.MarkFinished(std::move(st));
+        }
+        continue;
+      }
+      requests.push_back(new ReadRequest{fd, range.offset, range.length, expected, 0,
+                                         std::move(buffer), std::move(fut), keepalive,
+                                         {}});
+    }
+
+    const bool on_completion_thread =
+        std::this_thread::get_id() == completion_thread_.get_id();
+    auto it = requests.begin();
+    while (it != requests.end()) {
+      std::unique_lock<std::mutex> lock(mutex_);
+      if (on_completion_thread) {
+        // A completion callback is issuing new reads: we can't wait for
+        // in-flight reads to complete, as this thread is the one completing them.
+        if (in_flight_ == cq_entries_) {
+          break;
+        }
+      } else {
+        capacity_cv_.wait(lock, [&] { return in_flight_ < cq_entries_; });
+      }
+      const auto batch_size = std::min<int64_t>(
+          {requests.end() - it, cq_entries_ - in_flight_, sq_entries_});
+      for (int64_t i = 0; i < batch_size; ++i) {
+        PrepareRead(*it++);
+      }
+      in_flight_ += static_cast<uint32_t>(batch_size);
+      unsigned num_unsubmitted = 0;
+      Status st =
+          SubmitPendingUnlocked(static_cast<unsigned>(batch_size), &num_unsubmitted);
+      if (!st.ok()) {
+        // Fail the reads the kernel didn't accept, as well as the ones
+        // not prepared yet
+        in_flight_ -= num_unsubmitted;
+        lock.unlock();
+        capacity_cv_.notify_all();
+        for (it -= num_unsubmitted; it != requests.end(); ++it) {
+          Complete(*it, st);
+        }
+        return futures;
+      }
+    }
+    // Only reached on the completion thread, if the ring is full
+    for (; it != requests.end(); ++it) {
+      ReadSynchronously(*it);
+    }
+    return futures;
+  }
+
+ protected:
+  Result<void*> MapRing(size_t size, off_t offset) {
+    void* ptr = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                     ring_fd_, offset);
+    if (ptr == MAP_FAILED) {
+      return IOErrorFromErrno(errno, "mmap of io_uring ring failed");
+    }
+    return ptr;
+  }
+
+  // Return the next submission queue entry.  The mutex must be held and at
+  // least one entry must be free.
+  struct io_uring_sqe* NextSqe() {
+    const uint32_t tail = *sq_tail_;
+    DCHECK_LT(tail - __atomic_load_n(sq_head_, __ATOMIC_ACQUIRE), sq_entries_);
+    const uint32_t index = tail & sq_mask_;
+    sq_array_[index] = index;
+    __atomic_store_n(sq_tail_, tail + 1, __ATOMIC_RELEASE);
+    return &sqes_[index];
+  }
+
+  void PrepareRead(ReadRequest* request) {
+    auto sqe = NextSqe();
+    std::memset(sqe, 0, sizeof(*sqe));
+    request->iov.iov_base = request->buffer->mutable_data() + request->bytes_read;
+    request->iov.iov_len = static_cast<size_t>(request->nbytes - request->bytes_read);
+    sqe->opcode = IORING_OP_READV;
+    sqe->fd = request->fd;
+    sqe->off = static_cast<uint64_t>(request->position + request->bytes_read);
+    sqe->addr = reinterpret_cast<uint64_t>(&request->iov);
+    sqe->len = 1;
+    sqe->user_data = reinterpret_cast<uint64_t>(request);
+  }
+
+  // Submit the last `num_sqes` prepared entries.  The mutex must be held.
+  //
+  // On error, the entries not consumed by the kernel are removed from the
+  // submission queue (they are always the last ones) and their number is
+  // stored in `num_unsubmitted`.
+  Status SubmitPendingUnlocked(unsigned num_sqes, unsigned* num_unsubmitted = nullptr) {
+    while (num_sqes > 0) {
+      int ret = IoUringEnter(ring_fd_, num_sqes, 0, 0);
+      if (ret < 0) {
+        if (errno == EINTR || errno == EAGAIN) {
+          continue;
+        }
+        Status st = IOErrorFromErrno(errno, "io_uring_enter failed");
+        __atomic_store_n(sq_tail_, *sq_tail_ - num_sqes, __ATOMIC_RELEASE);
+        if (num_unsubmitted != nullptr) {
+          *num_unsubmitted = num_sqes;
+        }
+        return st;
+      }
+      num_sqes -= static_cast<unsigned>(ret);
+    }
+    return Status::OK();
+  }
+
+  void CompletionLoop() {
+    std::vector<std::pair<ReadRequest*, int32_t>> completed;
+    bool stop = false;
+    while (!stop) {
+      int ret = IoUringEnter(ring_fd_, 0, 1, IORING_ENTER_GETEVENTS);
+      if (ret < 0 && errno != EINTR) {
+        ARROW_LOG(FATAL) << "io_uring_enter failed while waiting for completions: "
+                         << std::strerror(errno);
+      }
+      uint32_t head = *cq_head_;
+      const uint32_t tail = __atomic_load_n(cq_tail_, __ATOMIC_ACQUIRE);
+      for (; head != tail; ++head) {
+        const auto& cqe = cqes_[head & cq_mask_];
+        completed.emplace_back(reinterpret_cast<ReadRequest*>(cqe.user_data), cqe.res);
+      }
+      __atomic_store_n(cq_head_, head, __ATOMIC_RELEASE);
+
+      for (const auto& pair : completed) {
+        if (pair.first == nullptr) {
+          stop = true;
+        } else {
+          OnCompletion(pair.first, pair.second);
+        }
+      }
+      completed.clear();
+    }
+  }
+
+  void OnCompletion(ReadRequest* request, int32_t res) {
+    if (res < 0) {
+      if (res == -EAGAIN || res == -EINTR) {
+        Resubmit(request);
+      } else {
+        Finish(request, IOErrorFromErrno(-res, "io_uring read failed"));
+      }
+      return;
+    }
+    request->bytes_read += res;
+    if (res > 0 && request->bytes_read < request->expected) {
+      // Short read before EOF (e.g. reads larger than 2 GiB), read the rest.
+      // Note that with direct I/O we never read at or beyond EOF, as the
+      // offset may then not satisfy the alignment requirements.
+      Resubmit(request);
+    } else {
+      Finish(request, Status::OK());
+    }
+  }
+
+  void Resubmit(ReadRequest* request) {
+    Status st;
+    {
+      // The request still counts as in flight, so a free entry is guaranteed
+      std::lock_guard<std::mutex> lock(mutex_);
+      PrepareRead(request);
+      st = SubmitPendingUnlocked(1);
+    }
+    if (!st.ok()) {
+      Finish(request, std::move(st));
+    }
+  }
+
+  void ReadSynchronously(ReadRequest* request) {
+    // Same logic as the asynchronous path, but using pread()
+    while (request->bytes_read < request->expected) {
+      const auto ret =
+          pread(request->fd, request->buffer->mutable_data() + request->bytes_read,
+                static_cast<size_t>(request->nbytes - request->bytes_read),
+                static_cast<off_t>(request->position + request->bytes_read));
+      if (ret == -1) {
+        if (errno == EINTR) {
+          continue;
+        }
+        Complete(request, IOErrorFromErrno(errno, "Error reading bytes from file"));
+        return;
+      }
+      if (ret == 0) {
+        break;
+      }
+      request->bytes_read += ret;
+    }
+    Complete(request, Status::OK());
+  }
+
+  void Finish(ReadRequest* request, Status st) {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      --in_flight_;
+    }
+    capacity_cv_.notify_one();
+    Complete(request, std::move(st));
+  }
+
+  void Complete(ReadRequest* request, Status st) {
+    std::unique_ptr<ReadRequest> owned(request);
+    if (st.ok() && request->bytes_read < request->nbytes) {
+      st = request->buffer->Resize(request->bytes_read);
+      request->buffer->ZeroPadding();
+    }
+    if (st.ok()) {
+      request->future.MarkFinished(std::move(request->buffer));
+    } else {
+      request->future.MarkFinished(std::move(st));
+    }
+  }
+
+  int ring_fd_ = -1;
+  uint32_t sq_entries_ = 0;
+  uint32_t cq_entries_ = 0;
+
+  void* sq_ring_ = nullptr;
+  void* cq_ring_ = nullptr;
+  struct io_uring_sqe* sqes_ = nullptr;
+  size_t sq_ring_size_ = 0;
+  size_t cq_ring_size_ = 0;
+  size_t sqes_size_ = 0;
+
+  uint32_t* sq_head_ = nullptr;
+  uint32_t* sq_tail_ = nullptr;
+  uint32_t sq_mask_ = 0;
+  uint32_t* sq_array_ = nullptr;
+  uint32_t* cq_head_ = nullptr;
+  uint32_t* cq_tail_ = nullptr;
+  uint32_t cq_mask_ = 0;
+  struct io_uring_cqe* cqes_ = nullptr;
+
+  // Protects the submission queue and in_flight_
+  std::mutex mutex_;
+  std::condition_variable capacity_cv_;
+  // Never exceeds the completion queue size, so that completions can't overflow
+  uint32_t in_flight_ = 0;
+
+  std::thread completion_thread_;
+};
+
+namespace {
+
+bool IoUringDisabledByEnv() {
+  auto maybe_value = ::arrow::internal::GetEnvVar("ARROW_IO_URING");
+  return maybe_value.ok() && (*maybe_value == "0" || *maybe_value == "false" ||
+                              *maybe_value == "off");
+}
+
+}  // namespace
+
+IoUring* IoUring::GetInstance() {
+  static std::unique_ptr<IoUring> instance = []() -> std::unique_ptr<IoUring> {
+    if (IoUringDisabledByEnv()) {
+      return nullptr;
+    }
+    std::unique_ptr<Impl> impl(new Impl());
+    Status st = impl->Init(kQueueEntries);
+    if (!st.ok()) {
+      ARROW_LOG(DEBUG) << "io_uring unavailable, using thread-based ReadAsync: "
+                       << st.ToString();
+      return nullptr;
+    }
+    return std::unique_ptr<IoUring>(new IoUring(std::move(impl)));
+  }();
+  return instance.get();
+}
+
+std::vector<Future<std::shared_ptr<Buffer>>> IoUring::SubmitReads(
+    int fd, int64_t file_size, const std::vector<ReadRange>& ranges,
+    const BufferAllocator& allocate, std::shared_ptr<void> keepalive) {
+  return impl_->SubmitReads(fd, file_size, ranges, allocate, std::move(keepalive));
+}
+
+int IoUring::queue_depth() const { return impl_->queue_depth(); }
+
+#else  // !ARROW_HAVE_IO_URING
+
+class IoUring::Impl {};
+
+IoUring* IoUring::GetInstance() { return nullptr; }
+
+std::vector<Future<std::shared_ptr<Buffer>>> IoUring::SubmitReads(
+    int fd, int64_t file_size, const std::vector<ReadRange>& ranges,
+    const BufferAllocator& allocate, std::shared_ptr<void> keepalive) {
+  return {};
+}
+
+int IoUring::queue_depth() const { return 0; }
+
+#endif  // ARROW_HAVE_IO_URING
+
+std::vector<Future<std::shared_ptr<Buffer>>> IoUring::SubmitReads(
+    int fd, int64_t file_size, const std::vector<ReadRange>& ranges, MemoryPool* pool,
+    std::shared_ptr<void> keepalive) {
+  return SubmitReads(
+      fd, file_size, ranges,
+      [pool](int64_t size) -> Result<std::shared_ptr<ResizableBuffer>> {
+        return AllocateResizableBuffer(size, pool);
+      },
+      std::move(keepalive));
+}
+
+IoUring::IoUring(std::unique_ptr<Impl> impl) : impl_(std::move(impl)) {}
+
+IoUring::~IoUring() = default;
+
+}  // namespace internal
+}  // namespace io
+}  // namespace arrow
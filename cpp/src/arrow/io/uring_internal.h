@@ -0,0 +1,93 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Asynchronous positional reads using Linux io_uring
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "arrow/io/interfaces.h"
+#include "arrow/type_fwd.h"
+#include "arrow/util/future.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace io {
+namespace internal {
+
+/// \brief A process-wide io_uring instance servicing asynchronous reads
+///
+/// Reads are pushed to the kernel submission queue in batches, and their
+/// Futures are marked finished by a dedicated thread draining the completion
+/// queue.  Outstanding reads therefore don't occupy IO thread pool workers,
+/// which allows much higher queue depths than thread-based ReadAsync().
+///
+/// Callbacks attached to the returned Futures run on the completion thread
+/// and should be cheap.
+class ARROW_EXPORT IoUring {
+ public:
+  ~IoUring();
+
+  /// \brief Return the global io_uring instance
+  ///
+  /// Null is returned if io_uring isn't supported at compile time or by the
+  /// running kernel (or is forbidden, e.g. by a seccomp filter), or if it was
+  /// disabled by setting the ARROW_IO_URING environment variable to "0".
+  static IoUring* GetInstance();
+
+  using BufferAllocator =
+      std::function<Result<std::shared_ptr<ResizableBuffer>>(int64_t size)>;
+
+  /// \brief Read the given ranges of file descriptor `fd`
+  ///
+  /// All ranges are submitted to the kernel in as few system calls as
+  /// possible.  Ranges are expected to have been validated by the caller.
+  /// As with ReadAt(), the returned buffers are shorter than requested if
+  /// they extend beyond the end of file.  If `file_size` is non-negative,
+  /// reads are truncated to it; this is required for direct I/O, where reading
+  /// at EOF may fail because of alignment.  Otherwise, the length is decided by
+  /// the kernel's short reads.
+  ///
+  /// `keepalive` is released once all reads complete; it should typically
+  /// own the file descriptor.
+  std::vector<Future<std::shared_ptr<Buffer>>> SubmitReads(
+      int fd, int64_t file_size, const std::vector<ReadRange>& ranges,
+      const BufferAllocator& allocate, std::shared_ptr<void> keepalive = NULLPTR);
+
+  /// \brief Like SubmitReads() above, allocating buffers from a MemoryPool
+  std::vector<Future<std::shared_ptr<Buffer>>> SubmitReads(
+      int fd, int64_t file_size, const std::vector<ReadRange>& ranges, MemoryPool* pool,
+      std::shared_ptr<void> keepalive = NULLPTR);
+
+  /// \brief The maximum number of reads in flight before submission blocks
+  int queue_depth() const;
+
+  class Impl;
+
+ private:
+  explicit IoUring(std::unique_ptr<Impl> impl);
+
+  std::unique_ptr<Impl> impl_;
+};
+
+}  // namespace internal
+}  // namespace io
+}  // namespace arrow
@@ -79,6 +79,9 @@ bool HasValidityBitmap(Type::type type_id, MetadataVersion version);
 
 static constexpr const char* kArrowMagicBytes = "ARROW1";
 
+// File footer custom_metadata key for per-batch column statistics
+static constexpr const char* kBatchStatisticsKey = "ARROW:batch_statistics";
+
 struct FieldMetadata {
   int64_t length;
   int64_t null_count;
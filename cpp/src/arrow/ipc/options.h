@@ -90,6 +90,17 @@ struct ARROW_EXPORT IpcWriteOptions {
   /// V4 is also available (readable by 0.8.0 and later).
   MetadataVersion metadata_version = MetadataVersion::V5;
 
+  /// \brief Record per-batch column statistics in the IPC file footer
+  ///
+  /// For each record batch, the null count of every top-level field is
+  /// recorded, as well as the minimum and maximum values of numeric, temporal,
+  /// string and binary fields.  They are stored in the footer's custom_metadata
+  /// and can be read back with ReadBatchStatistics(), allowing readers to
+  /// skip record batches based on predicates.
+  ///
+  /// Ignored when writing the IPC stream format.
+  bool write_batch_statistics = false;
+
   static IpcWriteOptions Defaults();
 };
 
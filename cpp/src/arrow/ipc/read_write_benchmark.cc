@@ -21,12 +21,22 @@
 #include <sstream>
 #include <string>
 
+#ifdef __linux__
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+#include "arrow/array/array_primitive.h"
+#include "arrow/io/file.h"
 #include "arrow/io/memory.h"
 #include "arrow/ipc/api.h"
+#include "arrow/memory_pool.h"
 #include "arrow/record_batch.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/random.h"
 #include "arrow/type.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/io_util.h"
 
 namespace arrow {
 
@@ -188,10 +198,96 @@ static void DecodeStream(benchmark::State& state) {  // NOLINT non-const referen
   state.SetBytesProcessed(int64_t(state.iterations()) * kTotalSize);
 }
 
+// Benchmark scanning a projection of an IPC file on local disk, by copying
+// reads or through a memory map
+//
+// The file is evicted from the page cache before each iteration (Linux only).
+// The "peak_memory" counter reports the peak allocation from the memory pool.
+
+constexpr int64_t kScanBatchSize = 1 << 20;
+constexpr int kScanNumBatches = 64;
+constexpr int kScanNumFields = 16;
+
+enum class ScanMode { kCopy, kMemoryMap, kMemoryMapWithPrefetch };
+
+static void BenchmarkFileScan(benchmark::State& state, ScanMode mode) {
+  auto temp_dir = *internal::TemporaryDir::Make("ipc-benchmark-");
+  const auto path = temp_dir->path().ToString() + "data.arrow";
+  {
+    auto record_batch = MakeRecordBatch(kScanBatchSize, kScanNumFields);
+    auto stream = *io::FileOutputStream::Open(path);
+    auto writer = *ipc::MakeFileWriter(stream, record_batch->schema());
+    for (int i = 0; i < kScanNumBatches; ++i) {
+      ABORT_NOT_OK(writer->WriteRecordBatch(*record_batch));
+    }
+    ABORT_NOT_OK(writer->Close());
+    ABORT_NOT_OK(stream->Close());
+  }
+
+  ProxyMemoryPool pool(default_memory_pool());
+  auto options = ipc::IpcReadOptions::Defaults();
+  options.memory_pool = &pool;
+  options.use_threads = false;
+  // Read a quarter of the columns
+  options.included_fields = {0, 4, 8, 12};
+
+  for (auto _ : state) {
+#ifdef __linux__
+    state.PauseTiming();
+    {
+      auto file = *io::ReadableFile::Open(path);
+      ARROW_UNUSED(posix_fadvise(file->file_descriptor(), 0, 0, POSIX_FADV_DONTNEED));
+    }
+    state.ResumeTiming();
+#endif
+    std::shared_ptr<io::RandomAccessFile> file;
+    if (mode == ScanMode::kCopy) {
+      file = *io::ReadableFile::Open(path, &pool);
+    } else {
+      file = *io::MemoryMappedFile::Open(path, io::FileMode::READ);
+    }
+    auto reader = *ipc::RecordBatchFileReader::Open(file, options);
+    const int num_batches = reader->num_record_batches();
+    int64_t sum = 0;
+    for (int i = 0; i < num_batches; ++i) {
+      if (mode == ScanMode::kMemoryMapWithPrefetch && i + 1 < num_batches) {
+        ABORT_NOT_OK(reader->WillNeedRecordBatch(i + 1));
+      }
+      auto batch = *reader->ReadRecordBatch(i);
+      for (const auto& column : batch->columns()) {
+        const auto& values = internal::checked_cast<const Int64Array&>(*column);
+        for (int64_t j = 0; j < values.length(); ++j) {
+          sum += values.Value(j);
+        }
+      }
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetBytesProcessed(state.iterations() * kScanBatchSize * kScanNumBatches / 4);
+  state.counters["peak_memory"] = static_cast<double>(pool.max_memory());
+}
+
+static void ReadFileScanCopy(benchmark::State& state) {  // NOLINT non-const reference
+  BenchmarkFileScan(state, ScanMode::kCopy);
+}
+
+static void ReadFileScanMemoryMap(
+    benchmark::State& state) {  // NOLINT non-const reference
+  BenchmarkFileScan(state, ScanMode::kMemoryMap);
+}
+
+static void ReadFileScanMemoryMapWithPrefetch(
+    benchmark::State& state) {  // NOLINT non-const reference
+  BenchmarkFileScan(state, ScanMode::kMemoryMapWithPrefetch);
+}
+
 BENCHMARK(WriteRecordBatch)->RangeMultiplier(4)->Range(1, 1 << 13)->UseRealTime();
 BENCHMARK(ReadRecordBatch)->RangeMultiplier(4)->Range(1, 1 << 13)->UseRealTime();
 BENCHMARK(ReadFile)->RangeMultiplier(4)->Range(1, 1 << 13)->UseRealTime();
 BENCHMARK(ReadStream)->RangeMultiplier(4)->Range(1, 1 << 13)->UseRealTime();
 BENCHMARK(DecodeStream)->RangeMultiplier(4)->Range(1, 1 << 13)->UseRealTime();
+BENCHMARK(ReadFileScanCopy)->UseRealTime();
+BENCHMARK(ReadFileScanMemoryMap)->UseRealTime();
+BENCHMARK(ReadFileScanMemoryMapWithPrefetch)->UseRealTime();
 
 }  // namespace arrow
@@ -1568,6 +1568,113 @@ TEST(TestIpcFileFormat, FooterMetaData) {
   ASSERT_TRUE(out_metadata->Equals(*metadata));
 }
 
+// A BufferReader recording the ranges passed to WillNeed()
+class WillNeedRecorder : public io::BufferReader {
+ public:
+  using io::BufferReader::BufferReader;
+
+  Status WillNeed(const std::vector<io::ReadRange>& ranges) override {
+    ranges_.insert(ranges_.end(), ranges.begin(), ranges.end());
+    return io::BufferReader::WillNeed(ranges);
+  }
+
+  std::vector<io::ReadRange> ranges_;
+};
+
+TEST(TestIpcFileFormat, WillNeedRecordBatch) {
+  // Large enough buffers that those of different columns aren't coalesced
+  const int64_t length = 1 << 16;
+  auto schema = ::arrow::schema(
+      {field("a", int64()), field("b", utf8()), field("c", list(int32()))});
+  random::RandomArrayGenerator rand(/*seed=*/0);
+  auto batch = RecordBatch::Make(
+      schema, length,
+      {rand.Int64(length, 0, 100, 0.1), rand.String(length, 0, 10, 0.1),
+       rand.List(*rand.Int32(length * 2, 0, 100, 0.1), length, 0.1)});
+
+  FileWriterHelper helper;
+  ASSERT_OK(helper.Init(schema, IpcWriteOptions::Defaults()));
+  ASSERT_OK(helper.WriteBatch(batch));
+  ASSERT_OK(helper.WriteBatch(batch));
+  ASSERT_OK(helper.Finish());
+  const uint8_t* file_data = helper.buffer_->data();
+
+  auto options = IpcReadOptions::Defaults();
+  options.included_fields = {1};
+  auto file = std::make_shared<WillNeedRecorder>(helper.buffer_);
+  ASSERT_OK_AND_ASSIGN(auto reader, RecordBatchFileReader::Open(file, options));
+
+  ASSERT_OK(reader->WillNeedRecordBatch(1));
+  ASSERT_EQ(file->ranges_.size(), 1);
+  const auto range = file->ranges_[0];
+
+  // The advised range spans exactly the buffers of the selected column
+  ASSERT_OK_AND_ASSIGN(auto read_batch, reader->ReadRecordBatch(1));
+  ASSERT_OK(read_batch->ValidateFull());
+  ASSERT_EQ(read_batch->num_columns(), 1);
+  int64_t begin = helper.buffer_->size(), end = 0;
+  for (const auto& buffer : read_batch->column_data(0)->buffers) {
+    if (buffer == nullptr) continue;
+    begin = std::min(begin, static_cast<int64_t>(buffer->data() - file_data));
+    end = std::max(end, static_cast<int64_t>(buffer->data() - file_data) + buffer->size());
+  }
+  ASSERT_EQ(range.offset, begin);
+  ASSERT_GE(range.offset + range.length, end);
+  ASSERT_LT(range.offset + range.length, end + 64);
+}
+
+TEST(TestIpcFileFormat, BatchStatistics) {
+  auto schema = ::arrow::schema({field("i", int32()), field("s", utf8()),
+                                 field("f", float64()), field("l", list(int8()))});
+  BatchVector batches = {
+      RecordBatchFromJSON(schema, R"([[3, "b", 1.5, [1]], [null, "a", null, null],
+                                      [-1, "c", NaN, []]])"),
+      RecordBatchFromJSON(schema, R"([[null, null, NaN, null]])"),
+      RecordBatchFromJSON(schema, "[]")};
+
+  auto options = IpcWriteOptions::Defaults();
+  options.write_batch_statistics = true;
+  auto metadata = key_value_metadata({"ARROW:example"}, {"something something"});
+
+  FileWriterHelper helper;
+  ASSERT_OK(helper.Init(schema, options, metadata));
+  for (const auto& batch : batches) {
+    ASSERT_OK(helper.WriteBatch(batch));
+  }
+  ASSERT_OK(helper.Finish());
+
+  auto buf_reader = std::make_shared<io::BufferReader>(helper.buffer_);
+  ASSERT_OK_AND_ASSIGN(auto reader, RecordBatchFileReader::Open(buf_reader.get()));
+  ASSERT_EQ(reader->metadata()->Get("ARROW:example"), "something something");
+  ASSERT_OK_AND_ASSIGN(auto statistics, ReadBatchStatistics(*reader));
+  ASSERT_NE(statistics, nullptr);
+  ASSERT_OK(statistics->ValidateFull());
+
+  auto stats_type = [](std::shared_ptr<DataType> type) {
+    return struct_({field("null_count", int64()), field("min", type),
+                    field("max", type)});
+  };
+  auto stats_schema = ::arrow::schema(
+      {field("i", stats_type(int32())), field("s", stats_type(utf8())),
+       field("f", stats_type(float64())),
+       field("l", struct_({field("null_count", int64())})), field("num_rows", int64())});
+  auto expected = RecordBatchFromJSON(stats_schema, R"([
+    [[1, -1, 3], [0, "a", "c"], [1, 1.5, 1.5], [1], 3],
+    [[1, null, null], [1, null, null], [0, null, null], [1], 1],
+    [[0, null, null], [0, null, null], [0, null, null], [0], 0]
+  ])");
+  AssertBatchesEqual(*expected, *statistics);
+
+  // Files written without statistics have none
+  ASSERT_OK(helper.Init(schema, IpcWriteOptions::Defaults()));
+  ASSERT_OK(helper.WriteBatch(batches[0]));
+  ASSERT_OK(helper.Finish());
+  buf_reader = std::make_shared<io::BufferReader>(helper.buffer_);
+  ASSERT_OK_AND_ASSIGN(reader, RecordBatchFileReader::Open(buf_reader.get()));
+  ASSERT_OK_AND_ASSIGN(statistics, ReadBatchStatistics(*reader));
+  ASSERT_EQ(statistics, nullptr);
+}
+
 // This test uses uninitialized memory
 
 #if !(defined(ARROW_VALGRIND) || defined(ADDRESS_SANITIZER))
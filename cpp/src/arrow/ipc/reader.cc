@@ -31,8 +31,10 @@
 #include "arrow/array.h"
 #include "arrow/buffer.h"
 #include "arrow/extension_type.h"
+#include "arrow/io/caching.h"
 #include "arrow/io/interfaces.h"
 #include "arrow/io/memory.h"
+#include "arrow/io/util_internal.h"
 #include "arrow/ipc/message.h"
 #include "arrow/ipc/metadata_internal.h"
 #include "arrow/ipc/util.h"
@@ -42,6 +44,7 @@
 #include "arrow/status.h"
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
+#include "arrow/util/base64.h"
 #include "arrow/util/bit_util.h"
 #include "arrow/util/bitmap_ops.h"
 #include "arrow/util/checked_cast.h"
@@ -120,6 +123,9 @@ class ArrayLoader {
         file_(file),
         max_recursion_depth_(options.max_recursion_depth) {}
 
+  // Instead of reading buffers, append their body ranges to `ranges`
+  void CollectReadRanges(std::vector<io::ReadRange>* ranges) { read_ranges_ = ranges; }
+
   Status ReadBuffer(int64_t offset, int64_t length, std::shared_ptr<Buffer>* out) {
     if (skip_io_) {
       return Status::OK();
@@ -135,6 +141,10 @@ class ArrayLoader {
       return Status::Invalid("Buffer ", buffer_index_,
                              " did not start on 8-byte aligned offset: ", offset);
     }
+    if (read_ranges_ != nullptr) {
+      read_ranges_->push_back({offset, length});
+      return Status::OK();
+    }
     return file_->ReadAt(offset, length).Value(out);
   }
 
@@ -363,6 +373,7 @@ class ArrayLoader {
   int buffer_index_ = 0;
   int field_index_ = 0;
   bool skip_io_ = false;
+  std::vector<io::ReadRange>* read_ranges_ = NULLPTR;
 
   const Field* field_;
   ArrayData* out_;
@@ -600,6 +611,34 @@ Result<std::shared_ptr<RecordBatch>> ReadRecordBatchInternal(
                          file);
 }
 
+// Compute the body ranges of the buffers of the included fields of a record batch
+Status GetRecordBatchReadRanges(const Buffer& metadata, const Schema& schema,
+                                const std::vector<bool>& inclusion_mask,
+                                const IpcReadOptions& options,
+                                std::vector<io::ReadRange>* out) {
+  const flatbuf::Message* message = nullptr;
+  RETURN_NOT_OK(internal::VerifyMessage(metadata.data(), metadata.size(), &message));
+  auto batch = message->header_as_RecordBatch();
+  if (batch == nullptr) {
+    return Status::IOError(
+        "Header-type of flatbuffer-encoded Message is not RecordBatch.");
+  }
+
+  ArrayLoader loader(batch, internal::GetMetadataVersion(message->version()), options,
+                     /*file=*/NULLPTR);
+  loader.CollectReadRanges(out);
+  for (int i = 0; i < schema.num_fields(); ++i) {
+    const Field& field = *schema.field(i);
+    if (inclusion_mask.empty() || inclusion_mask[i]) {
+      ArrayData column;
+      RETURN_NOT_OK(loader.Load(&field, &column));
+    } else {
+      RETURN_NOT_OK(loader.SkipField(&field));
+    }
+  }
+  return Status::OK();
+}
+
 // If we are selecting only certain fields, populate an inclusion mask for fast lookups.
 // Additionally, drop deselected fields from the reader's schema.
 Status GetInclusionMaskAndOutSchema(const std::shared_ptr<Schema>& full_schema,
@@ -949,6 +988,34 @@ class RecordBatchFileReaderImpl : public RecordBatchFileReader {
     return batch;
   }
 
+  Status WillNeedRecordBatch(int i) override {
+    DCHECK_GE(i, 0);
+    DCHECK_LT(i, num_record_batches());
+
+    const FileBlock block = GetRecordBatchBlock(i);
+    if (!file_->supports_zero_copy()) {
+      // Locating the buffers would require reading the message metadata
+      // synchronously, so advise the whole block instead
+      return file_->WillNeed({{block.offset, block.metadata_length + block.body_length}});
+    }
+
+    // Zero-copy reads of the message don't touch the body
+    ARROW_ASSIGN_OR_RAISE(auto message,
+                          ReadMessage(block.offset, block.metadata_length, file_));
+    CHECK_HAS_BODY(*message);
+    std::vector<io::ReadRange> ranges;
+    RETURN_NOT_OK(GetRecordBatchReadRanges(*message->metadata(), *schema_,
+                                           field_inclusion_mask_, options_, &ranges));
+    const int64_t body_offset = block.offset + block.metadata_length;
+    for (auto& range : ranges) {
+      range.offset += body_offset;
+    }
+    const auto cache_options = io::CacheOptions::Defaults();
+    return file_->WillNeed(io::internal::CoalesceReadRanges(
+        std::move(ranges), cache_options.hole_size_limit,
+        cache_options.range_size_limit));
+  }
+
   Status Open(const std::shared_ptr<io::RandomAccessFile>& file, int64_t footer_offset,
               const IpcReadOptions& options) {
     owned_file_ = file;
@@ -1128,6 +1195,9 @@ Result<std::shared_ptr<RecordBatchFileReader>> RecordBatchFileReader::Open(
   return result;
 }
 
+// Default WillNeedRecordBatch() implementation: no-op
+Status RecordBatchFileReader::WillNeedRecordBatch(int i) { return Status::OK(); }
+
 Status Listener::OnEOS() { return Status::OK(); }
 
 Status Listener::OnSchemaDecoded(std::shared_ptr<Schema> schema) { return Status::OK(); }
@@ -1303,6 +1373,47 @@ Result<std::shared_ptr<Schema>> ReadSchema(const Message& message,
   return result;
 }
 
+Result<std::shared_ptr<RecordBatch>> ReadBatchStatistics(
+    const RecordBatchFileReader& reader) {
+  auto metadata = reader.metadata();
+  if (metadata == nullptr) {
+    return nullptr;
+  }
+  const int index = metadata->FindKey(internal::kBatchStatisticsKey);
+  if (index == -1) {
+    return nullptr;
+  }
+  auto buffer = Buffer::FromString(util::base64_decode(metadata->value(index)));
+  ARROW_ASSIGN_OR_RAISE(
+      auto stream_reader,
+      RecordBatchStreamReader::Open(std::make_shared<io::BufferReader>(buffer)));
+  std::shared_ptr<RecordBatch> statistics;
+  RETURN_NOT_OK(stream_reader->ReadNext(&statistics));
+
+  const auto& file_schema = *reader.schema();
+  if (statistics == nullptr ||
+      statistics->num_columns() != file_schema.num_fields() + 1 ||
+      statistics->num_rows() != reader.num_record_batches() ||
+      !statistics->schema()->fields().back()->type()->Equals(*int64())) {
+    return Status::Invalid("Batch statistics don't match the IPC file layout");
+  }
+  for (int i = 0; i < file_schema.num_fields(); ++i) {
+    const auto& type = statistics->column(i)->type();
+    if (type->id() != Type::STRUCT ||
+        statistics->schema()->field(i)->name() != file_schema.field(i)->name()) {
+      return Status::Invalid("Batch statistics don't match the IPC file schema");
+    }
+    for (const auto& child : type->fields()) {
+      const auto& expected_type =
+          child->name() == "null_count" ? int64() : file_schema.field(i)->type();
+      if (!child->type()->Equals(*expected_type)) {
+        return Status::Invalid("Batch statistics don't match the IPC file schema");
+      }
+    }
+  }
+  return statistics;
+}
+
 Result<std::shared_ptr<Tensor>> ReadTensor(io::InputStream* file) {
   std::unique_ptr<Message> message;
   RETURN_NOT_OK(ReadContiguousPayload(file, &message));
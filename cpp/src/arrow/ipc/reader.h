@@ -167,6 +167,17 @@ class ARROW_EXPORT RecordBatchFileReader {
   /// \return the read batch
   virtual Result<std::shared_ptr<RecordBatch>> ReadRecordBatch(int i) = 0;
 
+  /// \brief Advise the file that a record batch will be read soon
+  ///
+  /// The byte ranges of the fields selected by IpcReadOptions::included_fields
+  /// are passed to RandomAccessFile::WillNeed(), so that e.g. a memory-mapped
+  /// file can fault them in while the previous batch is being processed.
+  /// If the file doesn't support zero-copy reads, the whole batch is advised.
+  /// The default implementation does nothing.
+  ///
+  /// \param[in] i the index of the record batch
+  virtual Status WillNeedRecordBatch(int i);
+
   /// \brief Return current read statistics
   virtual ReadStats stats() const = 0;
 };
@@ -437,6 +448,22 @@ Result<std::shared_ptr<RecordBatch>> ReadRecordBatch(
     const DictionaryMemo* dictionary_memo, const IpcReadOptions& options,
     io::RandomAccessFile* file);
 
+/// \brief Read the per-batch column statistics stored in an IPC file footer
+///
+/// The returned RecordBatch has one row per record batch in the file.  Its
+/// columns match the fields of the file schema by position and name, and are
+/// structs with a "null_count" field and, if the field type is orderable,
+/// "min" and "max" fields (null when unknown).  A final "num_rows" column
+/// holds the length of each batch.
+///
+/// \param[in] reader an open file reader
+/// \return the statistics, or null if the file was written without them
+///
+/// \see IpcWriteOptions::write_batch_statistics
+ARROW_EXPORT
+Result<std::shared_ptr<RecordBatch>> ReadBatchStatistics(
+    const RecordBatchFileReader& reader);
+
 /// \brief Read arrow::Tensor as encapsulated IPC message in file
 ///
 /// \param[in] file an InputStream pointed at the start of the message
@@ -18,6 +18,7 @@
 #include "arrow/ipc/writer.h"
 
 #include <algorithm>
+#include <cmath>
 #include <cstdint>
 #include <cstring>
 #include <limits>
@@ -29,6 +30,7 @@
 #include <vector>
 
 #include "arrow/array.h"
+#include "arrow/builder.h"
 #include "arrow/buffer.h"
 #include "arrow/device.h"
 #include "arrow/extension_type.h"
@@ -45,6 +47,7 @@
 #include "arrow/table.h"
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
+#include "arrow/util/base64.h"
 #include "arrow/util/bit_util.h"
 #include "arrow/util/bitmap_ops.h"
 #include "arrow/util/checked_cast.h"
@@ -66,6 +69,7 @@ namespace ipc {
 
 using internal::FileBlock;
 using internal::kArrowMagicBytes;
+using internal::kBatchStatisticsKey;
 
 namespace {
 
@@ -956,6 +960,212 @@ Status RecordBatchWriter::WriteTable(const Table& table, int64_t max_chunksize)
 
 Status RecordBatchWriter::WriteTable(const Table& table) { return WriteTable(table, -1); }
 
+// ----------------------------------------------------------------------
+// Record batch statistics
+
+namespace internal {
+
+namespace {
+
+template <typename T>
+using is_statistics_ordered_type =
+    std::integral_constant<bool, (has_c_type<T>::value && !is_interval_type<T>::value &&
+                                  !std::is_same<T, HalfFloatType>::value) ||
+                                     is_base_binary_type<T>::value>;
+
+template <typename T>
+bool IsNaN(T value) {
+  return false;
+}
+
+bool IsNaN(float value) { return std::isnan(value); }
+
+bool IsNaN(double value) { return std::isnan(value); }
+
+// Append the minimum and maximum values of an array to the given builders
+struct MinMaxAppender {
+  // Longer binary values aren't recorded, to keep the footer small
+  static constexpr int64_t kMaxBinaryValueSize = 64;
+
+  template <typename T>
+  enable_if_t<is_statistics_ordered_type<T>::value && has_c_type<T>::value, Status> Visit(
+      const T&) {
+    return AppendMinMax<T, typename T::c_type>();
+  }
+
+  template <typename T>
+  enable_if_base_binary<T, Status> Visit(const T&) {
+    return AppendMinMax<T, util::string_view>();
+  }
+
+  template <typename T>
+  enable_if_t<!is_statistics_ordered_type<T>::value, Status> Visit(const T&) {
+    return Status::OK();
+  }
+
+  template <typename T, typename ValueType>
+  Status AppendMinMax() {
+    bool has_value = false;
+    ValueType min{}, max{};
+    VisitArrayDataInline<T>(
+        data,
+        [&](ValueType value) {
+          if (IsNaN(value)) {
+            return;
+          }
+          if (!has_value) {
+            min = max = value;
+            has_value = true;
+          } else {
+            min = std::min(min, value);
+            max = std::max(max, value);
+          }
+        },
+        [] {});
+
+    using BuilderType = typename TypeTraits<T>::BuilderType;
+    auto min_builder = checked_cast<BuilderType*>(this->min_builder);
+    auto max_builder = checked_cast<BuilderType*>(this->max_builder);
+    if (!has_value || !FitsStatistics(min) || !FitsStatistics(max)) {
+      RETURN_NOT_OK(min_builder->AppendNull());
+      return max_builder->AppendNull();
+    }
+    RETURN_NOT_OK(min_builder->Append(min));
+    return max_builder->Append(max);
+  }
+
+  template <typename ValueType>
+  static bool FitsStatistics(const ValueType&) {
+    return true;
+  }
+
+  static bool FitsStatistics(const util::string_view& value) {
+    return static_cast<int64_t>(value.size()) <= kMaxBinaryValueSize;
+  }
+
+  const ArrayData& data;
+  ArrayBuilder* min_builder;
+  ArrayBuilder* max_builder;
+};
+
+struct IsStatisticsOrderedType {
+  template <typename T>
+  Status Visit(const T&) {
+    result = is_statistics_ordered_type<T>::value;
+    return Status::OK();
+  }
+
+  bool result = false;
+};
+
+bool HasMinMaxStatistics(const DataType& type) {
+  IsStatisticsOrderedType visitor;
+  DCHECK_OK(VisitTypeInline(type, &visitor));
+  return visitor.result;
+}
+
+}  // namespace
+
+// Accumulates per-column statistics of the record batches written to an IPC file
+class BatchStatisticsCollector {
+ public:
+  BatchStatisticsCollector(std::shared_ptr<Schema> schema, const IpcWriteOptions& options)
+      : schema_(std::move(schema)),
+        options_(options),
+        columns_(schema_->num_fields()),
+        num_rows_builder_(options.memory_pool) {}
+
+  Status Append(const RecordBatch& batch) {
+    if (!initialized_) {
+      RETURN_NOT_OK(Init());
+    }
+    RETURN_NOT_OK(num_rows_builder_.Append(batch.num_rows()));
+    for (int i = 0; i < batch.num_columns(); ++i) {
+      const ArrayData& data = *batch.column_data(i);
+      auto& column = columns_[i];
+      RETURN_NOT_OK(column.null_count->Append(data.GetNullCount()));
+      if (column.min) {
+        MinMaxAppender appender{data, column.min.get(), column.max.get()};
+        RETURN_NOT_OK(VisitTypeInline(*data.type, &appender));
+      }
+    }
+    return Status::OK();
+  }
+
+  /// Return the statistics of all batches, serialized for the footer
+  Result<std::string> Finish() {
+    if (!initialized_) {
+      RETURN_NOT_OK(Init());
+    }
+    std::vector<std::shared_ptr<Field>> fields;
+    ArrayVector columns;
+    for (int i = 0; i < schema_->num_fields(); ++i) {
+      auto& column = columns_[i];
+      ArrayVector children(1);
+      std::vector<std::string> names = {"null_count"};
+      RETURN_NOT_OK(column.null_count->Finish(&children[0]));
+      if (column.min) {
+        children.resize(3);
+        names.push_back("min");
+        names.push_back("max");
+        RETURN_NOT_OK(column.min->Finish(&children[1]));
+        RETURN_NOT_OK(column.max->Finish(&children[2]));
+      }
+      ARROW_ASSIGN_OR_RAISE(auto struct_array, StructArray::Make(children, names));
+      fields.push_back(field(schema_->field(i)->name(), struct_array->type()));
+      columns.push_back(std::move(struct_array));
+    }
+    fields.push_back(field("num_rows", int64()));
+    columns.emplace_back();
+    RETURN_NOT_OK(num_rows_builder_.Finish(&columns.back()));
+
+    const int64_t num_batches = columns.back()->length();
+    auto batch = RecordBatch::Make(::arrow::schema(std::move(fields)), num_batches,
+                                   std::move(columns));
+
+    auto options = IpcWriteOptions::Defaults();
+    options.memory_pool = options_.memory_pool;
+    ARROW_ASSIGN_OR_RAISE(auto sink, io::BufferOutputStream::Create(
+                                         1024, options_.memory_pool));
+    ARROW_ASSIGN_OR_RAISE(auto writer, MakeStreamWriter(sink, batch->schema(), options));
+    RETURN_NOT_OK(writer->WriteRecordBatch(*batch));
+    RETURN_NOT_OK(writer->Close());
+    ARROW_ASSIGN_OR_RAISE(auto buffer, sink->Finish());
+    return ::arrow::util::base64_encode(buffer->data(),
+                                        static_cast<unsigned int>(buffer->size()));
+  }
+
+ private:
+  struct ColumnBuilders {
+    std::unique_ptr<Int64Builder> null_count;
+    // Null if min/max statistics aren't supported for the column type
+    std::unique_ptr<ArrayBuilder> min;
+    std::unique_ptr<ArrayBuilder> max;
+  };
+
+  Status Init() {
+    for (int i = 0; i < schema_->num_fields(); ++i) {
+      const auto& type = schema_->field(i)->type();
+      auto& column = columns_[i];
+      column.null_count.reset(new Int64Builder(options_.memory_pool));
+      if (HasMinMaxStatistics(*type)) {
+        RETURN_NOT_OK(MakeBuilder(options_.memory_pool, type, &column.min));
+        RETURN_NOT_OK(MakeBuilder(options_.memory_pool, type, &column.max));
+      }
+    }
+    initialized_ = true;
+    return Status::OK();
+  }
+
+  std::shared_ptr<Schema> schema_;
+  const IpcWriteOptions options_;
+  bool initialized_ = false;
+  std::vector<ColumnBuilders> columns_;
+  Int64Builder num_rows_builder_;
+};
+
+}  // namespace internal
+
 // ----------------------------------------------------------------------
 // Payload writer implementation
 
@@ -970,18 +1180,22 @@ class ARROW_EXPORT IpcFormatWriter : public RecordBatchWriter {
   // A RecordBatchWriter implementation that writes to a IpcPayloadWriter.
   IpcFormatWriter(std::unique_ptr<internal::IpcPayloadWriter> payload_writer,
                   const Schema& schema, const IpcWriteOptions& options,
-                  bool is_file_format)
+                  bool is_file_format,
+                  std::shared_ptr<BatchStatisticsCollector> statistics = NULLPTR)
       : payload_writer_(std::move(payload_writer)),
         schema_(schema),
         mapper_(schema),
         is_file_format_(is_file_format),
+        statistics_(std::move(statistics)),
         options_(options) {}
 
   // A Schema-owning constructor variant
   IpcFormatWriter(std::unique_ptr<internal::IpcPayloadWriter> payload_writer,
                   const std::shared_ptr<Schema>& schema, const IpcWriteOptions& options,
-                  bool is_file_format)
-      : IpcFormatWriter(std::move(payload_writer), *schema, options, is_file_format) {
+                  bool is_file_format,
+                  std::shared_ptr<BatchStatisticsCollector> statistics = NULLPTR)
+      : IpcFormatWriter(std::move(payload_writer), *schema, options, is_file_format,
+                        std::move(statistics)) {
     shared_schema_ = schema;
   }
 
@@ -998,6 +1212,9 @@ class ARROW_EXPORT IpcFormatWriter : public RecordBatchWriter {
     RETURN_NOT_OK(GetRecordBatchPayload(batch, options_, &payload));
     RETURN_NOT_OK(WritePayload(payload));
     ++stats_.num_record_batches;
+    if (statistics_) {
+      RETURN_NOT_OK(statistics_->Append(batch));
+    }
     return Status::OK();
   }
 
@@ -1105,6 +1322,8 @@ class ARROW_EXPORT IpcFormatWriter : public RecordBatchWriter {
   const Schema& schema_;
   const DictionaryFieldMapper mapper_;
   const bool is_file_format_;
+  // Shared with the PayloadFileWriter, which writes them in the footer
+  std::shared_ptr<BatchStatisticsCollector> statistics_;
 
   // A map of last-written dictionaries by id.
   // This is required to avoid the same dictionary again and again,
@@ -1203,14 +1422,20 @@ class PayloadFileWriter : public internal::IpcPayloadWriter, protected StreamBoo
  public:
   PayloadFileWriter(const IpcWriteOptions& options, const std::shared_ptr<Schema>& schema,
                     const std::shared_ptr<const KeyValueMetadata>& metadata,
-                    io::OutputStream* sink)
-      : StreamBookKeeper(options, sink), schema_(schema), metadata_(metadata) {}
+                    io::OutputStream* sink,
+                    std::shared_ptr<BatchStatisticsCollector> statistics = NULLPTR)
+      : StreamBookKeeper(options, sink),
+        schema_(schema),
+        metadata_(metadata),
+        statistics_(std::move(statistics)) {}
   PayloadFileWriter(const IpcWriteOptions& options, const std::shared_ptr<Schema>& schema,
                     const std::shared_ptr<const KeyValueMetadata>& metadata,
-                    std::shared_ptr<io::OutputStream> sink)
+                    std::shared_ptr<io::OutputStream> sink,
+                    std::shared_ptr<BatchStatisticsCollector> statistics = NULLPTR)
       : StreamBookKeeper(options, std::move(sink)),
         schema_(schema),
-        metadata_(metadata) {}
+        metadata_(metadata),
+        statistics_(std::move(statistics)) {}
 
   ~PayloadFileWriter() override = default;
 
@@ -1257,11 +1482,19 @@ class PayloadFileWriter : public internal::IpcPayloadWriter, protected StreamBoo
     // Write 0 EOS message for compatibility with sequential readers
     RETURN_NOT_OK(WriteEOS());
 
+    auto metadata = metadata_;
+    if (statistics_) {
+      ARROW_ASSIGN_OR_RAISE(auto encoded_statistics, statistics_->Finish());
+      auto new_metadata = metadata ? metadata->Copy() : key_value_metadata({}, {});
+      RETURN_NOT_OK(new_metadata->Set(kBatchStatisticsKey, encoded_statistics));
+      metadata = std::move(new_metadata);
+    }
+
     // Write file footer
     RETURN_NOT_OK(UpdatePosition());
     int64_t initial_position = position_;
     RETURN_NOT_OK(
-        WriteFileFooter(*schema_, dictionaries_, record_batches_, metadata_, sink_));
+        WriteFileFooter(*schema_, dictionaries_, record_batches_, metadata, sink_));
 
     // Write footer length
     RETURN_NOT_OK(UpdatePosition());
@@ -1281,6 +1514,7 @@ class PayloadFileWriter : public internal::IpcPayloadWriter, protected StreamBoo
  protected:
   std::shared_ptr<Schema> schema_;
   std::shared_ptr<const KeyValueMetadata> metadata_;
+  std::shared_ptr<BatchStatisticsCollector> statistics_;
   std::vector<FileBlock> dictionaries_;
   std::vector<FileBlock> record_batches_;
 };
@@ -1310,24 +1544,35 @@ Result<std::shared_ptr<RecordBatchWriter>> NewStreamWriter(
   return MakeStreamWriter(sink, schema, options);
 }
 
+static std::shared_ptr<internal::BatchStatisticsCollector> MakeStatisticsCollector(
+    const std::shared_ptr<Schema>& schema, const IpcWriteOptions& options) {
+  if (!options.write_batch_statistics) {
+    return nullptr;
+  }
+  return std::make_shared<internal::BatchStatisticsCollector>(schema, options);
+}
+
 Result<std::shared_ptr<RecordBatchWriter>> MakeFileWriter(
     io::OutputStream* sink, const std::shared_ptr<Schema>& schema,
     const IpcWriteOptions& options,
     const std::shared_ptr<const KeyValueMetadata>& metadata) {
+  auto statistics = MakeStatisticsCollector(schema, options);
   return std::make_shared<internal::IpcFormatWriter>(
       ::arrow::internal::make_unique<internal::PayloadFileWriter>(options, schema,
-                                                                  metadata, sink),
-      schema, options, /*is_file_format=*/true);
+                                                                  metadata, sink,
+                                                                  statistics),
+      schema, options, /*is_file_format=*/true, statistics);
 }
 
 Result<std::shared_ptr<RecordBatchWriter>> MakeFileWriter(
     std::shared_ptr<io::OutputStream> sink, const std::shared_ptr<Schema>& schema,
     const IpcWriteOptions& options,
     const std::shared_ptr<const KeyValueMetadata>& metadata) {
+  auto statistics = MakeStatisticsCollector(schema, options);
   return std::make_shared<internal::IpcFormatWriter>(
       ::arrow::internal::make_unique<internal::PayloadFileWriter>(
-          options, schema, metadata, std::move(sink)),
-      schema, options, /*is_file_format=*/true);
+          options, schema, metadata, std::move(sink), statistics),
+      schema, options, /*is_file_format=*/true, statistics);
 }
 
 Result<std::shared_ptr<RecordBatchWriter>> NewFileWriter(
@@ -21,6 +21,7 @@
 #include <memory>
 
 #include "arrow/json/type_fwd.h"
+#include "arrow/util/cancel.h"
 #include "arrow/util/visibility.h"
 
 namespace arrow {
@@ -65,6 +66,9 @@ struct ARROW_EXPORT ReadOptions {
   /// Block size we request from the IO layer; also determines the size of
   /// chunks when use_threads is true
   int32_t block_size = 1 << 20;  // 1 MB
+  /// A token polled between blocks; once a stop was requested, reading fails with
+  /// the error given to StopSource::RequestStop()
+  StopToken stop_token;
 
   /// Create read options with default values
   static ReadOptions Defaults();
@@ -81,6 +81,7 @@ class TableReaderImpl : public TableReader,
     while (block != nullptr) {
       std::shared_ptr<Buffer> next_block, whole, completion, next_partial;
 
+      RETURN_NOT_OK(read_options_.stop_token.Poll());
       ARROW_ASSIGN_OR_RAISE(next_block, block_iterator_.Next());
 
       if (next_block == nullptr) {
@@ -98,6 +99,7 @@ class TableReaderImpl : public TableReader,
 
       // Launch parse task
       task_group_->Append([self, partial, completion, whole, block_index] {
+        RETURN_NOT_OK(self->read_options_.stop_token.Poll());
         return self->ParseAndInsert(partial, completion, whole, block_index);
       });
       block_index++;
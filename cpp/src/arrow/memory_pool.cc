@@ -18,14 +18,27 @@
 #include "arrow/memory_pool.h"
 
 #include <algorithm>  // IWYU pragma: keep
+#include <atomic>
+#include <cerrno>
+#include <cmath>
 #include <cstdlib>    // IWYU pragma: keep
 #include <cstring>    // IWYU pragma: keep
+#include <fstream>
+#include <functional>
 #include <iostream>   // IWYU pragma: keep
 #include <limits>
 #include <memory>
+#include <mutex>
+#include <random>
+#include <sstream>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include "arrow/result.h"
 #include "arrow/status.h"
+#include "arrow/util/bit_util.h"
 #include "arrow/util/io_util.h"
 #include "arrow/util/logging.h"  // IWYU pragma: keep
 #include "arrow/util/optional.h"
@@ -42,6 +55,15 @@
 #include <mimalloc.h>
 #endif
 
+#ifdef ARROW_WITH_BACKTRACE
+#include <execinfo.h>
+#endif
+
+#ifdef __linux__
+#define ARROW_HUGE_PAGES
+#include <sys/mman.h>
+#endif
+
 #ifdef ARROW_JEMALLOC
 
 // Compile-time configuration for jemalloc options.
@@ -94,7 +116,7 @@ constexpr size_t kAlignment = 64;
 
 constexpr char kDefaultBackendEnvVar[] = "ARROW_DEFAULT_MEMORY_POOL";
 
-enum class MemoryPoolBackend : uint8_t { System, Jemalloc, Mimalloc };
+enum class MemoryPoolBackend : uint8_t { System, Jemalloc, Mimalloc, HugePages };
 
 struct SupportedBackend {
   const char* name;
@@ -108,6 +130,9 @@ std::vector<SupportedBackend> SupportedBackends() {
 #endif
 #ifdef ARROW_MIMALLOC
       {"mimalloc", MemoryPoolBackend::Mimalloc},
+#endif
+#ifdef ARROW_HUGE_PAGES
+      {"hugepages", MemoryPoolBackend::HugePages},
 #endif
       {"system", MemoryPoolBackend::System}};
   return backends;
@@ -335,6 +360,114 @@ class MimallocAllocator {
 
 #endif  // defined(ARROW_MIMALLOC)
 
+#ifdef ARROW_HUGE_PAGES
+
+// The size of a huge page on x86-64 and (with 4 KiB base pages) AArch64
+constexpr int64_t kHugePageSize = 2 * 1024 * 1024;
+
+// Allocations smaller than this go to the regular allocator: they would waste
+// most of a huge page, and are unlikely to cause TLB pressure anyway.
+constexpr int64_t kHugePageThreshold = kHugePageSize;
+
+#ifdef ARROW_JEMALLOC
+using SmallAllocator = JemallocAllocator;
+#elif defined(ARROW_MIMALLOC)
+using SmallAllocator = MimallocAllocator;
+#else
+using SmallAllocator = SystemAllocator;
+#endif
+
+// Whether MAP_HUGETLB allocations may succeed.  Reset on the first failure, which
+// happens when no huge pages were reserved (see vm.nr_hugepages) or they are
+// exhausted, so as not to pay a failed system call on each allocation.
+std::atomic<bool> hugetlb_available{true};
+
+// Helper class serving large allocations from huge pages, and forwarding
+// small ones to the regular allocator.
+//
+// Large allocations are mapped directly, from the explicitly reserved huge page
+// pool (MAP_HUGETLB) if possible, otherwise as anonymous memory aligned on a
+// huge page boundary and marked eligible for transparent huge pages.
+class HugePageAllocator {
+ public:
+  static Status AllocateAligned(int64_t size, uint8_t** out) {
+    if (size < kHugePageThreshold) {
+      return SmallAllocator::AllocateAligned(size, out);
+    }
+    const size_t length = MappedLength(size);
+#ifdef MAP_HUGETLB
+    if (hugetlb_available.load(std::memory_order_relaxed)) {
+      void* addr = mmap(nullptr, length, PROT_READ | PROT_WRITE,
+                        MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+      if (addr != MAP_FAILED) {
+        *out = reinterpret_cast<uint8_t*>(addr);
+        return Status::OK();
+      }
+      hugetlb_available.store(false, std::memory_order_relaxed);
+    }
+#endif
+    // Over-allocate, then trim the mapping down to a huge page-aligned range
+    const size_t padded_length = length + kHugePageSize;
+    void* addr = mmap(nullptr, padded_length, PROT_READ | PROT_WRITE,
+                      MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (addr == MAP_FAILED) {
+      return Status::OutOfMemory("mmap of size ", size, " failed: ", strerror(errno));
+    }
+    auto base = reinterpret_cast<uint8_t*>(addr);
+    auto aligned = reinterpret_cast<uint8_t*>(BitUtil::RoundUpToPowerOf2(
+        static_cast<uint64_t>(reinterpret_cast<uintptr_t>(base)),
+        static_cast<uint64_t>(kHugePageSize)));
+    const size_t head = static_cast<size_t>(aligned - base);
+    const size_t tail = padded_length - length - head;
+    if (head > 0) {
+      munmap(base, head);
+    }
+    if (tail > 0) {
+      munmap(aligned + length, tail);
+    }
+#ifdef MADV_HUGEPAGE
+    // Only advisory: this fails if transparent huge pages are disabled
+    madvise(aligned, length, MADV_HUGEPAGE);
+#endif
+    *out = aligned;
+    return Status::OK();
+  }
+
+  static Status ReallocateAligned(int64_t old_size, int64_t new_size, uint8_t** ptr) {
+    if (old_size < kHugePageThreshold && new_size < kHugePageThreshold) {
+      return SmallAllocator::ReallocateAligned(old_size, new_size, ptr);
+    }
+    if (old_size >= kHugePageThreshold && new_size >= kHugePageThreshold &&
+        MappedLength(old_size) == MappedLength(new_size)) {
+      // Still fits in the same mapping
+      return Status::OK();
+    }
+    uint8_t* out = nullptr;
+    RETURN_NOT_OK(AllocateAligned(new_size, &out));
+    memcpy(out, *ptr, static_cast<size_t>(std::min(new_size, old_size)));
+    DeallocateAligned(*ptr, old_size);
+    *ptr = out;
+    return Status::OK();
+  }
+
+  static void DeallocateAligned(uint8_t* ptr, int64_t size) {
+    if (size < kHugePageThreshold) {
+      SmallAllocator::DeallocateAligned(ptr, size);
+    } else {
+      munmap(ptr, MappedLength(size));
+    }
+  }
+
+ private:
+  static size_t MappedLength(int64_t size) {
+    // Huge page mappings must span a whole number of huge pages
+    return static_cast<size_t>(BitUtil::RoundUpToPowerOf2(
+        static_cast<uint64_t>(size), static_cast<uint64_t>(kHugePageSize)));
+  }
+};
+
+#endif  // defined(ARROW_HUGE_PAGES)
+
 }  // namespace
 
 int64_t MemoryPool::max_memory() const { return -1; }
@@ -437,6 +570,13 @@ class MimallocMemoryPool : public BaseMemoryPoolImpl<MimallocAllocator> {
 };
 #endif
 
+#ifdef ARROW_HUGE_PAGES
+class HugePageMemoryPool : public BaseMemoryPoolImpl<HugePageAllocator> {
+ public:
+  std::string backend_name() const override { return "hugepages"; }
+};
+#endif
+
 std::unique_ptr<MemoryPool> MemoryPool::CreateDefault() {
   auto backend = DefaultBackend();
   switch (backend) {
@@ -449,6 +589,10 @@ std::unique_ptr<MemoryPool> MemoryPool::CreateDefault() {
 #ifdef ARROW_MIMALLOC
     case MemoryPoolBackend::Mimalloc:
       return std::unique_ptr<MemoryPool>(new MimallocMemoryPool);
+#endif
+#ifdef ARROW_HUGE_PAGES
+    case MemoryPoolBackend::HugePages:
+      return std::unique_ptr<MemoryPool>(new HugePageMemoryPool);
 #endif
     default:
       ARROW_LOG(FATAL) << "Internal error: cannot create default memory pool";
@@ -463,6 +607,9 @@ static JemallocMemoryPool jemalloc_pool;
 #ifdef ARROW_MIMALLOC
 static MimallocMemoryPool mimalloc_pool;
 #endif
+#ifdef ARROW_HUGE_PAGES
+static HugePageMemoryPool hugepage_pool;
+#endif
 
 MemoryPool* system_memory_pool() { return &system_pool; }
 
@@ -484,6 +631,15 @@ Status mimalloc_memory_pool(MemoryPool** out) {
 #endif
 }
 
+Status hugepage_memory_pool(MemoryPool** out) {
+#ifdef ARROW_HUGE_PAGES
+  *out = &hugepage_pool;
+  return Status::OK();
+#else
+  return Status::NotImplemented("This platform does not support huge pages");
+#endif
+}
+
 MemoryPool* default_memory_pool() {
   auto backend = DefaultBackend();
   switch (backend) {
@@ -496,6 +652,10 @@ MemoryPool* default_memory_pool() {
 #ifdef ARROW_MIMALLOC
     case MemoryPoolBackend::Mimalloc:
       return &mimalloc_pool;
+#endif
+#ifdef ARROW_HUGE_PAGES
+    case MemoryPoolBackend::HugePages:
+      return &hugepage_pool;
 #endif
     default:
       ARROW_LOG(FATAL) << "Internal error: cannot create default memory pool";
@@ -623,6 +783,933 @@ int64_t ProxyMemoryPool::max_memory() const { return impl_->max_memory(); }
 
 std::string ProxyMemoryPool::backend_name() const { return impl_->backend_name(); }
 
+///////////////////////////////////////////////////////////////////////
+// ArenaMemoryPool implementation
+
+constexpr int64_t ArenaMemoryPool::kDefaultMinChunkSize;
+
+class ArenaMemoryPool::ArenaMemoryPoolImpl {
+ public:
+  // Chunks don't grow beyond this, unless a larger allocation requires it
+  static constexpr int64_t kMaxChunkSize = int64_t(64) << 20;  // 64 MB
+
+  ArenaMemoryPoolImpl(MemoryPool* pool, int64_t min_chunk_size)
+      : pool_(pool),
+        min_chunk_size_(std::max<int64_t>(BitUtil::RoundUpToMultipleOf64(min_chunk_size),
+                                          kAlignment)) {}
+
+  ~ArenaMemoryPoolImpl() {
+    DCHECK_EQ(bytes_allocated_, 0);
+    for (const auto& chunk : chunks_) {
+      pool_->Free(chunk.data, chunk.size);
+    }
+  }
+
+  Status Allocate(int64_t size, uint8_t** out) {
+    if (size == 0) {
+      *out = zero_size_area;
+      return Status::OK();
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    RETURN_NOT_OK(AllocateUnlocked(size, out));
+    UpdateAllocatedBytesUnlocked(size);
+    return Status::OK();
+  }
+
+  Status Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) {
+    if (*ptr == zero_size_area) {
+      DCHECK_EQ(old_size, 0);
+      return Allocate(new_size, ptr);
+    }
+    if (new_size == 0) {
+      Free(*ptr, old_size);
+      *ptr = zero_size_area;
+      return Status::OK();
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (IsLastAllocationUnlocked(*ptr, old_size)) {
+      // Grow or shrink in place if the current chunk allows it
+      Chunk& chunk = chunks_.back();
+      const int64_t offset = *ptr - chunk.data;
+      const int64_t new_end = offset + BitUtil::RoundUpToMultipleOf64(new_size);
+      if (new_end <= chunk.size) {
+        chunk.used = new_end;
+        UpdateAllocatedBytesUnlocked(new_size - old_size);
+        return Status::OK();
+      }
+    }
+    uint8_t* out;
+    RETURN_NOT_OK(AllocateUnlocked(new_size, &out));
+    memcpy(out, *ptr, static_cast<size_t>(std::min(new_size, old_size)));
+    FreeUnlocked(*ptr, old_size);
+    *ptr = out;
+    UpdateAllocatedBytesUnlocked(new_size - old_size);
+    return Status::OK();
+  }
+
+  void Free(uint8_t* buffer, int64_t size) {
+    if (buffer == zero_size_area) {
+      DCHECK_EQ(size, 0);
+      return;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    FreeUnlocked(buffer, size);
+    UpdateAllocatedBytesUnlocked(-size);
+  }
+
+  void Reset() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    DCHECK_EQ(bytes_allocated_, 0) << "ArenaMemoryPool reset with live allocations";
+    if (chunks_.empty()) {
+      return;
+    }
+    // The last chunk is the largest one
+    for (size_t i = 0; i + 1 < chunks_.size(); ++i) {
+      pool_->Free(chunks_[i].data, chunks_[i].size);
+      bytes_reserved_ -= chunks_[i].size;
+    }
+    chunks_.erase(chunks_.begin(), chunks_.end() - 1);
+    chunks_.back().used = 0;
+    bytes_allocated_ = 0;
+  }
+
+  int64_t bytes_allocated() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return bytes_allocated_;
+  }
+
+  int64_t max_memory() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return max_memory_;
+  }
+
+  int64_t bytes_reserved() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return bytes_reserved_;
+  }
+
+  std::string backend_name() const { return pool_->backend_name(); }
+
+ private:
+  struct Chunk {
+    uint8_t* data;
+    int64_t size;
+    int64_t used;
+  };
+
+  Status AllocateUnlocked(int64_t size, uint8_t** out) {
+    const int64_t padded_size = BitUtil::RoundUpToMultipleOf64(size);
+    if (chunks_.empty() || chunks_.back().size - chunks_.back().used < padded_size) {
+      RETURN_NOT_OK(AddChunkUnlocked(padded_size));
+    }
+    Chunk& chunk = chunks_.back();
+    *out = chunk.data + chunk.used;
+    chunk.used += padded_size;
+    return Status::OK();
+  }
+
+  Status AddChunkUnlocked(int64_t min_size) {
+    int64_t chunk_size =
+        chunks_.empty() ? min_chunk_size_
+                        : std::min(chunks_.back().size * 2,
+                                   std::max(kMaxChunkSize, chunks_.back().size));
+    chunk_size = std::max(chunk_size, min_size);
+    uint8_t* data;
+    RETURN_NOT_OK(pool_->Allocate(chunk_size, &data));
+    chunks_.push_back({data, chunk_size, 0});
+    bytes_reserved_ += chunk_size;
+    return Status::OK();
+  }
+
+  bool IsLastAllocationUnlocked(uint8_t* buffer, int64_t size) const {
+    if (chunks_.empty()) {
+      return false;
+    }
+    const Chunk& chunk = chunks_.back();
+    return buffer >= chunk.data &&
+           buffer + BitUtil::RoundUpToMultipleOf64(size) == chunk.data + chunk.used;
+  }
+
+  void FreeUnlocked(uint8_t* buffer, int64_t size) {
+    // Only the most recent allocation can be reclaimed before Reset()
+    if (IsLastAllocationUnlocked(buffer, size)) {
+      chunks_.back().used = buffer - chunks_.back().data;
+    }
+  }
+
+  void UpdateAllocatedBytesUnlocked(int64_t diff) {
+    bytes_allocated_ += diff;
+    max_memory_ = std::max(max_memory_, bytes_allocated_);
+  }
+
+  MemoryPool* pool_;
+  const int64_t min_chunk_size_;
+  mutable std::mutex mutex_;
+  std::vector<Chunk> chunks_;
+  int64_t bytes_allocated_ = 0;
+  int64_t max_memory_ = 0;
+  int64_t bytes_reserved_ = 0;
+};
+
+constexpr int64_t ArenaMemoryPool::ArenaMemoryPoolImpl::kMaxChunkSize;
+
+ArenaMemoryPool::ArenaMemoryPool(MemoryPool* pool, int64_t min_chunk_size)
+    : impl_(new ArenaMemoryPoolImpl(pool, min_chunk_size)) {}
+
+ArenaMemoryPool::~ArenaMemoryPool() {}
+
+Status ArenaMemoryPool::Allocate(int64_t size, uint8_t** out) {
+  return impl_->Allocate(size, out);
+}
+
+Status ArenaMemoryPool::Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) {
+  return impl_->Reallocate(old_size, new_size, ptr);
+}
+
+void ArenaMemoryPool::Free(uint8_t* buffer, int64_t size) { impl_->Free(buffer, size); }
+
+void ArenaMemoryPool::Reset() { impl_->Reset(); }
+
+int64_t ArenaMemoryPool::bytes_allocated() const { return impl_->bytes_allocated(); }
+
+int64_t ArenaMemoryPool::max_memory() const { return impl_->max_memory(); }
+
+int64_t ArenaMemoryPool::bytes_reserved() const { return impl_->bytes_reserved(); }
+
+std::string ArenaMemoryPool::backend_name() const { return impl_->backend_name(); }
+
+///////////////////////////////////////////////////////////////////////
+// CappedMemoryPool implementation
+
+CappedMemoryPool::CappedMemoryPool(MemoryPool* pool, int64_t limit)
+    : pool_(pool), limit_(limit), reserved_(0) {}
+
+CappedMemoryPool::~CappedMemoryPool() {}
+
+Status CappedMemoryPool::Reserve(int64_t size) {
+  // Reserve the bytes before allocating them, so that concurrent allocations
+  // can't together exceed the limit
+  int64_t reserved = reserved_.load();
+  do {
+    if (size > 0 && reserved + size > limit_) {
+      return Status::OutOfMemory("Allocation of ", size, " bytes would exceed the ",
+                                 "memory pool limit of ", limit_, " bytes (",
+                                 reserved, " bytes already allocated)");
+    }
+  } while (!reserved_.compare_exchange_weak(reserved, reserved + size));
+  return Status::OK();
+}
+
+Status CappedMemoryPool::Allocate(int64_t size, uint8_t** out) {
+  RETURN_NOT_OK(Reserve(size));
+  Status st = pool_->Allocate(size, out);
+  if (!st.ok()) {
+    reserved_.fetch_sub(size);
+    return st;
+  }
+  stats_.UpdateAllocatedBytes(size);
+  return Status::OK();
+}
+
+Status CappedMemoryPool::Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) {
+  RETURN_NOT_OK(Reserve(new_size - old_size));
+  Status st = pool_->Reallocate(old_size, new_size, ptr);
+  if (!st.ok()) {
+    reserved_.fetch_sub(new_size - old_size);
+    return st;
+  }
+  stats_.UpdateAllocatedBytes(new_size - old_size);
+  return Status::OK();
+}
+
+void CappedMemoryPool::Free(uint8_t* buffer, int64_t size) {
+  pool_->Free(buffer, size);
+  stats_.UpdateAllocatedBytes(-size);
+  reserved_.fetch_sub(size);
+}
+
+int64_t CappedMemoryPool::bytes_allocated() const { return stats_.bytes_allocated(); }
+
+int64_t CappedMemoryPool::max_memory() const { return stats_.max_memory(); }
+
+std::string CappedMemoryPool::backend_name() const { return pool_->backend_name(); }
+
+///////////////////////////////////////////////////////////////////////
+// RecyclingMemoryPool implementation
+
+constexpr int64_t RecyclingMemoryPool::kDefaultMaxRetainedBytes;
+
+namespace {
+
+// Size classes are 64 bytes, then four classes per power of two (80, 96, 112,
+// 128, 160...), so that rounding up wastes at most 25% of a block.
+constexpr int64_t kMinSizeClass = 64;
+constexpr int64_t kMaxSizeClass = int64_t(64) << 20;
+constexpr int kNumSizeClasses = 81;
+
+// A thread's free lists don't grow beyond this many blocks per size class; half
+// of them are then moved to the shared free lists.
+constexpr size_t kMaxThreadCachedBlocks = 16;
+
+bool IsRecyclable(int64_t size) { return size > 0 && size <= kMaxSizeClass; }
+
+int SizeClassIndex(int64_t size) {
+  if (size <= kMinSizeClass) return 0;
+  const int log = 63 - BitUtil::CountLeadingZeros(static_cast<uint64_t>(size - 1));
+  const int64_t step = int64_t(1) << (log - 2);
+  return (log - 6) * 4 + static_cast<int>((size - 1 - (int64_t(1) << log)) / step) + 1;
+}
+
+int64_t SizeClassBytes(int index) {
+  if (index == 0) return kMinSizeClass;
+  const int log = (index - 1) / 4 + 6;
+  return (int64_t(1) << log) + ((index - 1) % 4 + 1) * (int64_t(1) << (log - 2));
+}
+
+// The free blocks of a thread, by size class
+struct RecyclingThreadCache {
+  // Only contended when trimming
+  std::mutex mutex;
+  std::vector<uint8_t*> blocks[kNumSizeClasses];
+};
+
+std::atomic<uint64_t> next_recycling_pool_id{0};
+
+}  // namespace
+
+class RecyclingMemoryPool::RecyclingMemoryPoolImpl
+    : public std::enable_shared_from_this<RecyclingMemoryPoolImpl> {
+ public:
+  RecyclingMemoryPoolImpl(MemoryPool* pool, int64_t max_retained_bytes)
+      : pool_(pool),
+        max_retained_bytes_(max_retained_bytes),
+        id_(next_recycling_pool_id.fetch_add(1)) {
+    DCHECK_EQ(SizeClassIndex(kMaxSizeClass), kNumSizeClasses - 1);
+  }
+
+  ~RecyclingMemoryPoolImpl() {
+    // Threads exiting after this won't give back their free lists
+    for (const auto& cache : thread_caches_) {
+      std::lock_guard<std::mutex> lock(cache->mutex);
+      FreeBlocks(cache->blocks, /*target=*/0);
+    }
+    FreeBlocks(shared_blocks_, /*target=*/0);
+  }
+
+  Status Allocate(int64_t size, uint8_t** out) {
+    if (!IsRecyclable(size)) {
+      RETURN_NOT_OK(pool_->Allocate(size, out));
+    } else {
+      const int index = SizeClassIndex(size);
+      if (!PopBlock(index, out)) {
+        RETURN_NOT_OK(pool_->Allocate(SizeClassBytes(index), out));
+      }
+    }
+    stats_.UpdateAllocatedBytes(size);
+    return Status::OK();
+  }
+
+  Status Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) {
+    if (!IsRecyclable(old_size) && !IsRecyclable(new_size)) {
+      RETURN_NOT_OK(pool_->Reallocate(old_size, new_size, ptr));
+      stats_.UpdateAllocatedBytes(new_size - old_size);
+      return Status::OK();
+    }
+    if (IsRecyclable(old_size) && IsRecyclable(new_size) &&
+        SizeClassIndex(old_size) == SizeClassIndex(new_size)) {
+      // Still fits in the same block
+      stats_.UpdateAllocatedBytes(new_size - old_size);
+      return Status::OK();
+    }
+    uint8_t* out;
+    RETURN_NOT_OK(Allocate(new_size, &out));
+    memcpy(out, *ptr, static_cast<size_t>(std::min(old_size, new_size)));
+    Free(*ptr, old_size);
+    *ptr = out;
+    return Status::OK();
+  }
+
+  void Free(uint8_t* buffer, int64_t size) {
+    if (!IsRecyclable(size)) {
+      pool_->Free(buffer, size);
+    } else {
+      const int index = SizeClassIndex(size);
+      const int64_t block_size = SizeClassBytes(index);
+      if (bytes_retained_.fetch_add(block_size) + block_size > max_retained_bytes_) {
+        bytes_retained_.fetch_sub(block_size);
+        pool_->Free(buffer, block_size);
+      } else {
+        PushBlock(index, buffer);
+      }
+    }
+    stats_.UpdateAllocatedBytes(-size);
+  }
+
+  void Trim(int64_t target) {
+    std::vector<std::shared_ptr<RecyclingThreadCache>> caches;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      FreeBlocks(shared_blocks_, target);
+      caches = thread_caches_;
+    }
+    for (const auto& cache : caches) {
+      std::lock_guard<std::mutex> lock(cache->mutex);
+      FreeBlocks(cache->blocks, target);
+    }
+  }
+
+  // Called when a thread exits: its free blocks are moved to the shared lists
+  void ReleaseThreadCache(const std::shared_ptr<RecyclingThreadCache>& cache) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    {
+      std::lock_guard<std::mutex> cache_lock(cache->mutex);
+      for (int index = 0; index < kNumSizeClasses; ++index) {
+        auto& blocks = cache->blocks[index];
+        shared_blocks_[index].insert(shared_blocks_[index].end(), blocks.begin(),
+                                     blocks.end());
+        blocks.clear();
+      }
+    }
+    thread_caches_.erase(
+        std::remove(thread_caches_.begin(), thread_caches_.end(), cache),
+        thread_caches_.end());
+  }
+
+  int64_t bytes_allocated() const { return stats_.bytes_allocated(); }
+
+  int64_t max_memory() const { return stats_.max_memory(); }
+
+  int64_t bytes_retained() const { return bytes_retained_.load(); }
+
+  std::string backend_name() const { return pool_->backend_name(); }
+
+ private:
+  // The free lists of the current thread, for each RecyclingMemoryPool it used
+  struct ThreadCaches {
+    struct Entry {
+      uint64_t pool_id;
+      std::weak_ptr<RecyclingMemoryPoolImpl> pool;
+      std::shared_ptr<RecyclingThreadCache> cache;
+    };
+
+    ~ThreadCaches() {
+      for (const auto& entry : entries) {
+        if (auto pool = entry.pool.lock()) {
+          pool->ReleaseThreadCache(entry.cache);
+        }
+      }
+    }
+
+    std::vector<Entry> entries;
+  };
+
+  static thread_local ThreadCaches thread_caches;
+
+  RecyclingThreadCache* LocalCache();
+
+  bool PopBlock(int index, uint8_t** out) {
+    RecyclingThreadCache* cache = LocalCache();
+    {
+      std::lock_guard<std::mutex> lock(cache->mutex);
+      auto& blocks = cache->blocks[index];
+      if (!blocks.empty()) {
+        *out = blocks.back();
+        blocks.pop_back();
+        bytes_retained_.fetch_sub(SizeClassBytes(index));
+        return true;
+      }
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto& blocks = shared_blocks_[index];
+    if (!blocks.empty()) {
+      *out = blocks.back();
+      blocks.pop_back();
+      bytes_retained_.fetch_sub(SizeClassBytes(index));
+      return true;
+    }
+    return false;
+  }
+
+  void PushBlock(int index, uint8_t* block) {
+    RecyclingThreadCache* cache = LocalCache();
+    std::vector<uint8_t*> overflow;
+    {
+      std::lock_guard<std::mutex> lock(cache->mutex);
+      auto& blocks = cache->blocks[index];
+      blocks.push_back(block);
+      if (blocks.size() > kMaxThreadCachedBlocks) {
+        const auto half = blocks.begin() + kMaxThreadCachedBlocks / 2;
+        overflow.assign(blocks.begin(), half);
+        blocks.erase(blocks.begin(), half);
+      }
+    }
+    if (!overflow.empty()) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      shared_blocks_[index].insert(shared_blocks_[index].end(), overflow.begin(),
+                                   overflow.end());
+    }
+  }
+
+  // Free blocks, largest first, until at most `target` bytes are retained
+  void FreeBlocks(std::vector<uint8_t*>* lists, int64_t target) {
+    for (int index = kNumSizeClasses - 1; index >= 0; --index) {
+      const int64_t block_size = SizeClassBytes(index);
+      auto& blocks = lists[index];
+      while (!blocks.empty() && bytes_retained_.load() > target) {
+        pool_->Free(blocks.back(), block_size);
+        blocks.pop_back();
+        bytes_retained_.fetch_sub(block_size);
+      }
+    }
+  }
+
+  MemoryPool* pool_;
+  const int64_t max_retained_bytes_;
+  // Distinguishes this pool from destroyed pools at the same address
+  const uint64_t id_;
+  std::atomic<int64_t> bytes_retained_{0};
+  internal::MemoryPoolStats stats_;
+
+  // Protects shared_blocks_ and thread_caches_
+  std::mutex mutex_;
+  std::vector<uint8_t*> shared_blocks_[kNumSizeClasses];
+  std::vector<std::shared_ptr<RecyclingThreadCache>> thread_caches_;
+};
+
+thread_local RecyclingMemoryPool::RecyclingMemoryPoolImpl::ThreadCaches
+    RecyclingMemoryPool::RecyclingMemoryPoolImpl::thread_caches;
+
+RecyclingThreadCache* RecyclingMemoryPool::RecyclingMemoryPoolImpl::LocalCache() {
+  auto& entries = thread_caches.entries;
+  for (const auto& entry : entries) {
+    if (entry.pool_id == id_) {
+      return entry.cache.get();
+    }
+  }
+  // First use of this pool from this thread; forget destroyed pools
+  entries.erase(std::remove_if(entries.begin(), entries.end(),
+                               [](const ThreadCaches::Entry& entry) {
+                                 return entry.pool.expired();
+                               }),
+                entries.end());
+  auto cache = std::make_shared<RecyclingThreadCache>();
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    thread_caches_.push_back(cache);
+  }
+  entries.push_back({id_, shared_from_this(), cache});
+  return cache.get();
+}
+
+RecyclingMemoryPool::RecyclingMemoryPool(MemoryPool* pool, int64_t max_retained_bytes)
+    : impl_(std::make_shared<RecyclingMemoryPoolImpl>(pool, max_retained_bytes)) {}
+
+RecyclingMemoryPool::~RecyclingMemoryPool() {}
+
+Status RecyclingMemoryPool::Allocate(int64_t size, uint8_t** out) {
+  return impl_->Allocate(size, out);
+}
+
+Status RecyclingMemoryPool::Reallocate(int64_t old_size, int64_t new_size,
+                                       uint8_t** ptr) {
+  return impl_->Reallocate(old_size, new_size, ptr);
+}
+
+void RecyclingMemoryPool::Free(uint8_t* buffer, int64_t size) {
+  impl_->Free(buffer, size);
+}
+
+void RecyclingMemoryPool::Trim(int64_t max_bytes) { impl_->Trim(max_bytes); }
+
+int64_t RecyclingMemoryPool::bytes_allocated() const { return impl_->bytes_allocated(); }
+
+int64_t RecyclingMemoryPool::max_memory() const { return impl_->max_memory(); }
+
+int64_t RecyclingMemoryPool::bytes_retained() const { return impl_->bytes_retained(); }
+
+std::string RecyclingMemoryPool::backend_name() const { return impl_->backend_name(); }
+
+///////////////////////////////////////////////////////////////////////
+// ProfilingMemoryPool implementation
+
+constexpr int64_t ProfilingMemoryPool::kDefaultSamplePeriod;
+
+namespace {
+
+thread_local const char* current_allocation_tag = nullptr;
+
+// The sampling state of a thread.  The distance to the next sample is counted in
+// sample periods and drawn from an exponential distribution of mean 1, which
+// makes sampling memoryless: the state can be shared by pools with different
+// periods, and an allocation of `size` bytes is sampled with probability
+// 1 - exp(-size / period) regardless of the allocations preceding it.
+//
+// This is trivially constructible so that accessing it needs no initialization
+// check.
+struct AllocationSampler {
+  double periods_until_sample;
+  bool started;
+};
+
+thread_local AllocationSampler allocation_sampler;
+
+ARROW_NOINLINE
+bool NextAllocationSample(AllocationSampler* sampler) {
+  static std::atomic<uint64_t> next_seed{0};
+  thread_local std::mt19937_64 rng(
+      std::hash<std::thread::id>()(std::this_thread::get_id()) ^ next_seed.fetch_add(1));
+  std::exponential_distribution<double> distribution;
+  if (!sampler->started) {
+    // First allocation on this thread: draw the distance to the first sample
+    sampler->started = true;
+    sampler->periods_until_sample += distribution(rng);
+    if (sampler->periods_until_sample > 0) {
+      return false;
+    }
+  }
+  sampler->periods_until_sample = distribution(rng);
+  return true;
+}
+
+// Whether to sample an allocation of `periods` sample periods
+inline bool SampleAllocation(double periods) {
+  auto* sampler = &allocation_sampler;
+  sampler->periods_until_sample -= periods;
+  if (ARROW_PREDICT_TRUE(sampler->periods_until_sample > 0)) {
+    return false;
+  }
+  return NextAllocationSample(sampler);
+}
+
+// Frees have to find out whether their pointer was sampled.  Sampled pointers are
+// counted in a hashed table of counters, so that the vast majority of frees only
+// need to check a zero counter rather than take a lock.
+constexpr int kSampledPointerBits = 14;
+
+inline uint64_t SampledPointerSlot(const uint8_t* ptr) {
+  return (reinterpret_cast<uintptr_t>(ptr) >> 6) * 0x9E3779B97F4A7C15ULL >>
+         (64 - kSampledPointerBits);
+}
+
+// The frames of ProfilingMemoryPool and its implementation at the top of
+// captured stacks
+constexpr int kProfilerFrames = 2;
+
+}  // namespace
+
+class ProfilingMemoryPool::ProfilingMemoryPoolImpl {
+ public:
+  ProfilingMemoryPoolImpl(MemoryPool* pool, Options options)
+      : pool_(pool),
+        options_(options),
+        inverse_period_(1.0 / static_cast<double>(std::max<int64_t>(
+                                  options.sample_period, 1))),
+        sampled_pointers_(new std::atomic<int32_t>[1 << kSampledPointerBits]) {
+    ClearSampledPointers();
+  }
+
+  Status Allocate(int64_t size, uint8_t** out) {
+    RETURN_NOT_OK(pool_->Allocate(size, out));
+    stats_.UpdateAllocatedBytes(size);
+    MaybeSample(*out, size);
+    return Status::OK();
+  }
+
+  // A reallocation is profiled as a free followed by an allocation.  The old
+  // pointer is forgotten first, as another thread may get it once reallocated.
+  Status Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) {
+    ForgetSample(*ptr);
+    RETURN_NOT_OK(pool_->Reallocate(old_size, new_size, ptr));
+    stats_.UpdateAllocatedBytes(new_size - old_size);
+    MaybeSample(*ptr, new_size);
+    return Status::OK();
+  }
+
+  void Free(uint8_t* buffer, int64_t size) {
+    ForgetSample(buffer);
+    pool_->Free(buffer, size);
+    stats_.UpdateAllocatedBytes(-size);
+  }
+
+  int64_t bytes_allocated() const { return stats_.bytes_allocated(); }
+
+  int64_t max_memory() const { return stats_.max_memory(); }
+
+  std::string backend_name() const { return pool_->backend_name(); }
+
+  std::vector<Site> GetSites() const {
+    std::vector<Site> sites;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      sites.reserve(sites_.size());
+      for (const auto& record : sites_) {
+        Site site;
+        site.tag = record.tag;
+        site.stack = record.stack;
+        site.allocations = std::llround(record.allocations);
+        site.allocated_bytes = std::llround(record.allocated_bytes);
+        site.frees = std::llround(record.frees);
+        site.freed_bytes = std::llround(record.freed_bytes);
+        sites.push_back(std::move(site));
+      }
+    }
+    std::stable_sort(sites.begin(), sites.end(), [](const Site& a, const Site& b) {
+      return a.live_bytes() > b.live_bytes();
+    });
+    return sites;
+  }
+
+  std::string Report() const {
+    const auto sites = GetSites();
+    int64_t live_bytes = 0, allocated_bytes = 0;
+    for (const auto& site : sites) {
+      live_bytes += site.live_bytes();
+      allocated_bytes += site.allocated_bytes;
+    }
+    std::stringstream ss;
+    ss << "Sampled allocations (sample period " << options_.sample_period
+       << " bytes): " << live_bytes << " bytes live, " << allocated_bytes
+       << " bytes allocated in total\n";
+    for (const auto& site : sites) {
+      ss << "\n"
+         << site.live_bytes() << " bytes live in " << site.live_allocations()
+         << " allocations, " << site.allocated_bytes << " bytes allocated in "
+         << site.allocations << " allocations, " << site.freed_bytes
+         << " bytes freed: " << (site.tag.empty() ? "(untagged)" : site.tag) << "\n";
+      for (const auto& frame : SymbolizeStack(site.stack)) {
+        ss << "    " << frame << "\n";
+      }
+    }
+    return ss.str();
+  }
+
+  std::string PprofHeapProfile() const {
+    const auto sites = GetSites();
+    Site total;
+    for (const auto& site : sites) {
+      total.allocations += site.allocations;
+      total.allocated_bytes += site.allocated_bytes;
+      total.frees += site.frees;
+      total.freed_bytes += site.freed_bytes;
+    }
+    auto counts = [](const Site& site) {
+      std::stringstream ss;
+      ss << site.live_allocations() << ": " << site.live_bytes() << " ["
+         << site.allocations << ": " << site.allocated_bytes << "]";
+      return ss.str();
+    };
+    std::stringstream ss;
+    // The counts are already scaled, hence "heapprofile" rather than a sampled
+    // heap profile type which pprof would scale again
+    ss << "heap profile: " << counts(total) << " @ heapprofile\n";
+    for (const auto& site : sites) {
+      ss << counts(site) << " @";
+      for (const auto address : site.stack) {
+        ss << " 0x" << std::hex << address << std::dec;
+      }
+      ss << "\n";
+    }
+#ifdef __linux__
+    std::ifstream maps("/proc/self/maps");
+    if (maps) {
+      ss << "\nMAPPED_LIBRARIES:\n" << maps.rdbuf();
+    }
+#endif
+    return ss.str();
+  }
+
+  void ResetProfile() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    sites_.clear();
+    site_index_.clear();
+    samples_.clear();
+    ClearSampledPointers();
+  }
+
+ private:
+  struct SiteRecord {
+    std::string tag;
+    std::vector<uintptr_t> stack;
+    double allocations = 0;
+    double allocated_bytes = 0;
+    double frees = 0;
+    double freed_bytes = 0;
+  };
+
+  struct Sample {
+    size_t site;
+    // The number of allocations this sample stands for
+    double weight;
+    int64_t size;
+  };
+
+  void MaybeSample(uint8_t* ptr, int64_t size) {
+    if (size <= 0) {
+      return;
+    }
+    if (options_.sample_period <= 1) {
+      RecordSample(ptr, size, 1.0);
+      return;
+    }
+    const double periods = static_cast<double>(size) * inverse_period_;
+    if (ARROW_PREDICT_FALSE(SampleAllocation(periods))) {
+      // The inverse of the probability of sampling the allocation
+      RecordSample(ptr, size, -1.0 / std::expm1(-periods));
+    }
+  }
+
+  ARROW_NOINLINE
+  void RecordSample(uint8_t* ptr, int64_t size, double weight) {
+    std::vector<uintptr_t> stack;
+#ifdef ARROW_WITH_BACKTRACE
+    if (options_.capture_stacks && options_.max_stack_depth > 0) {
+      std::vector<void*> frames(options_.max_stack_depth + kProfilerFrames);
+      const int depth = backtrace(frames.data(), static_cast<int>(frames.size()));
+      for (int i = kProfilerFrames; i < depth; ++i) {
+        stack.push_back(reinterpret_cast<uintptr_t>(frames[i]));
+      }
+    }
+#endif
+    const char* tag = current_allocation_tag;
+    std::string key = tag != nullptr ? tag : "";
+    key.push_back('\0');
+    key.append(reinterpret_cast<const char*>(stack.data()),
+               stack.size() * sizeof(uintptr_t));
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = site_index_.find(key);
+    if (it == site_index_.end()) {
+      it = site_index_.emplace(std::move(key), sites_.size()).first;
+      SiteRecord record;
+      record.tag = tag != nullptr ? tag : "";
+      record.stack = std::move(stack);
+      sites_.push_back(std::move(record));
+    }
+    auto& record = sites_[it->second];
+    record.allocations += weight;
+    record.allocated_bytes += weight * static_cast<double>(size);
+    // A pointer can't be sampled twice as it was freed in between, but be
+    // defensive against a stale entry
+    auto inserted = samples_.emplace(ptr, Sample{it->second, weight, size});
+    if (inserted.second) {
+      sampled_pointers_[SampledPointerSlot(ptr)].fetch_add(1);
+    } else {
+      inserted.first->second = Sample{it->second, weight, size};
+    }
+  }
+
+  void ForgetSample(uint8_t* ptr) {
+    auto& counter = sampled_pointers_[SampledPointerSlot(ptr)];
+    if (ARROW_PREDICT_TRUE(counter.load(std::memory_order_acquire) == 0)) {
+      return;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = samples_.find(ptr);
+    if (it == samples_.end()) {
+      return;
+    }
+    const auto& sample = it->second;
+    auto& record = sites_[sample.site];
+    record.frees += sample.weight;
+    record.freed_bytes += sample.weight * static_cast<double>(sample.size);
+    samples_.erase(it);
+    counter.fetch_sub(1);
+  }
+
+  void ClearSampledPointers() {
+    for (int i = 0; i < (1 << kSampledPointerBits); ++i) {
+      sampled_pointers_[i].store(0);
+    }
+  }
+
+  static std::vector<std::string> SymbolizeStack(const std::vector<uintptr_t>& stack) {
+    std::vector<std::string> frames;
+#ifdef ARROW_WITH_BACKTRACE
+    if (stack.empty()) {
+      return frames;
+    }
+    std::vector<void*> addresses;
+    for (const auto address : stack) {
+      addresses.push_back(reinterpret_cast<void*>(address));
+    }
+    char** symbols = backtrace_symbols(addresses.data(), static_cast<int>(stack.size()));
+    if (symbols != nullptr) {
+      frames.assign(symbols, symbols + stack.size());
+      std::free(symbols);
+      return frames;
+    }
+#endif
+    for (const auto address : stack) {
+      std::stringstream ss;
+      ss << "0x" << std::hex << address;
+      frames.push_back(ss.str());
+    }
+    return frames;
+  }
+
+  MemoryPool* pool_;
+  const Options options_;
+  const double inverse_period_;
+  internal::MemoryPoolStats stats_;
+
+  std::unique_ptr<std::atomic<int32_t>[]> sampled_pointers_;
+  // Protects sites_, site_index_ and samples_
+  mutable std::mutex mutex_;
+  std::vector<SiteRecord> sites_;
+  // Sites by tag and stack
+  std::unordered_map<std::string, size_t> site_index_;
+  // Live sampled allocations
+  std::unordered_map<uint8_t*, Sample> samples_;
+};
+
+ProfilingMemoryPool::ProfilingMemoryPool(MemoryPool* pool)
+    : ProfilingMemoryPool(pool, Options()) {}
+
+ProfilingMemoryPool::ProfilingMemoryPool(MemoryPool* pool, Options options)
+    : impl_(new ProfilingMemoryPoolImpl(pool, options)) {}
+
+ProfilingMemoryPool::~ProfilingMemoryPool() {}
+
+Status ProfilingMemoryPool::Allocate(int64_t size, uint8_t** out) {
+  return impl_->Allocate(size, out);
+}
+
+Status ProfilingMemoryPool::Reallocate(int64_t old_size, int64_t new_size,
+                                       uint8_t** ptr) {
+  return impl_->Reallocate(old_size, new_size, ptr);
+}
+
+void ProfilingMemoryPool::Free(uint8_t* buffer, int64_t size) {
+  impl_->Free(buffer, size);
+}
+
+int64_t ProfilingMemoryPool::bytes_allocated() const { return impl_->bytes_allocated(); }
+
+int64_t ProfilingMemoryPool::max_memory() const { return impl_->max_memory(); }
+
+std::string ProfilingMemoryPool::backend_name() const { return impl_->backend_name(); }
+
+std::vector<ProfilingMemoryPool::Site> ProfilingMemoryPool::GetSites() const {
+  return impl_->GetSites();
+}
+
+std::string ProfilingMemoryPool::Report() const { return impl_->Report(); }
+
+std::string ProfilingMemoryPool::PprofHeapProfile() const {
+  return impl_->PprofHeapProfile();
+}
+
+void ProfilingMemoryPool::ResetProfile() { impl_->ResetProfile(); }
+
+ScopedAllocationTag::ScopedAllocationTag(const char* tag)
+    : previous_(current_allocation_tag) {
+  current_allocation_tag = tag;
+}
+
+ScopedAllocationTag::~ScopedAllocationTag() { current_allocation_tag = previous_; }
+
+const char* ScopedAllocationTag::current() { return current_allocation_tag; }
+
 std::vector<std::string> SupportedMemoryBackendNames() {
   std::vector<std::string> supported;
   for (const auto backend : supported_backends) {
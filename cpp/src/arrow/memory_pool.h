@@ -21,6 +21,7 @@
 #include <cstdint>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "arrow/status.h"
 #include "arrow/type_fwd.h"
@@ -149,6 +150,229 @@ class ARROW_EXPORT ProxyMemoryPool : public MemoryPool {
   std::unique_ptr<ProxyMemoryPoolImpl> impl_;
 };
 
+/// \brief A bump-pointer MemoryPool for short-lived scratch allocations.
+///
+/// Memory is carved out of chunks obtained from a parent pool, each new chunk
+/// being twice as large as the previous one (up to a maximum).  Allocations are
+/// 64-byte aligned like those of the other pools.  Freeing only reclaims memory
+/// when the most recent allocation is freed; otherwise memory is reclaimed all
+/// at once by Reset().  This makes allocating and freeing the many temporary
+/// buffers of a batch almost free.
+///
+/// The pool is thread-safe.  All buffers allocated from it must have been
+/// freed before calling Reset().
+class ARROW_EXPORT ArenaMemoryPool : public MemoryPool {
+ public:
+  static constexpr int64_t kDefaultMinChunkSize = 1 << 20;  // 1 MB
+
+  explicit ArenaMemoryPool(MemoryPool* pool = default_memory_pool(),
+                           int64_t min_chunk_size = kDefaultMinChunkSize);
+  ~ArenaMemoryPool() override;
+
+  Status Allocate(int64_t size, uint8_t** out) override;
+  Status Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) override;
+
+  void Free(uint8_t* buffer, int64_t size) override;
+
+  /// \brief Make all the arena's memory available for allocation again.
+  ///
+  /// Only the largest chunk is kept, the others are returned to the parent pool.
+  void Reset();
+
+  int64_t bytes_allocated() const override;
+
+  int64_t max_memory() const override;
+
+  /// The number of bytes held from the parent pool
+  int64_t bytes_reserved() const;
+
+  std::string backend_name() const override;
+
+ private:
+  class ArenaMemoryPoolImpl;
+  std::unique_ptr<ArenaMemoryPoolImpl> impl_;
+};
+
+/// \brief A MemoryPool enforcing a hard limit on the bytes allocated through it.
+///
+/// Allocations are delegated to a parent pool.  An allocation (or reallocation)
+/// which would bring the pool's usage above the limit fails with OutOfMemory,
+/// regardless of the memory available to the parent.  This allows attributing
+/// memory to, and bounding the memory of, a given query or operation.
+class ARROW_EXPORT CappedMemoryPool : public MemoryPool {
+ public:
+  CappedMemoryPool(MemoryPool* pool, int64_t limit);
+  ~CappedMemoryPool() override;
+
+  Status Allocate(int64_t size, uint8_t** out) override;
+  Status Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) override;
+
+  void Free(uint8_t* buffer, int64_t size) override;
+
+  int64_t bytes_allocated() const override;
+
+  int64_t max_memory() const override;
+
+  std::string backend_name() const override;
+
+  /// The maximum number of bytes which may be allocated at a time
+  int64_t limit() const { return limit_; }
+
+ private:
+  // Reserve `size` bytes of the limit, or fail with OutOfMemory
+  Status Reserve(int64_t size);
+
+  MemoryPool* pool_;
+  const int64_t limit_;
+  // Bytes allocated or being allocated, checked against the limit
+  std::atomic<int64_t> reserved_;
+  internal::MemoryPoolStats stats_;
+};
+
+/// \brief A MemoryPool recycling freed blocks for later allocations of a similar size.
+///
+/// Allocations are rounded up to a size class (four classes per power of two,
+/// up to 64 MB) and obtained from a parent pool.  Freed blocks are kept on
+/// per-size-class free lists rather than returned to the parent, so that the
+/// identically sized buffers of successive batches reuse the same, already
+/// faulted-in memory.  Each thread has its own free lists, which overflow to
+/// lists shared by all threads.
+///
+/// At most `max_retained_bytes` of free blocks are kept; blocks freed beyond
+/// that are returned to the parent pool, as are all blocks on Trim() and on
+/// destruction.  The pool is thread-safe.
+class ARROW_EXPORT RecyclingMemoryPool : public MemoryPool {
+ public:
+  static constexpr int64_t kDefaultMaxRetainedBytes = int64_t(256) << 20;  // 256 MB
+
+  explicit RecyclingMemoryPool(MemoryPool* pool = default_memory_pool(),
+                               int64_t max_retained_bytes = kDefaultMaxRetainedBytes);
+  ~RecyclingMemoryPool() override;
+
+  Status Allocate(int64_t size, uint8_t** out) override;
+  Status Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) override;
+
+  void Free(uint8_t* buffer, int64_t size) override;
+
+  /// \brief Return free blocks to the parent pool until at most `max_bytes`
+  /// are retained.
+  void Trim(int64_t max_bytes = 0);
+
+  int64_t bytes_allocated() const override;
+
+  int64_t max_memory() const override;
+
+  /// The number of bytes of free blocks held for recycling
+  int64_t bytes_retained() const;
+
+  std::string backend_name() const override;
+
+ private:
+  class RecyclingMemoryPoolImpl;
+  std::shared_ptr<RecyclingMemoryPoolImpl> impl_;
+};
+
+/// \brief A MemoryPool sampling allocations to find out where memory is spent.
+///
+/// Allocations are sampled at an average rate of one every `sample_period` bytes
+/// (a Poisson process over the bytes allocated, as in tcmalloc), so that large
+/// allocations are almost always sampled and the cost of profiling is paid
+/// rarely.  A sample records the allocation's call site: the tag set by the
+/// innermost ScopedAllocationTag of the allocating thread, and optionally the
+/// stack trace.  Sampled allocations are tracked until they are freed, so that
+/// the bytes still allocated by each site can be told apart from those already
+/// freed.  Reported counts and sizes are estimates scaled up from the samples.
+///
+/// The pool is thread-safe.
+class ARROW_EXPORT ProfilingMemoryPool : public MemoryPool {
+ public:
+  static constexpr int64_t kDefaultSamplePeriod = 1 << 20;  // 1 MB
+
+  struct Options {
+    /// The average number of bytes allocated between two samples; 1 samples
+    /// every allocation.
+    int64_t sample_period = kDefaultSamplePeriod;
+    /// Whether to record the stack trace of sampled allocations (if Arrow is
+    /// built with backtrace support).  Unwinding the stack costs a few
+    /// microseconds per sample, so consider raising the sample period when
+    /// enabling this.
+    bool capture_stacks = false;
+    /// The maximum number of frames recorded per stack trace
+    int max_stack_depth = 32;
+  };
+
+  /// The estimated allocations of a call site
+  struct Site {
+    /// The allocation tag in effect, or empty
+    std::string tag;
+    /// The return addresses of the stack trace, innermost first, or empty
+    std::vector<uintptr_t> stack;
+
+    int64_t allocations = 0;
+    int64_t allocated_bytes = 0;
+    int64_t frees = 0;
+    int64_t freed_bytes = 0;
+
+    int64_t live_allocations() const { return allocations - frees; }
+    int64_t live_bytes() const { return allocated_bytes - freed_bytes; }
+  };
+
+  explicit ProfilingMemoryPool(MemoryPool* pool = default_memory_pool());
+  ProfilingMemoryPool(MemoryPool* pool, Options options);
+  ~ProfilingMemoryPool() override;
+
+  Status Allocate(int64_t size, uint8_t** out) override;
+  Status Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) override;
+
+  void Free(uint8_t* buffer, int64_t size) override;
+
+  int64_t bytes_allocated() const override;
+
+  int64_t max_memory() const override;
+
+  std::string backend_name() const override;
+
+  /// \brief Return the call sites seen so far, by decreasing live bytes.
+  std::vector<Site> GetSites() const;
+
+  /// \brief Return a human-readable report of the call sites, by decreasing
+  /// live bytes, with symbolized stack traces.
+  std::string Report() const;
+
+  /// \brief Return a heap profile in the legacy text format understood by pprof.
+  ///
+  /// Profiles are only meaningful to pprof if stacks are captured.  The
+  /// process' memory mappings are appended so that pprof can symbolize them.
+  std::string PprofHeapProfile() const;
+
+  /// \brief Forget the call sites and samples seen so far.
+  void ResetProfile();
+
+ private:
+  class ProfilingMemoryPoolImpl;
+  std::unique_ptr<ProfilingMemoryPoolImpl> impl_;
+};
+
+/// \brief Tag the allocations of the current thread for ProfilingMemoryPool.
+///
+/// Allocations sampled while the tag is in scope are attributed to it (the
+/// innermost tag wins).  `tag` must outlive the scope, typically a string literal
+/// such as "csv-parse".
+class ARROW_EXPORT ScopedAllocationTag {
+ public:
+  explicit ScopedAllocationTag(const char* tag);
+  ~ScopedAllocationTag();
+
+  ScopedAllocationTag(const ScopedAllocationTag&) = delete;
+  ScopedAllocationTag& operator=(const ScopedAllocationTag&) = delete;
+
+  /// The tag in effect on the current thread, or nullptr
+  static const char* current();
+
+ private:
+  const char* previous_;
+};
+
 /// \brief Return a process-wide memory pool based on the system allocator.
 ARROW_EXPORT MemoryPool* system_memory_pool();
 
@@ -173,6 +397,17 @@ Status jemalloc_set_decay_ms(int ms);
 /// May return NotImplemented if mimalloc is not available.
 ARROW_EXPORT Status mimalloc_memory_pool(MemoryPool** out);
 
+/// \brief Return a process-wide memory pool backed by huge pages.
+///
+/// Allocations of 2 MiB or more are mapped on huge page boundaries, from the
+/// reserved huge page pool (MAP_HUGETLB) when the system has one configured,
+/// otherwise as transparent huge page candidates (MADV_HUGEPAGE).  This reduces
+/// TLB misses when randomly accessing large buffers, e.g. in Take.  Smaller
+/// allocations are served by the default allocator.
+///
+/// May return NotImplemented if huge pages are not supported on this platform.
+ARROW_EXPORT Status hugepage_memory_pool(MemoryPool** out);
+
 ARROW_EXPORT std::vector<std::string> SupportedMemoryBackendNames();
 
 }  // namespace arrow
@@ -15,6 +15,11 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <cstring>
+#include <random>
+#include <utility>
+#include <vector>
+
 #include "arrow/memory_pool.h"
 #include "arrow/result.h"
 #include "arrow/util/logging.h"
@@ -25,6 +30,34 @@ namespace arrow {
 
 struct SystemAlloc {
   static Result<MemoryPool*> GetAllocator() { return system_memory_pool(); }
+  static void EndBatch(MemoryPool*) {}
+};
+
+// An arena over the default pool, reset at the end of each batch
+struct ArenaAlloc {
+  static Result<MemoryPool*> GetAllocator() {
+    static ArenaMemoryPool pool;
+    return &pool;
+  }
+  static void EndBatch(MemoryPool* pool) { static_cast<ArenaMemoryPool*>(pool)->Reset(); }
+};
+
+// Recycling blocks of the system allocator
+struct RecyclingAlloc {
+  static Result<MemoryPool*> GetAllocator() {
+    static RecyclingMemoryPool pool(system_memory_pool());
+    return &pool;
+  }
+  static void EndBatch(MemoryPool*) {}
+};
+
+// Profiling allocations of the system allocator at the default sample period
+struct ProfilingAlloc {
+  static Result<MemoryPool*> GetAllocator() {
+    static ProfilingMemoryPool pool(system_memory_pool());
+    return &pool;
+  }
+  static void EndBatch(MemoryPool*) {}
 };
 
 #ifdef ARROW_JEMALLOC
@@ -34,6 +67,7 @@ struct Jemalloc {
     RETURN_NOT_OK(jemalloc_memory_pool(&pool));
     return pool;
   }
+  static void EndBatch(MemoryPool*) {}
 };
 #endif
 
@@ -44,6 +78,18 @@ struct Mimalloc {
     RETURN_NOT_OK(mimalloc_memory_pool(&pool));
     return pool;
   }
+  static void EndBatch(MemoryPool*) {}
+};
+#endif
+
+#ifdef __linux__
+struct HugePageAlloc {
+  static Result<MemoryPool*> GetAllocator() {
+    MemoryPool* pool;
+    RETURN_NOT_OK(hugepage_memory_pool(&pool));
+    return pool;
+  }
+  static void EndBatch(MemoryPool*) {}
 };
 #endif
 
@@ -105,6 +151,167 @@ static void AllocateTouchDeallocate(
   }
 }
 
+// Benchmark the allocation of the scratch buffers of a batch: several buffers
+// are allocated and touched, then all freed (in allocation order) once the
+// batch is done.
+template <typename Alloc>
+static void AllocateBatchScratch(
+    benchmark::State& state) {  // NOLINT non-const reference
+  constexpr int kNumBuffers = 16;
+  const int64_t nbytes = state.range(0);
+  MemoryPool* pool = *Alloc::GetAllocator();
+
+  for (auto _ : state) {
+    uint8_t* data[kNumBuffers];
+    for (int i = 0; i < kNumBuffers; ++i) {
+      ARROW_CHECK_OK(pool->Allocate(nbytes, &data[i]));
+      TouchCacheLines(data[i], nbytes);
+    }
+    for (int i = 0; i < kNumBuffers; ++i) {
+      pool->Free(data[i], nbytes);
+    }
+    Alloc::EndBatch(pool);
+  }
+  state.SetItemsProcessed(state.iterations() * kNumBuffers);
+}
+
+// Benchmark random reads into a large buffer, which are dominated by TLB misses
+// unless the buffer is backed by huge pages.
+template <typename Alloc>
+static void RandomAccess(benchmark::State& state) {  // NOLINT non-const reference
+  constexpr int64_t kNumReads = 1 << 16;
+  const int64_t nbytes = state.range(0);
+  MemoryPool* pool = *Alloc::GetAllocator();
+  uint8_t* data;
+  ARROW_CHECK_OK(pool->Allocate(nbytes, &data));
+  std::memset(data, 1, static_cast<size_t>(nbytes));
+
+  std::default_random_engine rng(42);
+  std::uniform_int_distribution<int64_t> dist(0, nbytes - 1);
+  std::vector<int64_t> offsets(kNumReads);
+  for (auto& offset : offsets) {
+    offset = dist(rng);
+  }
+
+  for (auto _ : state) {
+    uint64_t total = 0;
+    for (const int64_t offset : offsets) {
+      total += data[offset];
+    }
+    benchmark::DoNotOptimize(total);
+  }
+  state.SetItemsProcessed(state.iterations() * kNumReads);
+
+  pool->Free(data, nbytes);
+}
+
+struct TraceOp {
+  enum Kind { ALLOCATE, REALLOCATE, FREE };
+  Kind kind;
+  // Index of the buffer allocated, reallocated or freed
+  int buffer;
+  int64_t size;
+};
+
+// The allocations of a steady-state Parquet scan, batch after batch.  For each
+// batch, each of the 8 columns (4 int64, 2 nullable int32 and 2
+// nullable strings) decompresses its page into a scratch buffer, freed once
+// decoded, and allocates its validity, offsets and values buffers, freed once the
+// consumer is done with the batch.  String data is reallocated as it grows, and
+// its size varies from batch to batch.
+static std::vector<TraceOp> MakeParquetScanTrace(int num_batches, int64_t batch_rows,
+                                                 int* num_buffers) {
+  std::default_random_engine rng(42);
+  std::uniform_int_distribution<int64_t> string_bytes(16 * batch_rows, 24 * batch_rows);
+
+  std::vector<TraceOp> trace;
+  std::vector<std::pair<int, int64_t>> batch_buffers;
+  int next_buffer = 0;
+  auto allocate = [&](int64_t size) {
+    trace.push_back({TraceOp::ALLOCATE, next_buffer, size});
+    return next_buffer++;
+  };
+
+  for (int batch = 0; batch < num_batches; ++batch) {
+    batch_buffers.clear();
+    auto keep = [&](int buffer, int64_t size) {
+      batch_buffers.emplace_back(buffer, size);
+    };
+    for (int column = 0; column < 8; ++column) {
+      const bool nullable = column >= 4;
+      const bool is_string = column >= 6;
+      const int64_t data_size =
+          is_string ? string_bytes(rng) : batch_rows * (nullable ? 4 : 8);
+
+      const int scratch = allocate(data_size);
+      if (nullable) {
+        keep(allocate(batch_rows / 8), batch_rows / 8);
+      }
+      if (is_string) {
+        keep(allocate(4 * (batch_rows + 1)), 4 * (batch_rows + 1));
+        const int values = allocate(data_size / 2);
+        trace.push_back({TraceOp::REALLOCATE, values, data_size});
+        keep(values, data_size);
+      } else {
+        keep(allocate(data_size), data_size);
+      }
+      trace.push_back({TraceOp::FREE, scratch, data_size});
+    }
+    for (const auto& buffer : batch_buffers) {
+      trace.push_back({TraceOp::FREE, buffer.first, buffer.second});
+    }
+  }
+  *num_buffers = next_buffer;
+  return trace;
+}
+
+// Write to each page of a memory area, making sure it is faulted in
+static void TouchPages(uint8_t* data, int64_t nbytes) {
+  for (int64_t i = 0; i < nbytes; i += 4096) {
+    data[i] = 1;
+  }
+}
+
+// Benchmark replaying the allocations of a Parquet scan (see above).  Allocated
+// pages are written to, so that the cost of faulting in fresh memory is included
+// (but not that of decoding the data, which is the same for all allocators).
+template <typename Alloc>
+static void ReplayParquetScanTrace(
+    benchmark::State& state) {  // NOLINT non-const reference
+  constexpr int kNumBatches = 16;
+  int num_buffers;
+  const auto trace = MakeParquetScanTrace(kNumBatches, state.range(0), &num_buffers);
+  MemoryPool* pool = *Alloc::GetAllocator();
+
+  std::vector<uint8_t*> buffers(num_buffers);
+  std::vector<int64_t> sizes(num_buffers);
+  int64_t bytes_allocated = 0;
+  for (auto _ : state) {
+    for (const auto& op : trace) {
+      uint8_t*& data = buffers[op.buffer];
+      switch (op.kind) {
+        case TraceOp::ALLOCATE:
+          ARROW_CHECK_OK(pool->Allocate(op.size, &data));
+          TouchPages(data, op.size);
+          sizes[op.buffer] = op.size;
+          bytes_allocated += op.size;
+          break;
+        case TraceOp::REALLOCATE:
+          ARROW_CHECK_OK(pool->Reallocate(sizes[op.buffer], op.size, &data));
+          TouchPages(data + sizes[op.buffer], op.size - sizes[op.buffer]);
+          bytes_allocated += op.size - sizes[op.buffer];
+          sizes[op.buffer] = op.size;
+          break;
+        case TraceOp::FREE:
+          pool->Free(data, op.size);
+          break;
+      }
+    }
+  }
+  state.SetBytesProcessed(bytes_allocated);
+  state.SetItemsProcessed(state.iterations() * kNumBatches);
+}
+
 #define BENCHMARK_ALLOCATE_ARGS \
   ->RangeMultiplier(16)->Range(4096, 16 * 1024 * 1024)->ArgName("size")->UseRealTime()
 
@@ -115,15 +322,56 @@ BENCHMARK(TouchArea) BENCHMARK_ALLOCATE_ARGS;
 
 BENCHMARK_ALLOCATE(AllocateDeallocate, SystemAlloc);
 BENCHMARK_ALLOCATE(AllocateTouchDeallocate, SystemAlloc);
+BENCHMARK_ALLOCATE(AllocateBatchScratch, SystemAlloc);
+
+BENCHMARK_ALLOCATE(AllocateDeallocate, ArenaAlloc);
+BENCHMARK_ALLOCATE(AllocateTouchDeallocate, ArenaAlloc);
+BENCHMARK_ALLOCATE(AllocateBatchScratch, ArenaAlloc);
 
 #ifdef ARROW_JEMALLOC
 BENCHMARK_ALLOCATE(AllocateDeallocate, Jemalloc);
 BENCHMARK_ALLOCATE(AllocateTouchDeallocate, Jemalloc);
+BENCHMARK_ALLOCATE(AllocateBatchScratch, Jemalloc);
 #endif
 
+BENCHMARK_ALLOCATE(AllocateDeallocate, RecyclingAlloc);
+BENCHMARK_ALLOCATE(AllocateTouchDeallocate, RecyclingAlloc);
+BENCHMARK_ALLOCATE(AllocateBatchScratch, RecyclingAlloc);
+
+BENCHMARK_ALLOCATE(AllocateDeallocate, ProfilingAlloc);
+BENCHMARK_ALLOCATE(AllocateTouchDeallocate, ProfilingAlloc);
+
 #ifdef ARROW_MIMALLOC
 BENCHMARK_ALLOCATE(AllocateDeallocate, Mimalloc);
 BENCHMARK_ALLOCATE(AllocateTouchDeallocate, Mimalloc);
+BENCHMARK_ALLOCATE(AllocateBatchScratch, Mimalloc);
+#endif
+
+#ifdef __linux__
+BENCHMARK_ALLOCATE(AllocateDeallocate, HugePageAlloc);
+BENCHMARK_ALLOCATE(AllocateTouchDeallocate, HugePageAlloc);
+BENCHMARK_ALLOCATE(AllocateBatchScratch, HugePageAlloc);
+#endif
+
+#define BENCHMARK_RANDOM_ACCESS_ARGS \
+  ->RangeMultiplier(8)->Range(1 << 20, 512 << 20)->ArgName("size")
+
+#define BENCHMARK_TRACE_ARGS \
+  ->RangeMultiplier(8)->Range(64 * 1024, 2 * 1024 * 1024)->ArgName("rows")->UseRealTime()
+
+BENCHMARK_TEMPLATE(ReplayParquetScanTrace, SystemAlloc) BENCHMARK_TRACE_ARGS;
+BENCHMARK_TEMPLATE(ReplayParquetScanTrace, RecyclingAlloc) BENCHMARK_TRACE_ARGS;
+BENCHMARK_TEMPLATE(ReplayParquetScanTrace, ProfilingAlloc) BENCHMARK_TRACE_ARGS;
+#ifdef ARROW_JEMALLOC
+BENCHMARK_TEMPLATE(ReplayParquetScanTrace, Jemalloc) BENCHMARK_TRACE_ARGS;
+#endif
+#ifdef ARROW_MIMALLOC
+BENCHMARK_TEMPLATE(ReplayParquetScanTrace, Mimalloc) BENCHMARK_TRACE_ARGS;
+#endif
+
+BENCHMARK_TEMPLATE(RandomAccess, SystemAlloc) BENCHMARK_RANDOM_ACCESS_ARGS;
+#ifdef __linux__
+BENCHMARK_TEMPLATE(RandomAccess, HugePageAlloc) BENCHMARK_RANDOM_ACCESS_ARGS;
 #endif
 
 }  // namespace arrow
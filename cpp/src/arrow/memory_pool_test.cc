@@ -17,6 +17,11 @@
 
 #include <algorithm>
 #include <cstdint>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -55,6 +60,39 @@ struct MimallocMemoryPoolFactory {
 };
 #endif
 
+#ifdef __linux__
+struct HugePageMemoryPoolFactory {
+  static MemoryPool* memory_pool() {
+    MemoryPool* pool;
+    ABORT_NOT_OK(hugepage_memory_pool(&pool));
+    return pool;
+  }
+};
+#endif
+
+struct ArenaMemoryPoolFactory {
+  static MemoryPool* memory_pool() {
+    static ArenaMemoryPool pool(default_memory_pool(), /*min_chunk_size=*/256);
+    return &pool;
+  }
+};
+
+struct RecyclingMemoryPoolFactory {
+  static MemoryPool* memory_pool() {
+    static RecyclingMemoryPool pool;
+    return &pool;
+  }
+};
+
+struct ProfilingMemoryPoolFactory {
+  static MemoryPool* memory_pool() {
+    ProfilingMemoryPool::Options options;
+    options.sample_period = 1;
+    static ProfilingMemoryPool pool(default_memory_pool(), options);
+    return &pool;
+  }
+};
+
 template <typename Factory>
 class TestMemoryPool : public ::arrow::TestMemoryPoolBase {
  public:
@@ -77,6 +115,9 @@ REGISTER_TYPED_TEST_SUITE_P(TestMemoryPool, MemoryTracking, OOM, Reallocate);
 
 INSTANTIATE_TYPED_TEST_SUITE_P(Default, TestMemoryPool, DefaultMemoryPoolFactory);
 INSTANTIATE_TYPED_TEST_SUITE_P(System, TestMemoryPool, SystemMemoryPoolFactory);
+INSTANTIATE_TYPED_TEST_SUITE_P(Arena, TestMemoryPool, ArenaMemoryPoolFactory);
+INSTANTIATE_TYPED_TEST_SUITE_P(Recycling, TestMemoryPool, RecyclingMemoryPoolFactory);
+INSTANTIATE_TYPED_TEST_SUITE_P(Profiling, TestMemoryPool, ProfilingMemoryPoolFactory);
 
 #ifdef ARROW_JEMALLOC
 INSTANTIATE_TYPED_TEST_SUITE_P(Jemalloc, TestMemoryPool, JemallocMemoryPoolFactory);
@@ -86,6 +127,10 @@ INSTANTIATE_TYPED_TEST_SUITE_P(Jemalloc, TestMemoryPool, JemallocMemoryPoolFacto
 INSTANTIATE_TYPED_TEST_SUITE_P(Mimalloc, TestMemoryPool, MimallocMemoryPoolFactory);
 #endif
 
+#ifdef __linux__
+INSTANTIATE_TYPED_TEST_SUITE_P(HugePages, TestMemoryPool, HugePageMemoryPoolFactory);
+#endif
+
 TEST(DefaultMemoryPool, Identity) {
   // The default memory pool is pointer-identical to one of the backend-specific pools.
   MemoryPool* pool = default_memory_pool();
@@ -97,6 +142,10 @@ TEST(DefaultMemoryPool, Identity) {
 #ifdef ARROW_MIMALLOC
   specific_pools.push_back(nullptr);
   ASSERT_OK(mimalloc_memory_pool(&specific_pools.back()));
+#endif
+#ifdef __linux__
+  specific_pools.push_back(nullptr);
+  ASSERT_OK(hugepage_memory_pool(&specific_pools.back()));
 #endif
   ASSERT_NE(std::find(specific_pools.begin(), specific_pools.end(), pool),
             specific_pools.end());
@@ -162,6 +211,320 @@ TEST(ProxyMemoryPool, Logging) {
   ASSERT_EQ(0, pp.bytes_allocated());
 }
 
+TEST(ArenaMemoryPool, BumpAllocation) {
+  auto pool = MemoryPool::CreateDefault();
+  ArenaMemoryPool arena(pool.get(), /*min_chunk_size=*/1024);
+
+  uint8_t *data, *data2, *data3;
+  ASSERT_OK(arena.Allocate(100, &data));
+  ASSERT_OK(arena.Allocate(100, &data2));
+  // Allocations are contiguous, modulo alignment
+  ASSERT_EQ(data + 128, data2);
+  ASSERT_EQ(1024, arena.bytes_reserved());
+  ASSERT_EQ(1024, pool->bytes_allocated());
+
+  // Freeing the last allocation reclaims its memory
+  arena.Free(data2, 100);
+  ASSERT_OK(arena.Allocate(50, &data3));
+  ASSERT_EQ(data2, data3);
+
+  // The last allocation can grow in place
+  data3[0] = 42;
+  ASSERT_OK(arena.Reallocate(50, 500, &data3));
+  ASSERT_EQ(data2, data3);
+  ASSERT_OK(arena.Reallocate(500, 20, &data3));
+  ASSERT_EQ(data2, data3);
+  // ...but not past the end of its chunk
+  ASSERT_OK(arena.Reallocate(20, 1000, &data3));
+  ASSERT_NE(data2, data3);
+  ASSERT_EQ(42, data3[0]);
+  ASSERT_EQ(1100, arena.bytes_allocated());
+
+  // Chunks grow geometrically, and large allocations get a chunk of their own
+  ASSERT_EQ(1024 + 2048, arena.bytes_reserved());
+  ASSERT_OK(arena.Allocate(10000, &data2));
+  ASSERT_EQ(1024 + 2048 + 10048, arena.bytes_reserved());
+
+  arena.Free(data, 100);
+  arena.Free(data2, 10000);
+  arena.Free(data3, 1000);
+  ASSERT_EQ(0, arena.bytes_allocated());
+  ASSERT_EQ(11100, arena.max_memory());
+
+  // Reset keeps the largest chunk only
+  arena.Reset();
+  ASSERT_EQ(10048, arena.bytes_reserved());
+  ASSERT_EQ(10048, pool->bytes_allocated());
+  ASSERT_OK(arena.Allocate(10000, &data));
+  ASSERT_EQ(10048, arena.bytes_reserved());
+  arena.Free(data, 10000);
+}
+
+TEST(RecyclingMemoryPool, Recycling) {
+  auto pool = MemoryPool::CreateDefault();
+  RecyclingMemoryPool rp(pool.get(), /*max_retained_bytes=*/3000);
+
+  uint8_t *data, *data2;
+  ASSERT_OK(rp.Allocate(1000, &data));
+  // Allocations are rounded up to their size class
+  ASSERT_EQ(1024, pool->bytes_allocated());
+  ASSERT_EQ(1000, rp.bytes_allocated());
+  rp.Free(data, 1000);
+  ASSERT_EQ(1024, rp.bytes_retained());
+  ASSERT_EQ(0, rp.bytes_allocated());
+
+  // A freed block is reused for an allocation of the same size class...
+  ASSERT_OK(rp.Allocate(900, &data2));
+  ASSERT_EQ(data, data2);
+  ASSERT_EQ(0, rp.bytes_retained());
+  // ...and can be reallocated in place within it
+  ASSERT_OK(rp.Reallocate(900, 1020, &data2));
+  ASSERT_EQ(data, data2);
+  ASSERT_OK(rp.Reallocate(1020, 2000, &data2));
+  ASSERT_NE(data, data2);
+  ASSERT_EQ(1024, rp.bytes_retained());
+  ASSERT_EQ(1024 + 2048, pool->bytes_allocated());
+
+  // Blocks are freed to the parent pool beyond the retention cap
+  uint8_t* data3;
+  ASSERT_OK(rp.Allocate(1500, &data3));
+  rp.Free(data2, 2000);
+  rp.Free(data3, 1500);
+  ASSERT_EQ(1024 + 1536, rp.bytes_retained());
+  ASSERT_EQ(1024 + 1536, pool->bytes_allocated());
+
+  // Larger blocks are trimmed first
+  rp.Trim(1500);
+  ASSERT_EQ(1024, rp.bytes_retained());
+  rp.Trim();
+  ASSERT_EQ(0, rp.bytes_retained());
+  ASSERT_EQ(0, pool->bytes_allocated());
+  ASSERT_EQ(3500, rp.max_memory());
+}
+
+TEST(RecyclingMemoryPool, Threads) {
+  constexpr int kNumThreads = 4;
+  constexpr int kNumIterations = 200;
+  auto pool = MemoryPool::CreateDefault();
+  RecyclingMemoryPool rp(pool.get());
+
+  // Blocks are allocated and freed by different threads, and thread free lists
+  // overflow to the shared ones
+  std::vector<std::thread> threads;
+  for (int i = 0; i < kNumThreads; ++i) {
+    threads.emplace_back([&, i] {
+      std::vector<std::pair<uint8_t*, int64_t>> blocks;
+      for (int j = 0; j < kNumIterations; ++j) {
+        const int64_t size = 64 + 100 * ((i + j) % 7);
+        uint8_t* data;
+        ASSERT_OK(rp.Allocate(size, &data));
+        std::memset(data, i, size);
+        blocks.emplace_back(data, size);
+      }
+      for (const auto& block : blocks) {
+        ASSERT_EQ(i, block.first[block.second - 1]);
+        rp.Free(block.first, block.second);
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  ASSERT_EQ(0, rp.bytes_allocated());
+  // Exited threads gave back their free lists
+  ASSERT_EQ(rp.bytes_retained(), pool->bytes_allocated());
+  uint8_t* data;
+  ASSERT_OK(rp.Allocate(64, &data));
+  ASSERT_EQ(rp.bytes_retained() + 64, pool->bytes_allocated());
+  rp.Free(data, 64);
+
+  rp.Trim();
+  ASSERT_EQ(0, rp.bytes_retained());
+  ASSERT_EQ(0, pool->bytes_allocated());
+}
+
+TEST(ProfilingMemoryPool, Sites) {
+  auto pool = MemoryPool::CreateDefault();
+  ProfilingMemoryPool::Options options;
+  options.sample_period = 1;
+  ProfilingMemoryPool pp(pool.get(), options);
+
+  uint8_t *a, *b, *c;
+  ASSERT_EQ(nullptr, ScopedAllocationTag::current());
+  {
+    ScopedAllocationTag tag("outer");
+    ASSERT_OK(pp.Allocate(100, &a));
+    {
+      ScopedAllocationTag inner_tag("inner");
+      ASSERT_STREQ("inner", ScopedAllocationTag::current());
+      ASSERT_OK(pp.Allocate(200, &b));
+      ASSERT_OK(pp.Allocate(300, &c));
+    }
+    ASSERT_STREQ("outer", ScopedAllocationTag::current());
+    pp.Free(a, 100);
+    // Reallocation is a free followed by an allocation
+    ASSERT_OK(pp.Reallocate(300, 400, &c));
+  }
+  ASSERT_EQ(nullptr, ScopedAllocationTag::current());
+  ASSERT_EQ(600, pp.bytes_allocated());
+  ASSERT_EQ(600, pool->bytes_allocated());
+
+  // Sites are keyed by tag and stack, so compare the totals per tag
+  auto totals = [&](const std::string& tag) {
+    ProfilingMemoryPool::Site total;
+    for (const auto& site : pp.GetSites()) {
+      if (site.tag != tag) continue;
+      total.allocations += site.allocations;
+      total.allocated_bytes += site.allocated_bytes;
+      total.frees += site.frees;
+      total.freed_bytes += site.freed_bytes;
+    }
+    return total;
+  };
+  auto outer = totals("outer"), inner = totals("inner");
+  ASSERT_EQ(2, outer.allocations);
+  ASSERT_EQ(500, outer.allocated_bytes);
+  ASSERT_EQ(1, outer.frees);
+  ASSERT_EQ(100, outer.freed_bytes);
+  ASSERT_EQ(400, outer.live_bytes());
+  ASSERT_EQ(2, inner.allocations);
+  ASSERT_EQ(500, inner.allocated_bytes);
+  ASSERT_EQ(300, inner.freed_bytes);
+  ASSERT_EQ(200, inner.live_bytes());
+
+  auto sites = pp.GetSites();
+  ASSERT_EQ("outer", sites[0].tag);
+  for (size_t i = 1; i < sites.size(); ++i) {
+    ASSERT_GE(sites[i - 1].live_bytes(), sites[i].live_bytes());
+  }
+
+  auto report = pp.Report();
+  ASSERT_NE(std::string::npos, report.find("outer")) << report;
+  ASSERT_NE(std::string::npos, report.find("inner")) << report;
+  auto profile = pp.PprofHeapProfile();
+  ASSERT_EQ(0, profile.find("heap profile: 2: 600 [4: 1000] @ heapprofile\n"))
+      << profile;
+
+  pp.Free(b, 200);
+  pp.Free(c, 400);
+  ASSERT_EQ(0, totals("outer").live_bytes());
+  ASSERT_EQ(0, totals("inner").live_bytes());
+
+  pp.ResetProfile();
+  ASSERT_EQ(0, pp.GetSites().size());
+  ASSERT_EQ(0, pp.bytes_allocated());
+}
+
+TEST(ProfilingMemoryPool, Sampling) {
+  constexpr int64_t kSize = 1024;
+  constexpr int kNumAllocations = 100000;
+  auto pool = MemoryPool::CreateDefault();
+  ProfilingMemoryPool::Options options;
+  options.sample_period = 64 * 1024;
+  options.capture_stacks = false;
+  ProfilingMemoryPool pp(pool.get(), options);
+
+  std::vector<uint8_t*> blocks(kNumAllocations);
+  {
+    ScopedAllocationTag tag("sampled");
+    for (auto& block : blocks) {
+      ASSERT_OK(pp.Allocate(kSize, &block));
+    }
+  }
+  for (int i = 0; i < kNumAllocations / 2; ++i) {
+    pp.Free(blocks[i], kSize);
+  }
+  // About 1500 samples were taken, so the estimates are accurate to a few
+  // percent
+  auto sites = pp.GetSites();
+  ASSERT_EQ(1, sites.size());
+  ASSERT_TRUE(sites[0].stack.empty());
+  ASSERT_NEAR(kNumAllocations * kSize, sites[0].allocated_bytes,
+              kNumAllocations * kSize / 10);
+  ASSERT_NEAR(kNumAllocations / 2 * kSize, sites[0].live_bytes(),
+              kNumAllocations * kSize / 10);
+
+  for (int i = kNumAllocations / 2; i < kNumAllocations; ++i) {
+    pp.Free(blocks[i], kSize);
+  }
+  ASSERT_EQ(0, pp.GetSites()[0].live_allocations());
+  ASSERT_EQ(0, pp.bytes_allocated());
+}
+
+TEST(CappedMemoryPool, Limit) {
+  auto pool = MemoryPool::CreateDefault();
+
+  CappedMemoryPool cp(pool.get(), 1000);
+  ASSERT_EQ(1000, cp.limit());
+
+  uint8_t* data;
+  ASSERT_OK(cp.Allocate(600, &data));
+  uint8_t* data2;
+  ASSERT_RAISES(OutOfMemory, cp.Allocate(500, &data2));
+  ASSERT_OK(cp.Allocate(400, &data2));
+  ASSERT_EQ(1000, cp.bytes_allocated());
+  ASSERT_EQ(1000, pool->bytes_allocated());
+
+  // Shrinking is always allowed, growing past the limit isn't
+  ASSERT_RAISES(OutOfMemory, cp.Reallocate(400, 500, &data2));
+  ASSERT_EQ(1000, cp.bytes_allocated());
+  ASSERT_OK(cp.Reallocate(400, 100, &data2));
+  ASSERT_OK(cp.Reallocate(100, 300, &data2));
+  ASSERT_EQ(900, cp.bytes_allocated());
+
+  cp.Free(data, 600);
+  cp.Free(data2, 300);
+  ASSERT_EQ(0, cp.bytes_allocated());
+  ASSERT_EQ(0, pool->bytes_allocated());
+  ASSERT_EQ(1000, cp.max_memory());
+
+  ASSERT_OK(cp.Allocate(1000, &data));
+  cp.Free(data, 1000);
+}
+
+TEST(HugePageMemoryPool, LargeAllocations) {
+  MemoryPool* pool;
+#ifndef __linux__
+  ASSERT_RAISES(NotImplemented, hugepage_memory_pool(&pool));
+#else
+  ASSERT_OK(hugepage_memory_pool(&pool));
+  ASSERT_EQ("hugepages", pool->backend_name());
+  constexpr int64_t kHugePageSize = 2 * 1024 * 1024;
+  auto is_huge_page_aligned = [](const uint8_t* data) {
+    return reinterpret_cast<uintptr_t>(data) % kHugePageSize == 0;
+  };
+
+  uint8_t *small, *large;
+  ASSERT_OK(pool->Allocate(1000, &small));
+  ASSERT_OK(pool->Allocate(3 * kHugePageSize + 1, &large));
+  ASSERT_TRUE(is_huge_page_aligned(large));
+  std::memset(large, 0x5a, 3 * kHugePageSize + 1);
+  ASSERT_EQ(3 * kHugePageSize + 1001, pool->bytes_allocated());
+
+  // Growing within the same mapping doesn't move data
+  uint8_t* before = large;
+  ASSERT_OK(pool->Reallocate(3 * kHugePageSize + 1, 4 * kHugePageSize, &large));
+  ASSERT_EQ(before, large);
+  ASSERT_OK(pool->Reallocate(4 * kHugePageSize, 5 * kHugePageSize, &large));
+  ASSERT_TRUE(is_huge_page_aligned(large));
+  ASSERT_EQ(0x5a, large[3 * kHugePageSize]);
+
+  // Crossing the threshold in both directions
+  small[999] = 42;
+  ASSERT_OK(pool->Reallocate(1000, kHugePageSize, &small));
+  ASSERT_TRUE(is_huge_page_aligned(small));
+  ASSERT_EQ(42, small[999]);
+  ASSERT_OK(pool->Reallocate(kHugePageSize, 1000, &small));
+  ASSERT_EQ(42, small[999]);
+  ASSERT_OK(pool->Reallocate(5 * kHugePageSize, 100, &large));
+  ASSERT_EQ(0x5a, large[99]);
+
+  pool->Free(small, 1000);
+  pool->Free(large, 100);
+  ASSERT_EQ(0, pool->bytes_allocated());
+#endif
+}
+
 TEST(Jemalloc, SetDirtyPageDecayMillis) {
   // ARROW-6910
 #ifdef ARROW_JEMALLOC
@@ -33,6 +33,7 @@
 #include "arrow/util/atomic_shared_ptr.h"
 #include "arrow/util/iterator.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/parallel.h"
 #include "arrow/util/vector.h"
 
 namespace arrow {
@@ -290,6 +291,16 @@ Status RecordBatch::ValidateFull() const {
   return Status::OK();
 }
 
+Status RecordBatch::ValidateFull(bool use_threads) const {
+  if (!use_threads) {
+    return ValidateFull();
+  }
+  RETURN_NOT_OK(Validate());
+  return internal::ParallelFor(num_columns(), [this](int i) {
+    return internal::ValidateArrayFull(*column_data(i));
+  });
+}
+
 // ----------------------------------------------------------------------
 // Base record batch reader
 
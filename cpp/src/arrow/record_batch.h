@@ -182,6 +182,17 @@ class ARROW_EXPORT RecordBatch {
   /// \return Status
   virtual Status ValidateFull() const;
 
+  /// \brief Perform extensive validation checks, optionally validating the
+  /// columns in parallel.
+  ///
+  /// \param[in] use_threads if true, validate columns on the CPU thread pool
+  /// \return Status
+  ///
+  /// \note With use_threads, this blocks until the validation tasks complete.
+  /// Calling it from a task running on the CPU thread pool can therefore
+  /// deadlock if all the pool's threads are busy; pass false there.
+  Status ValidateFull(bool use_threads) const;
+
  protected:
   RecordBatch(const std::shared_ptr<Schema>& schema, int64_t num_rows);
 
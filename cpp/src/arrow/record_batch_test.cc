@@ -22,9 +22,11 @@
 
 #include <cstdint>
 #include <memory>
+#include <string>
 #include <vector>
 
 #include "arrow/array/array_base.h"
+#include "arrow/array/array_binary.h"
 #include "arrow/array/data.h"
 #include "arrow/array/util.h"
 #include "arrow/chunked_array.h"
@@ -98,6 +100,37 @@ TEST_F(TestRecordBatch, Validate) {
   ASSERT_RAISES(Invalid, b3->ValidateFull());
 }
 
+TEST_F(TestRecordBatch, ValidateFullUseThreads) {
+  const int length = 10;
+
+  auto schema = ::arrow::schema(
+      {field("f0", int32()), field("f1", utf8()), field("f2", utf8())});
+
+  std::vector<int32_t> offsets = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+  auto MakeStrings = [&](const std::string& data) {
+    return std::make_shared<StringArray>(length, Buffer::Wrap(offsets),
+                                         Buffer::FromString(data));
+  };
+  auto a0 = MakeRandomArray<Int32Array>(length);
+  auto valid = MakeStrings("abcdefghij");
+  auto invalid1 = MakeStrings("abcde\xffghij");
+  auto invalid2 = MakeStrings("ab\xff" "defghij");
+
+  auto b1 = RecordBatch::Make(schema, length, {a0, valid, valid});
+  ASSERT_OK(b1->ValidateFull(/*use_threads=*/true));
+
+  // The error for the first invalid column is reported, as in serial validation
+  auto b2 = RecordBatch::Make(schema, length, {a0, invalid1, invalid2});
+  const auto expected = b2->ValidateFull();
+  ASSERT_RAISES(Invalid, expected);
+  ASSERT_EQ(expected.ToString(), b2->ValidateFull(/*use_threads=*/true).ToString());
+  ASSERT_EQ(expected.ToString(), b2->ValidateFull(/*use_threads=*/false).ToString());
+
+  // Type mismatch
+  auto b3 = RecordBatch::Make(schema, length, {a0, valid, a0});
+  ASSERT_RAISES(Invalid, b3->ValidateFull(/*use_threads=*/true));
+}
+
 TEST_F(TestRecordBatch, Slice) {
   const int length = 7;
 
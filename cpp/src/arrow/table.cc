@@ -23,12 +23,14 @@
 #include <memory>
 #include <sstream>
 #include <utility>
+#include <vector>
 
 #include "arrow/array/array_base.h"
 #include "arrow/array/array_binary.h"
 #include "arrow/array/array_nested.h"
 #include "arrow/array/concatenate.h"
 #include "arrow/array/util.h"
+#include "arrow/array/validate.h"
 #include "arrow/chunked_array.h"
 #include "arrow/pretty_print.h"
 #include "arrow/record_batch.h"
@@ -39,6 +41,7 @@
 #include "arrow/type_traits.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/parallel.h"
 #include "arrow/util/vector.h"
 
 namespace arrow {
@@ -187,6 +190,8 @@ class SimpleTable : public Table {
     return Status::OK();
   }
 
+  using Table::ValidateFull;
+
   Status ValidateFull() const override {
     RETURN_NOT_OK(ValidateMeta());
     for (int i = 0; i < num_columns(); ++i) {
@@ -382,6 +387,33 @@ Result<std::shared_ptr<Table>> Table::SelectColumns(
   return Table::Make(new_schema, std::move(columns), num_rows());
 }
 
+Status Table::ValidateFull(bool use_threads) const {
+  if (!use_threads) {
+    return ValidateFull();
+  }
+  RETURN_NOT_OK(Validate());
+
+  // Validate chunks independently, so that a few large columns still
+  // spread over several threads
+  std::vector<std::pair<int, int>> chunk_ids;
+  for (int i = 0; i < num_columns(); ++i) {
+    for (int j = 0; j < column(i)->num_chunks(); ++j) {
+      chunk_ids.emplace_back(i, j);
+    }
+  }
+  return internal::ParallelFor(
+      static_cast<int>(chunk_ids.size()), [this, &chunk_ids](int task) {
+        const int i = chunk_ids[task].first;
+        const int j = chunk_ids[task].second;
+        const Status st = internal::ValidateArrayFull(*column(i)->chunk(j));
+        if (!st.ok()) {
+          // Same error as the serial ValidateFull()
+          return Status::Invalid("Column ", i, ": In chunk ", j, ": ", st.ToString());
+        }
+        return Status::OK();
+      });
+}
+
 std::string Table::ToString() const {
   std::stringstream ss;
   ARROW_CHECK_OK(PrettyPrint(*this, 0, &ss));
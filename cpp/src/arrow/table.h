@@ -187,6 +187,17 @@ class ARROW_EXPORT Table {
   /// \return Status
   virtual Status ValidateFull() const = 0;
 
+  /// \brief Perform extensive validation checks, optionally validating all
+  /// chunks of all columns in parallel.
+  ///
+  /// \param[in] use_threads if true, validate chunks on the CPU thread pool
+  /// \return Status
+  ///
+  /// \note With use_threads, this blocks until the validation tasks complete.
+  /// Calling it from a task running on the CPU thread pool can therefore
+  /// deadlock if all the pool's threads are busy; pass false there.
+  Status ValidateFull(bool use_threads) const;
+
   /// \brief Return the number of columns in the table
   int num_columns() const { return schema_->num_fields(); }
 
@@ -17,12 +17,14 @@
 
 #include <cstdint>
 #include <memory>
+#include <string>
 #include <vector>
 
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
 #include "arrow/array/array_base.h"
+#include "arrow/array/array_binary.h"
 #include "arrow/array/data.h"
 #include "arrow/array/util.h"
 #include "arrow/chunked_array.h"
@@ -126,6 +128,43 @@ TEST_F(TestTable, InvalidColumns) {
   ASSERT_RAISES(Invalid, table_->ValidateFull());
 }
 
+TEST_F(TestTable, ValidateFullUseThreads) {
+  const int length = 10;
+
+  auto schema = ::arrow::schema({field("f0", utf8()), field("f1", utf8())});
+
+  std::vector<int32_t> offsets = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+  auto MakeStrings = [&](const std::string& data) -> std::shared_ptr<Array> {
+    return std::make_shared<StringArray>(length, Buffer::Wrap(offsets),
+                                         Buffer::FromString(data));
+  };
+  auto valid = MakeStrings("abcdefghij");
+  auto invalid1 = MakeStrings("abcde\xffghij");
+  auto invalid2 = MakeStrings("ab\xff" "defghij");
+
+  auto table = Table::Make(
+      schema, {std::make_shared<ChunkedArray>(ArrayVector{valid}),
+               std::make_shared<ChunkedArray>(
+                   ArrayVector{valid->Slice(0, 3), valid->Slice(3, 3), valid->Slice(6)})});
+  ASSERT_OK(table->ValidateFull(/*use_threads=*/true));
+
+  // The error for the first invalid chunk is reported, as in serial validation
+  table = Table::Make(
+      schema, {std::make_shared<ChunkedArray>(ArrayVector{valid, invalid1}),
+               std::make_shared<ChunkedArray>(ArrayVector{invalid2, valid})},
+      2 * length);
+  const auto expected = table->ValidateFull();
+  ASSERT_RAISES(Invalid, expected);
+  ASSERT_EQ(expected.ToString(), table->ValidateFull(/*use_threads=*/true).ToString());
+  ASSERT_EQ(expected.ToString(), table->ValidateFull(/*use_threads=*/false).ToString());
+
+  // Length mismatch
+  table = Table::Make(schema, {std::make_shared<ChunkedArray>(ArrayVector{valid}),
+                               std::make_shared<ChunkedArray>(ArrayVector{valid})},
+                      length + 1);
+  ASSERT_RAISES(Invalid, table->ValidateFull(/*use_threads=*/true));
+}
+
 TEST_F(TestTable, AllColumnsAndFields) {
   const int length = 100;
   MakeExample1(length);
@@ -0,0 +1,330 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <atomic>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include "arrow/result.h"
+#include "arrow/status.h"
+#include "arrow/util/functional.h"
+#include "arrow/util/future.h"
+#include "arrow/util/iterator.h"
+#include "arrow/util/thread_pool.h"
+
+namespace arrow {
+
+/// \brief EXPERIMENTAL The asynchronous counterpart of an Iterator.
+///
+/// Each call returns a Future of the next item.  The end of the sequence is signalled
+/// by an item equal to IterationTraits<T>::End(); once it has been reached, further
+/// calls must keep returning it.
+///
+/// Unless stated otherwise, a generator should only be called again once the Future
+/// returned by the previous call has completed.  Generators which support several
+/// calls in flight (such as MakeVectorGenerator) are said to be "async-reentrant",
+/// and MakeReadaheadGenerator requires its source to be one.
+template <typename T>
+using AsyncGenerator = std::function<Future<T>()>;
+
+/// \brief Make a generator yielding no items
+template <typename T>
+AsyncGenerator<T> MakeEmptyGenerator() {
+  return []() { return Future<T>::MakeFinished(IterationTraits<T>::End()); };
+}
+
+/// \brief Make an async-reentrant generator yielding the given items
+template <typename T>
+AsyncGenerator<T> MakeVectorGenerator(std::vector<T> items) {
+  struct State {
+    explicit State(std::vector<T> items) : items(std::move(items)) {}
+
+    std::mutex mutex;
+    std::vector<T> items;
+    size_t index = 0;
+  };
+
+  auto state = std::make_shared<State>(std::move(items));
+  return [state]() {
+    std::lock_guard<std::mutex> lock(state->mutex);
+    if (state->index == state->items.size()) {
+      return Future<T>::MakeFinished(IterationTraits<T>::End());
+    }
+    return Future<T>::MakeFinished(state->items[state->index++]);
+  };
+}
+
+/// \brief Call `visitor` on each item of `generator`, asynchronously.
+///
+/// The returned Future completes once the end of `generator` has been reached, or
+/// with the first error returned by `generator` or `visitor`.  Items which are
+/// available immediately are visited in a loop rather than by nested callbacks, so
+/// long synchronous sequences don't exhaust the stack.
+template <typename T>
+Future<> VisitAsyncGenerator(AsyncGenerator<T> generator,
+                             std::function<Status(T)> visitor) {
+  struct Loop : std::enable_shared_from_this<Loop> {
+    Loop(AsyncGenerator<T> generator, std::function<Status(T)> visitor)
+        : generator(std::move(generator)), visitor(std::move(visitor)) {}
+
+    // Return true if the loop is over
+    bool Visit(const Result<T>& maybe_item) {
+      if (!maybe_item.ok()) {
+        done.MarkFinished(maybe_item.status());
+        return true;
+      }
+      if (IsIterationEnd(*maybe_item)) {
+        done.MarkFinished();
+        return true;
+      }
+      Status st = visitor(*maybe_item);
+      if (!st.ok()) {
+        done.MarkFinished(std::move(st));
+        return true;
+      }
+      return false;
+    }
+
+    void Run() {
+      while (true) {
+        auto next = generator();
+        if (!next.is_finished()) {
+          auto self = this->shared_from_this();
+          next.AddCallback([self](const Result<T>& maybe_item) {
+            if (!self->Visit(maybe_item)) {
+              self->Run();
+            }
+          });
+          return;
+        }
+        if (Visit(next.result())) return;
+      }
+    }
+
+    AsyncGenerator<T> generator;
+    std::function<Status(T)> visitor;
+    Future<> done = Future<>::Make();
+  };
+
+  auto loop = std::make_shared<Loop>(std::move(generator), std::move(visitor));
+  auto done = loop->done;
+  loop->Run();
+  return done;
+}
+
+/// \brief Collect all items of `generator` into a vector, asynchronously
+template <typename T>
+Future<std::vector<T>> CollectAsyncGenerator(AsyncGenerator<T> generator) {
+  auto items = std::make_shared<std::vector<T>>();
+  auto visited = VisitAsyncGenerator<T>(std::move(generator), [items](T item) {
+    items->push_back(std::move(item));
+    return Status::OK();
+  });
+  return visited.Then([items](...) { return std::move(*items); });
+}
+
+/// \brief Make a generator applying `map` to each item of `source`.
+///
+/// `map` runs in the thread which completes the source's Future; use
+/// MakeTransferredGenerator to move it to a CPU executor if it is expensive.
+template <typename T, typename V>
+AsyncGenerator<V> MakeMappedGenerator(AsyncGenerator<T> source,
+                                      std::function<Result<V>(const T&)> map) {
+  return [source, map]() {
+    return source().Then([map](const T& item) -> Result<V> {
+      if (IsIterationEnd(item)) {
+        return IterationTraits<V>::End();
+      }
+      return map(item);
+    });
+  };
+}
+
+/// \brief Make a generator whose Futures complete on `executor`.
+///
+/// Continuations added by the consumer then run on `executor` rather than, for
+/// example, on the IO thread which completed the source's Future.
+template <typename T>
+AsyncGenerator<T> MakeTransferredGenerator(AsyncGenerator<T> source,
+                                           internal::Executor* executor) {
+  return [source, executor]() { return executor->Transfer(source()); };
+}
+
+/// \brief Make a generator keeping up to `max_readahead` items of `source` in flight.
+///
+/// `source` must be async-reentrant.  Items are yielded in order.
+template <typename T>
+AsyncGenerator<T> MakeReadaheadGenerator(AsyncGenerator<T> source, int max_readahead) {
+  struct State {
+    State(AsyncGenerator<T> source, int max_readahead)
+        : source(std::move(source)), max_readahead(max_readahead) {}
+
+    std::mutex mutex;
+    AsyncGenerator<T> source;
+    const int max_readahead;
+    std::deque<Future<T>> in_flight;
+    // Whether an in-flight item was the end (or an error), after which the source
+    // must not be called anymore
+    std::shared_ptr<std::atomic<bool>> finished =
+        std::make_shared<std::atomic<bool>>(false);
+  };
+
+  auto state = std::make_shared<State>(std::move(source), max_readahead);
+  return [state]() {
+    std::lock_guard<std::mutex> lock(state->mutex);
+    while (static_cast<int>(state->in_flight.size()) < state->max_readahead &&
+           !state->finished->load()) {
+      auto next = state->source();
+      auto finished = state->finished;
+      next.AddCallback([finished](const Result<T>& maybe_item) {
+        if (!maybe_item.ok() || IsIterationEnd(*maybe_item)) {
+          finished->store(true);
+        }
+      });
+      state->in_flight.push_back(std::move(next));
+    }
+    if (state->in_flight.empty()) {
+      return Future<T>::MakeFinished(IterationTraits<T>::End());
+    }
+    auto next = std::move(state->in_flight.front());
+    state->in_flight.pop_front();
+    return next;
+  };
+}
+
+/// \brief Make a generator yielding the items of all `sources`, in completion order.
+///
+/// All sources are pulled concurrently, one item at a time each.  An error from a
+/// source is yielded as is, after which that source isn't pulled anymore.  The
+/// returned generator is async-reentrant.
+template <typename T>
+AsyncGenerator<T> MakeMergedGenerator(std::vector<AsyncGenerator<T>> sources) {
+  struct State : std::enable_shared_from_this<State> {
+    explicit State(std::vector<AsyncGenerator<T>> sources)
+        : sources(std::move(sources)),
+          pulling(this->sources.size(), false),
+          ended(this->sources.size(), false),
+          num_active(this->sources.size()) {}
+
+    Future<T> Next() {
+      std::vector<size_t> to_pull;
+      Future<T> next;
+      {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (!ready.empty()) {
+          next = Future<T>::MakeFinished(std::move(ready.front()));
+          ready.pop_front();
+          return next;
+        }
+        if (num_active == 0) {
+          return Future<T>::MakeFinished(IterationTraits<T>::End());
+        }
+        next = Future<T>::Make();
+        waiting.push_back(next);
+        to_pull = IdleSourcesUnlocked();
+      }
+      Pull(to_pull);
+      return next;
+    }
+
+    std::vector<size_t> IdleSourcesUnlocked() {
+      std::vector<size_t> idle;
+      for (size_t i = 0; i < sources.size(); ++i) {
+        if (!ended[i] && !pulling[i]) {
+          pulling[i] = true;
+          idle.push_back(i);
+        }
+      }
+      return idle;
+    }
+
+    void Pull(const std::vector<size_t>& indices) {
+      auto self = this->shared_from_this();
+      for (size_t i : indices) {
+        sources[i]().AddCallback(
+            [self, i](const Result<T>& maybe_item) { self->OnItem(i, maybe_item); });
+      }
+    }
+
+    void OnItem(size_t i, const Result<T>& maybe_item) {
+      const bool is_end = maybe_item.ok() && IsIterationEnd(*maybe_item);
+      Future<T> to_finish;
+      std::vector<Future<T>> to_end;
+      std::vector<size_t> to_pull;
+      {
+        std::lock_guard<std::mutex> lock(mutex);
+        pulling[i] = false;
+        if (!maybe_item.ok() || is_end) {
+          ended[i] = true;
+          --num_active;
+        }
+        if (!is_end) {
+          if (!waiting.empty()) {
+            to_finish = std::move(waiting.front());
+            waiting.pop_front();
+          } else {
+            ready.push_back(maybe_item);
+          }
+        }
+        if (num_active == 0) {
+          // No more items will come: end all waiting consumers
+          to_end.assign(waiting.begin(), waiting.end());
+          waiting.clear();
+        } else if (!waiting.empty()) {
+          to_pull = IdleSourcesUnlocked();
+        }
+      }
+
+      if (to_finish.is_valid()) {
+        to_finish.MarkFinished(maybe_item);
+      }
+      for (auto& future : to_end) {
+        future.MarkFinished(IterationTraits<T>::End());
+      }
+      Pull(to_pull);
+    }
+
+    std::mutex mutex;
+    std::vector<AsyncGenerator<T>> sources;
+    // Whether a call to each source is in flight
+    std::vector<bool> pulling;
+    // Whether each source has reached its end (or failed)
+    std::vector<bool> ended;
+    size_t num_active;
+    // Items which were produced before being asked for
+    std::deque<Result<T>> ready;
+    // Consumer requests which couldn't be satisfied yet
+    std::deque<Future<T>> waiting;
+  };
+
+  auto state = std::make_shared<State>(std::move(sources));
+  return [state]() { return state->Next(); };
+}
+
+/// \brief Make a (blocking) Iterator out of an AsyncGenerator
+template <typename T>
+Iterator<T> MakeGeneratorIterator(AsyncGenerator<T> source) {
+  return MakeFunctionIterator([source]() -> Result<T> { return source().result(); });
+}
+
+}  // namespace arrow
@@ -0,0 +1,201 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/util/async_generator.h"
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/testing/gtest_util.h"
+#include "arrow/util/optional.h"
+#include "arrow/util/thread_pool.h"
+
+namespace arrow {
+
+using internal::ThreadPool;
+
+using Item = util::optional<int>;
+
+// Wait for a Future and return a copy of its result (ASSERT_OK_AND_ASSIGN would keep
+// a dangling reference to the result of a temporary Future)
+template <typename T>
+Result<T> Await(const Future<T>& future) {
+  return future.result();
+}
+
+static std::vector<Item> MakeItems(int n) {
+  std::vector<Item> items;
+  for (int i = 0; i < n; ++i) {
+    items.emplace_back(i);
+  }
+  return items;
+}
+
+// A generator whose items are produced on a thread pool, after a short delay
+static AsyncGenerator<Item> MakeSlowGenerator(ThreadPool* pool, std::vector<Item> items,
+                                              double seconds = 1e-3) {
+  auto source = MakeVectorGenerator(std::move(items));
+  return [pool, source, seconds]() {
+    return DeferNotOk(pool->Submit([source, seconds]() {
+      SleepFor(seconds);
+      return source().result();
+    }));
+  };
+}
+
+TEST(AsyncGenerator, Vector) {
+  ASSERT_OK_AND_ASSIGN(auto items,
+                       Await(CollectAsyncGenerator(MakeVectorGenerator(MakeItems(5)))));
+  ASSERT_EQ(items, MakeItems(5));
+
+  ASSERT_OK_AND_ASSIGN(items, Await(CollectAsyncGenerator(MakeEmptyGenerator<Item>())));
+  ASSERT_EQ(items.size(), 0);
+}
+
+TEST(AsyncGenerator, VisitLongSynchronousSequence) {
+  // Would overflow the stack if each item was visited from a nested callback
+  constexpr int kNumItems = 1000000;
+  int64_t sum = 0;
+  auto visited = VisitAsyncGenerator<Item>(MakeVectorGenerator(MakeItems(kNumItems)),
+                                           [&](Item item) {
+                                             sum += *item;
+                                             return Status::OK();
+                                           });
+  ASSERT_OK(visited.status());
+  ASSERT_EQ(sum, int64_t(kNumItems) * (kNumItems - 1) / 2);
+}
+
+TEST(AsyncGenerator, VisitError) {
+  auto visited = VisitAsyncGenerator<Item>(MakeVectorGenerator(MakeItems(5)),
+                                           [](Item item) {
+                                             if (*item == 3) {
+                                               return Status::IOError("xxx");
+                                             }
+                                             return Status::OK();
+                                           });
+  ASSERT_RAISES(IOError, visited.status());
+}
+
+TEST(AsyncGenerator, Mapped) {
+  auto mapped = MakeMappedGenerator<Item, Item>(
+      MakeVectorGenerator(MakeItems(4)),
+      [](const Item& item) -> Result<Item> { return Item(*item * 2); });
+  ASSERT_OK_AND_ASSIGN(auto items, Await(CollectAsyncGenerator(std::move(mapped))));
+  ASSERT_EQ(items, std::vector<Item>({0, 2, 4, 6}));
+
+  auto failing = MakeMappedGenerator<Item, Item>(
+      MakeVectorGenerator(MakeItems(4)),
+      [](const Item& item) -> Result<Item> { return Status::Invalid("xxx"); });
+  ASSERT_RAISES(Invalid, CollectAsyncGenerator(std::move(failing)).result());
+}
+
+TEST(AsyncGenerator, Transferred) {
+  auto io_pool = *ThreadPool::Make(1);
+  auto cpu_pool = *ThreadPool::Make(1);
+  std::thread::id io_thread, cpu_thread;
+  ASSERT_OK(io_pool->Spawn([&] { io_thread = std::this_thread::get_id(); }));
+  ASSERT_OK(cpu_pool->Spawn([&] { cpu_thread = std::this_thread::get_id(); }));
+
+  auto transferred = MakeTransferredGenerator(
+      MakeSlowGenerator(io_pool.get(), MakeItems(3)), cpu_pool.get());
+  std::vector<std::thread::id> visiting_threads;
+  ASSERT_OK(VisitAsyncGenerator<Item>(transferred, [&](Item) {
+              visiting_threads.push_back(std::this_thread::get_id());
+              return Status::OK();
+            }).status());
+  ASSERT_EQ(visiting_threads, std::vector<std::thread::id>(3, cpu_thread));
+  ASSERT_NE(io_thread, cpu_thread);
+}
+
+TEST(AsyncGenerator, Readahead) {
+  auto pool = *ThreadPool::Make(4);
+  std::atomic<int> max_in_flight{0}, in_flight{0};
+  auto source = MakeVectorGenerator(MakeItems(20));
+  AsyncGenerator<Item> counted = [&]() {
+    int n = ++in_flight;
+    int max = max_in_flight.load();
+    while (n > max && !max_in_flight.compare_exchange_weak(max, n)) {
+    }
+    return DeferNotOk(pool->Submit([&, source]() {
+      SleepFor(1e-3);
+      --in_flight;
+      return source().result();
+    }));
+  };
+
+  auto readahead = MakeReadaheadGenerator(counted, 4);
+  ASSERT_OK_AND_ASSIGN(auto items, Await(CollectAsyncGenerator(readahead)));
+  // The source itself is called from several pool threads, so its items may come
+  // in any order
+  std::vector<Item> sorted = items;
+  std::sort(sorted.begin(), sorted.end());
+  ASSERT_EQ(sorted, MakeItems(20));
+  ASSERT_GT(max_in_flight.load(), 1);
+  ASSERT_LE(max_in_flight.load(), 4);
+  ASSERT_OK(pool->Shutdown());
+}
+
+TEST(AsyncGenerator, Merged) {
+  auto pool = *ThreadPool::Make(4);
+  std::vector<AsyncGenerator<Item>> sources;
+  for (int i = 0; i < 4; ++i) {
+    std::vector<Item> items;
+    for (int j = 0; j < 5; ++j) {
+      items.emplace_back(i * 100 + j);
+    }
+    sources.push_back(MakeSlowGenerator(pool.get(), std::move(items)));
+  }
+  sources.push_back(MakeEmptyGenerator<Item>());
+
+  ASSERT_OK_AND_ASSIGN(auto items,
+                       Await(CollectAsyncGenerator(MakeMergedGenerator(sources))));
+  ASSERT_EQ(items.size(), 20);
+  std::sort(items.begin(), items.end());
+  for (int i = 0; i < 4; ++i) {
+    for (int j = 0; j < 5; ++j) {
+      ASSERT_EQ(items[i * 5 + j], Item(i * 100 + j));
+    }
+  }
+
+  // Reading past the end
+  auto merged = MakeMergedGenerator<Item>({MakeVectorGenerator(MakeItems(1))});
+  ASSERT_OK_AND_EQ(Item(0), Await(merged()));
+  ASSERT_OK_AND_EQ(Item(), Await(merged()));
+  ASSERT_OK_AND_EQ(Item(), Await(merged()));
+  ASSERT_OK(pool->Shutdown());
+}
+
+TEST(AsyncGenerator, MergedError) {
+  AsyncGenerator<Item> failing = []() {
+    return Future<Item>::MakeFinished(Status::IOError("xxx"));
+  };
+  auto merged = MakeMergedGenerator<Item>({failing, MakeVectorGenerator(MakeItems(3))});
+  ASSERT_RAISES(IOError, CollectAsyncGenerator(merged).result());
+}
+
+TEST(AsyncGenerator, Iterator) {
+  auto it = MakeGeneratorIterator(MakeVectorGenerator(MakeItems(3)));
+  ASSERT_OK_AND_ASSIGN(auto items, it.ToVector());
+  ASSERT_EQ(items, std::vector<Item>({0, 1, 2}));
+}
+
+}  // namespace arrow
@@ -0,0 +1,72 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/util/cancel.h"
+
+#include <atomic>
+#include <mutex>
+#include <utility>
+
+#include "arrow/util/logging.h"
+
+namespace arrow {
+
+struct StopSourceImpl {
+  // Checked without locking by StopToken::Poll(), so that polling a token which
+  // wasn't stopped is cheap
+  std::atomic<bool> requested{false};
+  std::mutex mutex;
+  Status error;
+};
+
+StopSource::StopSource() : impl_(new StopSourceImpl) {}
+
+StopSource::~StopSource() = default;
+
+void StopSource::RequestStop() { RequestStop(Status::Cancelled("Operation cancelled")); }
+
+void StopSource::RequestStop(Status error) {
+  DCHECK(!error.ok());
+  std::lock_guard<std::mutex> lock(impl_->mutex);
+  // The first request wins
+  if (!impl_->requested.load()) {
+    impl_->error = std::move(error);
+    impl_->requested.store(true);
+  }
+}
+
+StopToken StopSource::token() { return StopToken(impl_); }
+
+void StopSource::Reset() {
+  std::lock_guard<std::mutex> lock(impl_->mutex);
+  impl_->error = Status::OK();
+  impl_->requested.store(false);
+}
+
+Status StopToken::Poll() const {
+  if (impl_ == nullptr || !impl_->requested.load()) {
+    return Status::OK();
+  }
+  std::lock_guard<std::mutex> lock(impl_->mutex);
+  return impl_->error;
+}
+
+bool StopToken::IsStopRequested() const {
+  return impl_ != nullptr && impl_->requested.load();
+}
+
+}  // namespace arrow
@@ -0,0 +1,83 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <memory>
+
+#include "arrow/status.h"
+#include "arrow/util/macros.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+class StopToken;
+
+struct StopSourceImpl;
+
+/// \brief EXPERIMENTAL The owner side of a cancellation request.
+///
+/// A StopSource hands out StopTokens to the operations it may want to cancel.
+/// Those operations poll their token at convenient points (typically between
+/// batches) and bail out with the error given to RequestStop().
+class ARROW_EXPORT StopSource {
+ public:
+  StopSource();
+  ~StopSource();
+
+  /// \brief Request that all operations holding a token stop (with Status::Cancelled)
+  void RequestStop();
+  /// \brief Request that all operations holding a token stop with the given error
+  void RequestStop(Status error);
+
+  /// \brief Return a token observing this source
+  StopToken token();
+
+  /// \brief Clear a previous stop request
+  ///
+  /// Only to be called when no operation holding a token is running.
+  void Reset();
+
+ protected:
+  std::shared_ptr<StopSourceImpl> impl_;
+};
+
+/// \brief EXPERIMENTAL The observer side of a cancellation request.
+///
+/// A default-constructed StopToken is never stopped.  Tokens are cheap to copy
+/// and to poll.
+class ARROW_EXPORT StopToken {
+ public:
+  StopToken() = default;
+
+  explicit StopToken(std::shared_ptr<StopSourceImpl> impl) : impl_(std::move(impl)) {}
+
+  /// \brief Return a token which is never stopped
+  static StopToken Unstoppable() { return StopToken(); }
+
+  /// \brief Return the error given to StopSource::RequestStop(), or OK if no stop
+  /// was requested
+  Status Poll() const;
+
+  /// \brief Return whether a stop was requested
+  bool IsStopRequested() const;
+
+ protected:
+  std::shared_ptr<StopSourceImpl> impl_;
+};
+
+}  // namespace arrow
@@ -0,0 +1,94 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/util/cancel.h"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/testing/gtest_util.h"
+
+namespace arrow {
+
+TEST(StopToken, Unstoppable) {
+  StopToken token;
+  ASSERT_FALSE(token.IsStopRequested());
+  ASSERT_OK(token.Poll());
+
+  token = StopToken::Unstoppable();
+  ASSERT_FALSE(token.IsStopRequested());
+  ASSERT_OK(token.Poll());
+}
+
+TEST(StopSource, RequestStop) {
+  StopSource source;
+  StopToken token = source.token();
+  ASSERT_FALSE(token.IsStopRequested());
+  ASSERT_OK(token.Poll());
+
+  source.RequestStop();
+  ASSERT_TRUE(token.IsStopRequested());
+  ASSERT_RAISES(Cancelled, token.Poll());
+  // Tokens made after the request observe it too
+  ASSERT_RAISES(Cancelled, source.token().Poll());
+
+  source.Reset();
+  ASSERT_FALSE(token.IsStopRequested());
+  ASSERT_OK(token.Poll());
+}
+
+TEST(StopSource, RequestStopWithError) {
+  StopSource source;
+  StopToken token = source.token();
+  source.RequestStop(Status::IOError("Operation timed out"));
+  ASSERT_RAISES(IOError, token.Poll());
+
+  // The first request is kept
+  source.RequestStop();
+  ASSERT_RAISES(IOError, token.Poll());
+}
+
+TEST(StopSource, RequestStopFromOtherThread) {
+  StopSource source;
+  std::atomic<bool> started{false};
+  std::vector<std::thread> pollers;
+  std::vector<Status> results(4);
+  for (size_t i = 0; i < results.size(); ++i) {
+    pollers.emplace_back([&, i]() {
+      StopToken token = source.token();
+      started = true;
+      Status st;
+      while ((st = token.Poll()).ok()) {
+      }
+      results[i] = st;
+    });
+  }
+  while (!started) {
+  }
+  source.RequestStop();
+  for (auto& poller : pollers) {
+    poller.join();
+  }
+  for (const auto& st : results) {
+    ASSERT_RAISES(Cancelled, st);
+  }
+}
+
+}  // namespace arrow
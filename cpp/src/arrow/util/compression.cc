@@ -33,6 +33,11 @@ int Codec::UseDefaultCompressionLevel() { return kUseDefaultCompressionLevel; }
 
 Status Codec::Init() { return Status::OK(); }
 
+Result<int64_t> Codec::FrameCompressedSize(int64_t input_len, const uint8_t* input) {
+  return Status::NotImplemented("Finding frame boundaries not supported for codec '",
+                                name(), "'");
+}
+
 const std::string& Codec::GetCodecAsString(Compression::type t) {
   static const std::string uncompressed = "uncompressed", snappy = "snappy",
                            gzip = "gzip", lzo = "lzo", brotli = "brotli",
@@ -163,6 +163,14 @@ class ARROW_EXPORT Codec {
   /// \brief Create a streaming compressor instance
   virtual Result<std::shared_ptr<Decompressor>> MakeDecompressor() = 0;
 
+  /// \brief Return the compressed length of the frame starting at `input`
+  ///
+  /// Some streaming formats (ZSTD, LZ4_FRAME) delimit independently
+  /// decompressible frames, whose boundaries can be found without
+  /// decompressing them.  0 is returned if `input` doesn't hold a full frame.
+  /// Other codecs return NotImplemented.
+  virtual Result<int64_t> FrameCompressedSize(int64_t input_len, const uint8_t* input);
+
   /// \brief This Codec's compression type
   virtual Compression::type compression_type() const = 0;
 
@@ -25,16 +25,18 @@
 #include <string>
 #include <vector>
 
+#include "arrow/buffer.h"
+#include "arrow/io/compressed.h"
+#include "arrow/io/memory.h"
 #include "arrow/result.h"
 #include "arrow/util/compression.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/macros.h"
+#include "arrow/util/thread_pool.h"
 
 namespace arrow {
 namespace util {
 
-#ifdef ARROW_WITH_BENCHMARKS_REFERENCE
-
 std::vector<uint8_t> MakeCompressibleData(int data_size) {
   // XXX This isn't a real-world corpus so doesn't really represent the
   // comparative qualities of the algorithms
@@ -64,6 +66,8 @@ std::vector<uint8_t> MakeCompressibleData(int data_size) {
   return data;
 }
 
+#ifdef ARROW_WITH_BENCHMARKS_REFERENCE
+
 int64_t StreamingCompress(Codec* codec, const std::vector<uint8_t>& data,
                           std::vector<uint8_t>* compressed_data = nullptr) {
   if (compressed_data != nullptr) {
@@ -197,5 +201,92 @@ BENCHMARK_TEMPLATE(ReferenceStreamingDecompression, Compression::LZ4_FRAME);
 
 #endif
 
+// ----------------------------------------------------------------------
+// Thread scaling of parallel compressed streams
+
+// Run the benchmark with the given number of CPU threads
+class ScopedCpuThreadPoolCapacity {
+ public:
+  explicit ScopedCpuThreadPoolCapacity(int capacity)
+      : old_capacity_(::arrow::GetCpuThreadPoolCapacity()) {
+    ARROW_CHECK_OK(::arrow::SetCpuThreadPoolCapacity(capacity));
+  }
+  ~ScopedCpuThreadPoolCapacity() {
+    ARROW_CHECK_OK(::arrow::SetCpuThreadPoolCapacity(old_capacity_));
+  }
+
+ private:
+  int old_capacity_;
+};
+
+std::shared_ptr<Buffer> ParallelCompress(Codec* codec, const std::vector<uint8_t>& data) {
+  auto sink = *io::BufferOutputStream::Create();
+  auto stream = *io::CompressedOutputStream::MakeParallel(codec, sink);
+  ARROW_CHECK_OK(stream->Write(data.data(), data.size()));
+  ARROW_CHECK_OK(stream->Close());
+  return *sink->Finish();
+}
+
+template <Compression::type COMPRESSION>
+static void ParallelStreamCompression(
+    benchmark::State& state) {  // NOLINT non-const reference
+  ScopedCpuThreadPoolCapacity capacity(static_cast<int>(state.range(0)));
+  auto data = MakeCompressibleData(64 * 1024 * 1024);  // 64 MB
+  auto codec = *Codec::Create(COMPRESSION);
+
+  for (auto _ : state) {
+    auto compressed = ParallelCompress(codec.get(), data);
+    state.counters["ratio"] =
+        static_cast<double>(data.size()) / static_cast<double>(compressed->size());
+  }
+  state.SetBytesProcessed(state.iterations() * data.size());
+}
+
+template <Compression::type COMPRESSION>
+static void ParallelStreamDecompression(
+    benchmark::State& state) {  // NOLINT non-const reference
+  ScopedCpuThreadPoolCapacity capacity(static_cast<int>(state.range(0)));
+  auto data = MakeCompressibleData(64 * 1024 * 1024);  // 64 MB
+  auto codec = *Codec::Create(COMPRESSION);
+  auto compressed = ParallelCompress(codec.get(), data);
+
+  for (auto _ : state) {
+    auto source = std::make_shared<io::BufferReader>(compressed);
+    auto stream = *io::CompressedInputStream::MakeParallel(codec.get(), source);
+    int64_t decompressed_size = 0;
+    while (true) {
+      auto buffer = *stream->Read(1 << 20);
+      if (buffer->size() == 0) {
+        break;
+      }
+      decompressed_size += buffer->size();
+    }
+    ARROW_CHECK(decompressed_size == static_cast<int64_t>(data.size()));
+  }
+  state.SetBytesProcessed(state.iterations() * data.size());
+}
+
+#define PARALLEL_STREAM_BENCHMARKS(COMPRESSION)                \
+  BENCHMARK_TEMPLATE(ParallelStreamCompression, COMPRESSION)   \
+      ->RangeMultiplier(2)                                     \
+      ->Range(1, 16)                                           \
+      ->UseRealTime();                                         \
+  BENCHMARK_TEMPLATE(ParallelStreamDecompression, COMPRESSION) \
+      ->RangeMultiplier(2)                                     \
+      ->Range(1, 16)                                           \
+      ->UseRealTime();
+
+#ifdef ARROW_WITH_ZLIB
+PARALLEL_STREAM_BENCHMARKS(Compression::GZIP)
+#endif
+
+#ifdef ARROW_WITH_ZSTD
+PARALLEL_STREAM_BENCHMARKS(Compression::ZSTD)
+#endif
+
+#ifdef ARROW_WITH_LZ4
+PARALLEL_STREAM_BENCHMARKS(Compression::LZ4_FRAME)
+#endif
+
 }  // namespace util
 }  // namespace arrow
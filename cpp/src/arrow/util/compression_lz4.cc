@@ -238,6 +238,49 @@ class LZ4Compressor : public Compressor {
 // ----------------------------------------------------------------------
 // Lz4 frame codec implementation
 
+// Walk the block headers of the LZ4 frame starting at `input` to find its end
+// (see https://github.com/lz4/lz4/blob/dev/doc/lz4_Frame_format.md)
+Result<int64_t> Lz4FrameCompressedSize(int64_t input_len, const uint8_t* input) {
+  constexpr uint32_t kMagicNumber = 0x184D2204U;
+  constexpr uint32_t kSkippableMagicMask = 0xFFFFFFF0U;
+  constexpr uint32_t kSkippableMagicStart = 0x184D2A50U;
+
+  auto load_uint32 = [&](int64_t pos) {
+    return BitUtil::FromLittleEndian(SafeLoadAs<uint32_t>(input + pos));
+  };
+
+  if (input_len < 8) {
+    return 0;
+  }
+  const uint32_t magic = load_uint32(0);
+  if ((magic & kSkippableMagicMask) == kSkippableMagicStart) {
+    const int64_t frame_size = 8 + static_cast<int64_t>(load_uint32(4));
+    return frame_size <= input_len ? frame_size : 0;
+  }
+  if (magic != kMagicNumber) {
+    return Status::IOError("Lz4 frame parsing failed: invalid magic number");
+  }
+  const uint8_t flags = input[4];
+  const bool has_block_checksum = (flags & 0x10) != 0;
+  const bool has_content_size = (flags & 0x08) != 0;
+  const bool has_content_checksum = (flags & 0x04) != 0;
+  const bool has_dict_id = (flags & 0x01) != 0;
+  // Magic number, FLG, BD, optional content size and dictionary id, HC
+  int64_t pos = 4 + 2 + (has_content_size ? 8 : 0) + (has_dict_id ? 4 : 0) + 1;
+
+  while (pos + 4 <= input_len) {
+    const uint32_t block_size = load_uint32(pos) & 0x7FFFFFFFU;
+    pos += 4;
+    if (block_size == 0) {
+      // EndMark
+      pos += has_content_checksum ? 4 : 0;
+      return pos <= input_len ? pos : 0;
+    }
+    pos += block_size + (has_block_checksum ? 4 : 0);
+  }
+  return 0;
+}
+
 class Lz4FrameCodec : public Codec {
  public:
   Lz4FrameCodec() : prefs_(DefaultPreferences()) {}
@@ -298,6 +341,10 @@ class Lz4FrameCodec : public Codec {
     return ptr;
   }
 
+  Result<int64_t> FrameCompressedSize(int64_t input_len, const uint8_t* input) override {
+    return Lz4FrameCompressedSize(input_len, input);
+  }
+
   Compression::type compression_type() const override { return Compression::LZ4_FRAME; }
 
  protected:
@@ -22,6 +22,7 @@
 #include <memory>
 
 #include <zstd.h>
+#include <zstd_errors.h>
 
 #include "arrow/result.h"
 #include "arrow/status.h"
@@ -227,6 +228,18 @@ class ZSTDCodec : public Codec {
     return ptr;
   }
 
+  Result<int64_t> FrameCompressedSize(int64_t input_len, const uint8_t* input) override {
+    size_t ret = ZSTD_findFrameCompressedSize(input, static_cast<size_t>(input_len));
+    if (ZSTD_isError(ret)) {
+      if (ZSTD_getErrorCode(ret) == ZSTD_error_srcSize_wrong) {
+        // Frame is incomplete
+        return 0;
+      }
+      return ZSTDError(ret, "ZSTD frame parsing failed: ");
+    }
+    return static_cast<int64_t>(ret);
+  }
+
   Compression::type compression_type() const override { return Compression::ZSTD; }
 
   int compression_level() const override { return compression_level_; }
@@ -326,4 +326,40 @@ void FutureImpl::AddCallback(Callback callback) {
   GetConcreteFuture(this)->AddCallback(std::move(callback));
 }
 
+Future<> AllComplete(const std::vector<Future<>>& futures) {
+  struct State {
+    explicit State(int64_t n_futures) : remaining(n_futures) {}
+
+    std::atomic<int64_t> remaining;
+    std::mutex mutex;
+    Status status;
+  };
+
+  if (futures.empty()) {
+    return Future<>::MakeFinished();
+  }
+
+  auto state = std::make_shared<State>(static_cast<int64_t>(futures.size()));
+  auto out = Future<>::Make();
+  for (const auto& future : futures) {
+    future.AddCallback([state, out](const Result<detail::Empty>& result) mutable {
+      if (!result.ok()) {
+        std::lock_guard<std::mutex> lock(state->mutex);
+        if (state->status.ok()) {
+          state->status = result.status();
+        }
+      }
+      if (state->remaining.fetch_sub(1) == 1) {
+        Status status;
+        {
+          std::lock_guard<std::mutex> lock(state->mutex);
+          status = std::move(state->status);
+        }
+        out.MarkFinished(std::move(status));
+      }
+    });
+  }
+  return out;
+}
+
 }  // namespace arrow
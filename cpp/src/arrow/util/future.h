@@ -557,6 +557,13 @@ inline bool WaitForAll(const std::vector<Future<T>*>& futures,
   return waiter->Wait(seconds);
 }
 
+/// \brief Create a Future which completes when all of `futures` complete.
+///
+/// This is the non-blocking counterpart of WaitForAll.  The returned Future fails
+/// with the error of the first failed future, if any, once all have completed.
+ARROW_EXPORT
+Future<> AllComplete(const std::vector<Future<>>& futures);
+
 /// \brief Wait for one of the futures to end, or for the given timeout to expire.
 ///
 /// The indices of all completed futures are returned.  Note that some futures
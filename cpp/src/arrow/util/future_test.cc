@@ -404,6 +404,53 @@ TEST(FutureTest, StressCallback) {
   }
 }
 
+TEST(FutureTest, AllComplete) {
+  {
+    std::vector<Future<>> futures = {Future<>::Make(), Future<>::Make()};
+    auto all = AllComplete(futures);
+    ASSERT_FALSE(all.is_finished());
+    futures[1].MarkFinished();
+    ASSERT_FALSE(all.is_finished());
+    futures[0].MarkFinished();
+    ASSERT_TRUE(all.is_finished());
+    ASSERT_OK(all.status());
+  }
+  {
+    auto fut = Future<int>::Make();
+    std::vector<Future<>> futures = {Future<>(fut), Future<>::Make()};
+    auto all = AllComplete(futures);
+    fut.MarkFinished(Status::IOError("xxx"));
+    ASSERT_FALSE(all.is_finished());
+    futures[1].MarkFinished();
+    ASSERT_RAISES(IOError, all.status());
+  }
+  // No futures
+  ASSERT_OK(AllComplete({}).status());
+}
+
+TEST(FutureTest, Transfer) {
+  auto pool = *ThreadPool::Make(/*threads=*/1);
+
+  auto fut = Future<int>::Make();
+  std::thread::id callback_thread;
+  auto continued = pool->Transfer(fut).Then([&](const int& value) {
+    callback_thread = std::this_thread::get_id();
+    return value + 1;
+  });
+  fut.MarkFinished(41);
+  ASSERT_OK_AND_EQ(42, continued.result());
+  // The continuation didn't run on the thread which completed the Future
+  ASSERT_NE(callback_thread, std::this_thread::get_id());
+
+  // Errors are transferred too
+  auto failed = Future<int>::MakeFinished(Status::IOError("xxx"));
+  ASSERT_RAISES(IOError, pool->Transfer(failed).result());
+
+  // Spawning fails once the executor is shut down
+  ASSERT_OK(pool->Shutdown());
+  ASSERT_RAISES(Invalid, pool->Transfer(Future<int>::MakeFinished(1)).result());
+}
+
 TEST(FutureCompletionTest, Void) {
   {
     // Simple callback
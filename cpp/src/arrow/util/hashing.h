@@ -41,6 +41,7 @@
 #include "arrow/util/bitmap_builders.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/macros.h"
+#include "arrow/util/simd.h"
 #include "arrow/util/ubsan.h"
 
 #define XXH_INLINE_ALL
@@ -363,6 +364,231 @@ class HashTable {
   TypedBufferBuilder<Entry> entries_builder_;
 };
 
+// ----------------------------------------------------------------------
+// An open-addressing insert-only hash table (no deletes) probing groups of
+// slots with SIMD instructions, after Abseil's "Swiss tables"
+
+// Match the control bytes of a group of slots against a value, returning one
+// bit per matching slot.
+struct SwissGroup {
+#if defined(ARROW_HAVE_AVX2)
+  static constexpr int kSize = 32;
+
+  static uint32_t Match(const uint8_t* ctrl, uint8_t value) {
+    const __m256i group = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ctrl));
+    const __m256i eq =
+        _mm256_cmpeq_epi8(group, _mm256_set1_epi8(static_cast<char>(value)));
+    return static_cast<uint32_t>(_mm256_movemask_epi8(eq));
+  }
+#elif defined(ARROW_HAVE_SSE4_2)
+  static constexpr int kSize = 16;
+
+  static uint32_t Match(const uint8_t* ctrl, uint8_t value) {
+    const __m128i group = _mm_loadu_si128(reinterpret_cast<const __m128i*>(ctrl));
+    const __m128i eq = _mm_cmpeq_epi8(group, _mm_set1_epi8(static_cast<char>(value)));
+    return static_cast<uint32_t>(_mm_movemask_epi8(eq));
+  }
+#else
+  static constexpr int kSize = 16;
+
+  static uint32_t Match(const uint8_t* ctrl, uint8_t value) {
+    uint32_t mask = 0;
+    for (int i = 0; i < kSize; ++i) {
+      mask |= static_cast<uint32_t>(ctrl[i] == value) << i;
+    }
+    return mask;
+  }
+#endif
+};
+
+// Like HashTable, entries hold the full hash so that the table can be grown
+// without hashing the keys again.  In addition, each slot has a control byte
+// holding either kEmpty or 7 bits of the entry's hash.  A lookup compares the
+// control bytes of a whole group of slots at once, then only looks at the
+// entries whose control byte matches: this skips most entries, and the probe
+// sequence (over groups rather than slots) is much shorter thanks to the wide
+// groups, even at a load factor of 7/8.
+//
+// This pays off for large tables with many cache misses per lookup, but is
+// slower than HashTable for small tables, so it is not the default for memo
+// tables: pass it as the HashTableTemplateType of ScalarMemoTable or
+// BinaryMemoTable where a large number of distinct values is expected.
+template <typename Payload>
+class SwissHashTable {
+ public:
+  static constexpr hash_t kSentinel = 0ULL;
+  static constexpr int64_t kGroupSize = SwissGroup::kSize;
+
+  struct Entry {
+    hash_t h;
+    Payload payload;
+
+    // An entry is valid if the hash is different from the sentinel value
+    operator bool() const { return h != kSentinel; }
+  };
+
+  SwissHashTable(MemoryPool* pool, uint64_t capacity)
+      : entries_builder_(pool), ctrl_builder_(pool) {
+    DCHECK_NE(pool, nullptr);
+    // Minimum of 32 elements, and keep the load factor <= 7/8
+    capacity = std::max<uint64_t>(capacity + capacity / 7, 32UL);
+    capacity_ = std::max<uint64_t>(BitUtil::NextPower2(capacity), kGroupSize);
+    size_ = 0;
+
+    DCHECK_OK(UpsizeBuffer(capacity_));
+  }
+
+  // Lookup with probing of successive groups.
+  // cmp_func should have signature bool(const Payload*).
+  // Return a (Entry*, found) pair.
+  template <typename CmpFunc>
+  std::pair<Entry*, bool> Lookup(hash_t h, CmpFunc&& cmp_func) {
+    auto p = Lookup<DoCompare, CmpFunc>(h, ctrl_, entries_, group_mask(),
+                                        std::forward<CmpFunc>(cmp_func));
+    return {&entries_[p.first], p.second};
+  }
+
+  template <typename CmpFunc>
+  std::pair<const Entry*, bool> Lookup(hash_t h, CmpFunc&& cmp_func) const {
+    auto p = Lookup<DoCompare, CmpFunc>(h, ctrl_, entries_, group_mask(),
+                                        std::forward<CmpFunc>(cmp_func));
+    return {&entries_[p.first], p.second};
+  }
+
+  // `entry` must have been returned by an unsuccessful Lookup() of the same hash
+  Status Insert(Entry* entry, hash_t h, const Payload& payload) {
+    // Ensure entry is empty before inserting
+    assert(!*entry);
+    h = FixHash(h);
+    ctrl_[entry - entries_] = Tag(h);
+    entry->h = h;
+    entry->payload = payload;
+    ++size_;
+
+    if (ARROW_PREDICT_FALSE(NeedUpsizing())) {
+      return Upsize(capacity_ * 2);
+    }
+    return Status::OK();
+  }
+
+  uint64_t size() const { return size_; }
+
+  // Visit all non-empty entries in the table
+  // The visit_func should have signature void(const Entry*)
+  template <typename VisitFunc>
+  void VisitEntries(VisitFunc&& visit_func) const {
+    for (uint64_t i = 0; i < capacity_; i++) {
+      if (ctrl_[i] != kEmpty) {
+        visit_func(&entries_[i]);
+      }
+    }
+  }
+
+ protected:
+  // NoCompare is for when the value is known not to exist in the table
+  enum CompareKind { DoCompare, NoCompare };
+
+  // Tags have the high bit clear, unlike kEmpty
+  static constexpr uint8_t kEmpty = 0x80;
+
+  // Groups are selected by the low bits of the hash, so take the tag from other
+  // bits.  The integer hashes of ScalarHelper are byte-swapped products, whose
+  // highest bits depend only on the low bits of the key; use bits 32-38.
+  static uint8_t Tag(hash_t h) { return static_cast<uint8_t>((h >> 32) & 0x7f); }
+
+  uint64_t group_mask() const { return capacity_ / kGroupSize - 1; }
+
+  // The workhorse lookup function
+  template <CompareKind CKind, typename CmpFunc>
+  std::pair<uint64_t, bool> Lookup(hash_t h, const uint8_t* ctrl, const Entry* entries,
+                                   uint64_t group_mask, CmpFunc&& cmp_func) const {
+    h = FixHash(h);
+    const uint8_t tag = Tag(h);
+    uint64_t group = h & group_mask;
+
+    // Triangular probing visits all groups since their number is a power of two.
+    // As there are no deletes, the key can't be in a later group if the current
+    // one has an empty slot.
+    for (uint64_t step = 1;; ++step) {
+      const uint64_t base = group * kGroupSize;
+      if (CKind == DoCompare) {
+        for (uint32_t match = SwissGroup::Match(ctrl + base, tag); match != 0;
+             match &= match - 1) {
+          const uint64_t index = base + BitUtil::CountTrailingZeros(match);
+          if (entries[index].h == h && cmp_func(&entries[index].payload)) {
+            // Found
+            return {index, true};
+          }
+        }
+      }
+      const uint32_t empty = SwissGroup::Match(ctrl + base, kEmpty);
+      if (empty != 0) {
+        // Empty slot
+        return {base + BitUtil::CountTrailingZeros(empty), false};
+      }
+      group = (group + step) & group_mask;
+    }
+  }
+
+  bool NeedUpsizing() const {
+    // Keep the load factor <= 7/8
+    return size_ * 8 >= capacity_ * 7;
+  }
+
+  Status UpsizeBuffer(uint64_t capacity) {
+    RETURN_NOT_OK(entries_builder_.Resize(capacity));
+    entries_ = entries_builder_.mutable_data();
+    memset(static_cast<void*>(entries_), 0, capacity * sizeof(Entry));
+    RETURN_NOT_OK(ctrl_builder_.Resize(capacity));
+    ctrl_ = ctrl_builder_.mutable_data();
+    memset(ctrl_, kEmpty, capacity);
+
+    return Status::OK();
+  }
+
+  Status Upsize(uint64_t new_capacity) {
+    assert(new_capacity > capacity_);
+    assert((new_capacity & (new_capacity - 1)) == 0);  // it's a power of two
+    const uint64_t new_group_mask = new_capacity / kGroupSize - 1;
+
+    // Stash old entries and seal builders, effectively resetting the Buffers
+    const Entry* old_entries = entries_;
+    const uint8_t* old_ctrl = ctrl_;
+    std::shared_ptr<Buffer> previous_entries, previous_ctrl;
+    RETURN_NOT_OK(entries_builder_.Finish(&previous_entries));
+    RETURN_NOT_OK(ctrl_builder_.Finish(&previous_ctrl));
+    // Allocate new buffers
+    RETURN_NOT_OK(UpsizeBuffer(new_capacity));
+
+    for (uint64_t i = 0; i < capacity_; i++) {
+      if (old_ctrl[i] != kEmpty) {
+        const auto& entry = old_entries[i];
+        // Dummy compare function will not be called
+        auto p = Lookup<NoCompare>(entry.h, ctrl_, entries_, new_group_mask,
+                                   [](const Payload*) { return false; });
+        assert(!p.second);
+        ctrl_[p.first] = old_ctrl[i];
+        entries_[p.first] = entry;
+      }
+    }
+    capacity_ = new_capacity;
+
+    return Status::OK();
+  }
+
+  hash_t FixHash(hash_t h) const { return (h == kSentinel) ? 42U : h; }
+
+  // The number of slots available in the hash table array.
+  uint64_t capacity_;
+  // The number of used slots in the hash table array.
+  uint64_t size_;
+
+  Entry* entries_;
+  uint8_t* ctrl_;
+  TypedBufferBuilder<Entry> entries_builder_;
+  TypedBufferBuilder<uint8_t> ctrl_builder_;
+};
+
 // XXX typedef memo_index_t int32_t ?
 
 constexpr int32_t kKeyNotFound = -1;
@@ -589,7 +815,8 @@ class SmallScalarMemoTable : public MemoTable {
 // ----------------------------------------------------------------------
 // A memoization table for variable-sized binary data.
 
-template <typename BinaryBuilderT>
+template <typename BinaryBuilderT,
+          template <class> class HashTableTemplateType = HashTable>
 class BinaryMemoTable : public MemoTable {
  public:
   using builder_offset_type = typename BinaryBuilderT::offset_type;
@@ -799,8 +1026,8 @@ class BinaryMemoTable : public MemoTable {
     int32_t memo_index;
   };
 
-  using HashTableType = HashTable<Payload>;
-  using HashTableEntry = typename HashTable<Payload>::Entry;
+  using HashTableType = HashTableTemplateType<Payload>;
+  using HashTableEntry = typename HashTableType::Entry;
   HashTableType hash_table_;
   BinaryBuilderT binary_builder_;
 
@@ -111,6 +111,60 @@ static void HashLargeStrings(benchmark::State& state) {  // NOLINT non-const ref
   BenchmarkStringHashing(state, values);
 }
 
+// Draw `n_values` values out of `n_distinct` distinct ones
+template <typename T>
+static std::vector<T> SampleValues(const std::vector<T>& distinct, int32_t n_values) {
+  std::default_random_engine gen(42);
+  std::uniform_int_distribution<size_t> index_dist(0, distinct.size() - 1);
+  std::vector<T> values(n_values);
+  std::generate(values.begin(), values.end(),
+                [&]() { return distinct[index_dist(gen)]; });
+  return values;
+}
+
+constexpr int32_t kMemoTableValues = 1 << 20;
+
+template <typename Integer, template <class> class HashTableTemplateType>
+static void MemoTableIntegers(benchmark::State& state) {  // NOLINT non-const reference
+  const auto n_distinct = static_cast<int32_t>(state.range(0));
+  const auto values =
+      SampleValues(MakeIntegers<Integer>(n_distinct), kMemoTableValues);
+
+  for (auto _ : state) {
+    ScalarMemoTable<Integer, HashTableTemplateType> table(default_memory_pool());
+    int32_t memo_index;
+    for (const Integer v : values) {
+      ABORT_NOT_OK(table.GetOrInsert(v, &memo_index));
+    }
+    benchmark::DoNotOptimize(table.size());
+  }
+  state.SetBytesProcessed(state.iterations() * values.size() * sizeof(Integer));
+  state.SetItemsProcessed(state.iterations() * values.size());
+}
+
+template <template <class> class HashTableTemplateType>
+static void MemoTableStrings(benchmark::State& state) {  // NOLINT non-const reference
+  const auto n_distinct = static_cast<int32_t>(state.range(0));
+  const auto max_length = static_cast<int32_t>(state.range(1));
+  const auto values =
+      SampleValues(MakeStrings(n_distinct, 2, max_length), kMemoTableValues);
+  uint64_t total_size = 0;
+  for (const std::string& v : values) {
+    total_size += v.size();
+  }
+
+  for (auto _ : state) {
+    BinaryMemoTable<BinaryBuilder, HashTableTemplateType> table(default_memory_pool());
+    int32_t memo_index;
+    for (const std::string& v : values) {
+      ABORT_NOT_OK(table.GetOrInsert(v, &memo_index));
+    }
+    benchmark::DoNotOptimize(table.size());
+  }
+  state.SetBytesProcessed(state.iterations() * total_size);
+  state.SetItemsProcessed(state.iterations() * values.size());
+}
+
 // ----------------------------------------------------------------------
 // Benchmark declarations
 
@@ -119,5 +173,20 @@ BENCHMARK(HashSmallStrings);
 BENCHMARK(HashMediumStrings);
 BENCHMARK(HashLargeStrings);
 
+// Cardinalities from cache-resident to larger than the last level cache
+#define MEMO_TABLE_ARGS ->RangeMultiplier(16)->Range(16, 1 << 20)->ArgName("distinct")
+
+BENCHMARK_TEMPLATE(MemoTableIntegers, int32_t, HashTable) MEMO_TABLE_ARGS;
+BENCHMARK_TEMPLATE(MemoTableIntegers, int32_t, SwissHashTable) MEMO_TABLE_ARGS;
+BENCHMARK_TEMPLATE(MemoTableIntegers, int64_t, HashTable) MEMO_TABLE_ARGS;
+BENCHMARK_TEMPLATE(MemoTableIntegers, int64_t, SwissHashTable) MEMO_TABLE_ARGS;
+
+#define MEMO_TABLE_STRINGS_ARGS                                  \
+  ->ArgsProduct({{16, 256, 4096, 65536, 1 << 20}, {20, 120}}) \
+  ->ArgNames({"distinct", "max_length"})
+
+BENCHMARK_TEMPLATE(MemoTableStrings, HashTable) MEMO_TABLE_STRINGS_ARGS;
+BENCHMARK_TEMPLATE(MemoTableStrings, SwissHashTable) MEMO_TABLE_STRINGS_ARGS;
+
 }  // namespace internal
 }  // namespace arrow
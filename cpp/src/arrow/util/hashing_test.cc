@@ -374,6 +374,39 @@ TEST(ScalarMemoTable, StressInt64) {
   ASSERT_EQ(table.size(), map.size());
 }
 
+TEST(ScalarMemoTable, StressInt64SwissHashTable) {
+  // Enough distinct values to grow the table several times and fill many groups
+  std::default_random_engine gen(42);
+  std::uniform_int_distribution<int64_t> value_dist(-5000, 5000);
+#ifdef ARROW_VALGRIND
+  const int32_t n_repeats = 500;
+#else
+  const int32_t n_repeats = 50000;
+#endif
+
+  ScalarMemoTable<int64_t, SwissHashTable> table(default_memory_pool(), 0);
+  std::unordered_map<int64_t, int32_t> map;
+
+  for (int32_t i = 0; i < n_repeats; ++i) {
+    int64_t value = value_dist(gen);
+    int32_t expected, actual;
+    auto it = map.find(value);
+    if (it == map.end()) {
+      expected = static_cast<int32_t>(map.size());
+      map[value] = expected;
+    } else {
+      expected = it->second;
+    }
+    ASSERT_OK(table.GetOrInsert(value, &actual));
+    ASSERT_EQ(actual, expected);
+    ASSERT_EQ(table.Get(value), expected);
+  }
+  ASSERT_EQ(table.size(), map.size());
+  ASSERT_EQ(table.Get(5001), kKeyNotFound);
+  AssertGetNull(table, kKeyNotFound);
+  AssertGetOrInsertNull(table, static_cast<int32_t>(map.size()));
+}
+
 TEST(BinaryMemoTable, Basics) {
   std::string A = "", B = "a", C = "foo", D = "bar", E, F;
   E += '\0';
@@ -478,6 +511,45 @@ TEST(BinaryMemoTable, Stress) {
   ASSERT_EQ(table.size(), map.size());
 }
 
+TEST(BinaryMemoTable, StressSwissHashTable) {
+#ifdef ARROW_VALGRIND
+  const int32_t n_values = 20;
+  const int32_t n_repeats = 20;
+#else
+  const int32_t n_values = 2000;
+  const int32_t n_repeats = 10;
+#endif
+
+  const auto values = MakeDistinctStrings(n_values);
+
+  BinaryMemoTable<BinaryBuilder, SwissHashTable> table(default_memory_pool(), 0);
+  std::unordered_map<std::string, int32_t> map;
+
+  for (int32_t i = 0; i < n_repeats; ++i) {
+    for (const auto& value : values) {
+      int32_t expected, actual;
+      auto it = map.find(value);
+      if (it == map.end()) {
+        expected = static_cast<int32_t>(map.size());
+        map[value] = expected;
+      } else {
+        expected = it->second;
+      }
+      ASSERT_OK(table.GetOrInsert(value, &actual));
+      ASSERT_EQ(actual, expected);
+    }
+  }
+  ASSERT_EQ(table.size(), map.size());
+  std::vector<std::string> visited;
+  table.VisitValues(0, [&](const util::string_view& v) {
+    visited.emplace_back(v.data(), v.length());
+  });
+  ASSERT_EQ(visited.size(), map.size());
+  for (int32_t i = 0; i < static_cast<int32_t>(visited.size()); ++i) {
+    ASSERT_EQ(map[visited[i]], i);
+  }
+}
+
 TEST(BinaryMemoTable, Empty) {
   BinaryMemoTable<BinaryBuilder> table(default_memory_pool());
   ASSERT_EQ(table.size(), 0);
@@ -46,6 +46,12 @@ struct IterationTraits {
   static T End() { return T(NULLPTR); }
 };
 
+/// \brief Whether `value` is the reserved end of iteration value of its type
+template <typename T>
+bool IsIterationEnd(const T& value) {
+  return value == IterationTraits<T>::End();
+}
+
 template <typename T>
 struct IterationTraits<util::optional<T>> {
   /// \brief by default when iterating through a sequence of optional,
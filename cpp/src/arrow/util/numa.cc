@@ -0,0 +1,344 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/util/numa.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <utility>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include "arrow/buffer.h"
+#include "arrow/device.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/string.h"
+
+namespace arrow {
+namespace internal {
+
+namespace {
+
+// The node of the NumaThreadPool worker running on this thread
+thread_local int current_numa_node = -1;
+
+#ifdef __linux__
+constexpr bool kCanBindMemory = true;
+
+// From <linux/mempolicy.h>, which isn't available everywhere
+constexpr int kMpolPreferred = 1;
+
+std::string ReadFirstLine(const std::string& path) {
+  std::ifstream file(path, std::ios::in);
+  std::string line;
+  std::getline(file, line);
+  return TrimString(line);
+}
+#else
+constexpr bool kCanBindMemory = false;
+#endif
+
+}  // namespace
+
+// ----------------------------------------------------------------------
+// NumaTopology
+
+Result<std::vector<int>> ParseCpuList(util::string_view list) {
+  std::vector<int> cpus;
+  const std::string original(list);
+  while (!list.empty()) {
+    auto comma = list.find(',');
+    auto range = list.substr(0, comma);
+    list = comma == util::string_view::npos ? util::string_view()
+                                            : list.substr(comma + 1);
+    if (range.empty()) continue;
+    auto parse = [&](util::string_view s) -> Result<int> {
+      try {
+        size_t pos;
+        int value = std::stoi(std::string(s), &pos);
+        if (pos == s.size() && value >= 0) return value;
+      } catch (...) {
+      }
+      return Status::Invalid("Invalid CPU list: '", original, "'");
+    };
+    auto dash = range.find('-');
+    if (dash == util::string_view::npos) {
+      ARROW_ASSIGN_OR_RAISE(auto cpu, parse(range));
+      cpus.push_back(cpu);
+    } else {
+      ARROW_ASSIGN_OR_RAISE(auto first, parse(range.substr(0, dash)));
+      ARROW_ASSIGN_OR_RAISE(auto last, parse(range.substr(dash + 1)));
+      if (last < first) {
+        return Status::Invalid("Invalid CPU list: '", original, "'");
+      }
+      for (int cpu = first; cpu <= last; ++cpu) {
+        cpus.push_back(cpu);
+      }
+    }
+  }
+  return cpus;
+}
+
+NumaTopology NumaTopology::Detect() {
+  NumaTopology topology;
+#ifdef __linux__
+  const std::string sysfs_dir = "/sys/devices/system/node/";
+  auto nodes = ParseCpuList(ReadFirstLine(sysfs_dir + "online")).ValueOr({});
+  if (!nodes.empty()) {
+    // Node numbers may not be contiguous
+    topology.node_cpus.resize(nodes.back() + 1);
+    for (int node : nodes) {
+      const auto cpulist = sysfs_dir + "node" + std::to_string(node) + "/cpulist";
+      topology.node_cpus[node] = ParseCpuList(ReadFirstLine(cpulist)).ValueOr({});
+    }
+    auto has_cpus = [](const std::vector<int>& cpus) { return !cpus.empty(); };
+    if (std::any_of(topology.node_cpus.begin(), topology.node_cpus.end(), has_cpus)) {
+      return topology;
+    }
+  }
+#endif
+  const int num_cpus =
+      std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+  topology.node_cpus.assign(1, {});
+  for (int cpu = 0; cpu < num_cpus; ++cpu) {
+    topology.node_cpus[0].push_back(cpu);
+  }
+  return topology;
+}
+
+NumaTopology NumaTopology::Simulated(int num_nodes, int cpus_per_node) {
+  NumaTopology topology;
+  topology.simulated = true;
+  topology.node_cpus.resize(num_nodes);
+  int cpu = 0;
+  for (auto& cpus : topology.node_cpus) {
+    for (int i = 0; i < cpus_per_node; ++i) {
+      cpus.push_back(cpu++);
+    }
+  }
+  return topology;
+}
+
+Status PinCurrentThread(const std::vector<int>& cpus) {
+#ifdef __linux__
+  cpu_set_t cpu_set;
+  CPU_ZERO(&cpu_set);
+  for (int cpu : cpus) {
+    if (cpu < CPU_SETSIZE) {
+      CPU_SET(cpu, &cpu_set);
+    }
+  }
+  int err = pthread_setaffinity_np(pthread_self(), sizeof(cpu_set), &cpu_set);
+  if (err != 0) {
+    return Status::IOError("Failed to set thread affinity: ", std::strerror(err));
+  }
+#endif
+  return Status::OK();
+}
+
+// ----------------------------------------------------------------------
+// NumaNodeMemoryPool
+
+NumaNodeMemoryPool::NumaNodeMemoryPool(int node, bool bind_memory, MemoryPool* pool)
+    : pool_(pool), node_(node), bind_memory_(bind_memory && kCanBindMemory) {}
+
+NumaNodeMemoryPool::~NumaNodeMemoryPool() {}
+
+Status NumaNodeMemoryPool::AllocateBound(int64_t size, uint8_t** out) {
+#ifdef __linux__
+  const auto length = static_cast<size_t>(BitUtil::RoundUpToPowerOf2(
+      static_cast<uint64_t>(size), static_cast<uint64_t>(sysconf(_SC_PAGESIZE))));
+  void* addr =
+      mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if (addr == MAP_FAILED) {
+    return Status::OutOfMemory("mmap of size ", size, " failed: ", std::strerror(errno));
+  }
+  // Pages are placed on the node when first touched, falling back on other nodes
+  // if it is out of memory.  The policy is only advisory, so errors (e.g. if the
+  // kernel doesn't support NUMA) are ignored.
+  constexpr int kMaxNodes = 1024;
+  if (node_ < kMaxNodes) {
+    uint64_t node_mask[kMaxNodes / 64] = {};
+    node_mask[node_ / 64] = uint64_t(1) << (node_ % 64);
+    ARROW_UNUSED(
+        syscall(SYS_mbind, addr, length, kMpolPreferred, node_mask, kMaxNodes + 1, 0));
+  }
+  *out = reinterpret_cast<uint8_t*>(addr);
+  return Status::OK();
+#else
+  return pool_->Allocate(size, out);
+#endif
+}
+
+void NumaNodeMemoryPool::FreeBound(uint8_t* buffer, int64_t size) {
+#ifdef __linux__
+  const auto length = static_cast<size_t>(BitUtil::RoundUpToPowerOf2(
+      static_cast<uint64_t>(size), static_cast<uint64_t>(sysconf(_SC_PAGESIZE))));
+  munmap(buffer, length);
+#else
+  pool_->Free(buffer, size);
+#endif
+}
+
+Status NumaNodeMemoryPool::Allocate(int64_t size, uint8_t** out) {
+  if (IsBound(size)) {
+    RETURN_NOT_OK(AllocateBound(size, out));
+  } else {
+    RETURN_NOT_OK(pool_->Allocate(size, out));
+  }
+  stats_.UpdateAllocatedBytes(size);
+  return Status::OK();
+}
+
+Status NumaNodeMemoryPool::Reallocate(int64_t old_size, int64_t new_size,
+                                      uint8_t** ptr) {
+  if (!IsBound(old_size) && !IsBound(new_size)) {
+    RETURN_NOT_OK(pool_->Reallocate(old_size, new_size, ptr));
+  } else {
+    uint8_t* out;
+    if (IsBound(new_size)) {
+      RETURN_NOT_OK(AllocateBound(new_size, &out));
+    } else {
+      RETURN_NOT_OK(pool_->Allocate(new_size, &out));
+    }
+    std::memcpy(out, *ptr, static_cast<size_t>(std::min(old_size, new_size)));
+    if (IsBound(old_size)) {
+      FreeBound(*ptr, old_size);
+    } else {
+      pool_->Free(*ptr, old_size);
+    }
+    *ptr = out;
+  }
+  stats_.UpdateAllocatedBytes(new_size - old_size);
+  return Status::OK();
+}
+
+void NumaNodeMemoryPool::Free(uint8_t* buffer, int64_t size) {
+  if (IsBound(size)) {
+    FreeBound(buffer, size);
+  } else {
+    pool_->Free(buffer, size);
+  }
+  stats_.UpdateAllocatedBytes(-size);
+}
+
+int64_t NumaNodeMemoryPool::bytes_allocated() const { return stats_.bytes_allocated(); }
+
+int64_t NumaNodeMemoryPool::max_memory() const { return stats_.max_memory(); }
+
+std::string NumaNodeMemoryPool::backend_name() const { return pool_->backend_name(); }
+
+int NumaNodeOf(const Buffer& buffer) {
+  const auto& memory_manager = buffer.memory_manager();
+  if (memory_manager == nullptr || !memory_manager->is_cpu()) {
+    return -1;
+  }
+  auto cpu_manager = std::dynamic_pointer_cast<CPUMemoryManager>(memory_manager);
+  if (cpu_manager == nullptr) {
+    return -1;
+  }
+  auto numa_pool = dynamic_cast<const NumaNodeMemoryPool*>(cpu_manager->pool());
+  return numa_pool != nullptr ? numa_pool->numa_node() : -1;
+}
+
+int GetCurrentNumaNode() { return current_numa_node; }
+
+// ----------------------------------------------------------------------
+// NumaThreadPool
+
+NumaThreadPool::NumaThreadPool(NumaTopology topology) : topology_(std::move(topology)) {}
+
+NumaThreadPool::~NumaThreadPool() {}
+
+Result<std::shared_ptr<NumaThreadPool>> NumaThreadPool::Make(
+    NumaTopology topology, int threads_per_node, ThreadPool::Scheduling scheduling,
+    MemoryPool* pool) {
+  if (topology.num_nodes() == 0) {
+    return Status::Invalid("NUMA topology has no nodes");
+  }
+  if (threads_per_node < 0) {
+    return Status::Invalid("NumaThreadPool threads per node must be >= 0");
+  }
+  auto numa_pool = std::shared_ptr<NumaThreadPool>(new NumaThreadPool(topology));
+  for (int node = 0; node < topology.num_nodes(); ++node) {
+    const auto& cpus = topology.node_cpus[node];
+    const bool pin = !topology.simulated;
+    // Nodes without CPUs (memory-only) still get a worker, so that hinted tasks
+    // can run; it isn't pinned.
+    const int threads =
+        threads_per_node > 0 ? threads_per_node
+                             : std::max(1, static_cast<int>(cpus.size()));
+    auto worker_init = [node, cpus, pin] {
+      current_numa_node = node;
+      if (pin && !cpus.empty()) {
+        auto st = PinCurrentThread(cpus);
+        if (!st.ok()) {
+          ARROW_LOG(WARNING) << "Failed to pin worker to NUMA node " << node << ": "
+                             << st.ToString();
+        }
+      }
+    };
+    ARROW_ASSIGN_OR_RAISE(auto thread_pool,
+                          ThreadPool::Make(threads, scheduling, std::move(worker_init)));
+    numa_pool->thread_pools_.push_back(std::move(thread_pool));
+    numa_pool->memory_pools_.emplace_back(
+        new NumaNodeMemoryPool(node, /*bind_memory=*/!topology.simulated, pool));
+  }
+  return numa_pool;
+}
+
+int NumaThreadPool::GetCapacity() {
+  int capacity = 0;
+  for (const auto& thread_pool : thread_pools_) {
+    capacity += thread_pool->GetCapacity();
+  }
+  return capacity;
+}
+
+Status NumaThreadPool::Shutdown(bool wait) {
+  Status st;
+  for (const auto& thread_pool : thread_pools_) {
+    st &= thread_pool->Shutdown(wait);
+  }
+  return st;
+}
+
+Status NumaThreadPool::SpawnReal(TaskHints hints, FnOnce<void()> task) {
+  const int num_nodes = this->num_nodes();
+  int node = hints.numa_node;
+  if (node < 0 || node >= num_nodes) {
+    node = current_numa_node;
+  }
+  if (node < 0 || node >= num_nodes) {
+    node = static_cast<int>(next_node_.fetch_add(1) % num_nodes);
+  }
+  return thread_pools_[node]->Spawn(hints, std::move(task));
+}
+
+}  // namespace internal
+}  // namespace arrow
@@ -0,0 +1,150 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "arrow/memory_pool.h"
+#include "arrow/result.h"
+#include "arrow/status.h"
+#include "arrow/util/string_view.h"
+#include "arrow/util/thread_pool.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+class Buffer;
+
+namespace internal {
+
+// The NUMA nodes of the machine and their CPUs.
+struct ARROW_EXPORT NumaTopology {
+  // The CPUs of each node, by node number
+  std::vector<std::vector<int>> node_cpus;
+  // A simulated topology doesn't match the machine: threads aren't pinned to its
+  // CPUs and memory isn't bound to its nodes, but tasks and buffers are still
+  // assigned to nodes.  This allows testing NUMA-aware code on any machine.
+  bool simulated = false;
+
+  int num_nodes() const { return static_cast<int>(node_cpus.size()); }
+
+  // Read the topology of the machine from sysfs.  If it isn't available (e.g. not
+  // on Linux), a single node with all CPUs is returned.
+  static NumaTopology Detect();
+
+  // Make a simulated topology with the given number of nodes and CPUs per node
+  static NumaTopology Simulated(int num_nodes, int cpus_per_node);
+};
+
+// Parse a list of CPUs or nodes in the Linux sysfs format, e.g. "0-3,8,10-11"
+ARROW_EXPORT Result<std::vector<int>> ParseCpuList(util::string_view list);
+
+// Restrict the current thread to the given CPUs.  A no-op on platforms where
+// thread affinity is not supported.
+ARROW_EXPORT Status PinCurrentThread(const std::vector<int>& cpus);
+
+// A MemoryPool allocating memory on a given NUMA node.
+//
+// Allocations of at least `kMinBindSize` bytes are mapped directly and bound to
+// the node (unless `bind_memory` is false, e.g. for a simulated topology).
+// Smaller ones are delegated to the underlying pool: they are placed on the node
+// of the thread first touching them, which is the local node when they are
+// allocated and filled by a worker of a NumaThreadPool.
+class ARROW_EXPORT NumaNodeMemoryPool : public MemoryPool {
+ public:
+  static constexpr int64_t kMinBindSize = 256 * 1024;
+
+  NumaNodeMemoryPool(int node, bool bind_memory,
+                     MemoryPool* pool = default_memory_pool());
+  ~NumaNodeMemoryPool() override;
+
+  Status Allocate(int64_t size, uint8_t** out) override;
+  Status Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) override;
+  void Free(uint8_t* buffer, int64_t size) override;
+
+  int64_t bytes_allocated() const override;
+  int64_t max_memory() const override;
+  std::string backend_name() const override;
+
+  int numa_node() const { return node_; }
+
+ private:
+  Status AllocateBound(int64_t size, uint8_t** out);
+  void FreeBound(uint8_t* buffer, int64_t size);
+  bool IsBound(int64_t size) const { return bind_memory_ && size >= kMinBindSize; }
+
+  MemoryPool* pool_;
+  const int node_;
+  const bool bind_memory_;
+  MemoryPoolStats stats_;
+};
+
+// Return the NUMA node of a buffer allocated from a NumaNodeMemoryPool, or -1.
+ARROW_EXPORT int NumaNodeOf(const Buffer& buffer);
+
+// Return the NUMA node of the NumaThreadPool worker running on the current thread,
+// or -1.
+ARROW_EXPORT int GetCurrentNumaNode();
+
+// An Executor made of one ThreadPool per NUMA node, whose workers are pinned to
+// the CPUs of their node, and of one NumaNodeMemoryPool per node.
+//
+// A task runs on the node given by TaskHints::numa_node, if any.  Otherwise, a task
+// spawned from a worker runs on the same node, and other tasks are distributed
+// round-robin over the nodes.
+class ARROW_EXPORT NumaThreadPool : public Executor {
+ public:
+  // Construct a pool with `threads_per_node` workers per node; if 0, one per CPU
+  // of the node.
+  static Result<std::shared_ptr<NumaThreadPool>> Make(
+      NumaTopology topology, int threads_per_node = 0,
+      ThreadPool::Scheduling scheduling = ThreadPool::Scheduling::FIFO,
+      MemoryPool* pool = default_memory_pool());
+
+  ~NumaThreadPool() override;
+
+  int GetCapacity() override;
+
+  const NumaTopology& topology() const { return topology_; }
+  int num_nodes() const { return topology_.num_nodes(); }
+
+  // The thread pool running the tasks of a node
+  ThreadPool* node_thread_pool(int node) { return thread_pools_[node].get(); }
+  // The memory pool allocating on a node
+  MemoryPool* node_memory_pool(int node) { return memory_pools_[node].get(); }
+
+  // Shutdown the pools of all nodes (see ThreadPool::Shutdown())
+  Status Shutdown(bool wait = true);
+
+ protected:
+  explicit NumaThreadPool(NumaTopology topology);
+
+  Status SpawnReal(TaskHints hints, FnOnce<void()> task) override;
+
+  NumaTopology topology_;
+  std::vector<std::shared_ptr<ThreadPool>> thread_pools_;
+  std::vector<std::unique_ptr<NumaNodeMemoryPool>> memory_pools_;
+  std::atomic<uint32_t> next_node_{0};
+};
+
+}  // namespace internal
+}  // namespace arrow
@@ -0,0 +1,180 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/util/numa.h"
+
+#ifdef __linux__
+#include <sched.h>
+#endif
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/buffer.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/util/thread_pool.h"
+
+namespace arrow {
+namespace internal {
+
+// Run a task on the pool and return the NUMA node it ran on
+static Result<int> NodeOfTask(Executor* executor, TaskHints hints = {}) {
+  ARROW_ASSIGN_OR_RAISE(auto fut, executor->Submit(hints, GetCurrentNumaNode));
+  return fut.result();
+}
+
+TEST(NumaTopology, ParseCpuList) {
+  ASSERT_OK_AND_EQ(std::vector<int>({}), ParseCpuList(""));
+  ASSERT_OK_AND_EQ(std::vector<int>({3}), ParseCpuList("3"));
+  ASSERT_OK_AND_EQ(std::vector<int>({0, 1, 2, 3, 8, 10, 11}),
+                   ParseCpuList("0-3,8,10-11"));
+  ASSERT_RAISES(Invalid, ParseCpuList("0-"));
+  ASSERT_RAISES(Invalid, ParseCpuList("3-1"));
+  ASSERT_RAISES(Invalid, ParseCpuList("a,b"));
+}
+
+TEST(NumaTopology, Detect) {
+  auto topology = NumaTopology::Detect();
+  ASSERT_FALSE(topology.simulated);
+  ASSERT_GE(topology.num_nodes(), 1);
+  int num_cpus = 0;
+  for (const auto& cpus : topology.node_cpus) {
+    num_cpus += static_cast<int>(cpus.size());
+  }
+  ASSERT_GE(num_cpus, 1);
+}
+
+TEST(NumaTopology, Simulated) {
+  auto topology = NumaTopology::Simulated(2, 3);
+  ASSERT_TRUE(topology.simulated);
+  ASSERT_EQ(2, topology.num_nodes());
+  ASSERT_EQ(std::vector<int>({3, 4, 5}), topology.node_cpus[1]);
+}
+
+TEST(NumaThreadPool, Hints) {
+  ASSERT_OK_AND_ASSIGN(auto pool, NumaThreadPool::Make(NumaTopology::Simulated(3, 2)));
+  ASSERT_EQ(3, pool->num_nodes());
+  ASSERT_EQ(6, pool->GetCapacity());
+  ASSERT_EQ(-1, GetCurrentNumaNode());
+
+  for (int node = 0; node < 3; ++node) {
+    TaskHints hints;
+    hints.numa_node = node;
+    ASSERT_OK_AND_EQ(node, NodeOfTask(pool.get(), hints));
+  }
+
+  // Unhinted tasks spawned from outside are distributed over all nodes
+  std::vector<int> nodes;
+  for (int i = 0; i < 6; ++i) {
+    ASSERT_OK_AND_ASSIGN(auto node, NodeOfTask(pool.get()));
+    nodes.push_back(node);
+  }
+  std::sort(nodes.begin(), nodes.end());
+  ASSERT_EQ(std::vector<int>({0, 0, 1, 1, 2, 2}), nodes);
+
+  // Unhinted tasks spawned from a worker stay on its node
+  TaskHints hints;
+  hints.numa_node = 2;
+  ASSERT_OK_AND_ASSIGN(auto fut, pool->Submit(hints, [&]() -> Result<int> {
+    for (int i = 0; i < 4; ++i) {
+      ARROW_ASSIGN_OR_RAISE(auto nested, pool->Submit(GetCurrentNumaNode));
+      ARROW_ASSIGN_OR_RAISE(auto node, nested.result());
+      if (node != 2) return node;
+    }
+    return 2;
+  }));
+  ASSERT_OK_AND_EQ(2, fut.result());
+
+  ASSERT_OK(pool->Shutdown());
+}
+
+TEST(NumaThreadPool, BufferPlacement) {
+  ASSERT_OK_AND_ASSIGN(auto pool, NumaThreadPool::Make(NumaTopology::Simulated(2, 1)));
+
+  for (int node = 0; node < 2; ++node) {
+    ASSERT_OK_AND_ASSIGN(auto buffer,
+                         AllocateBuffer(1024, pool->node_memory_pool(node)));
+    ASSERT_EQ(node, NumaNodeOf(*buffer));
+    ASSERT_EQ(1024, pool->node_memory_pool(node)->bytes_allocated());
+
+    // Work on the buffer is scheduled on its node
+    TaskHints hints;
+    hints.numa_node = NumaNodeOf(*buffer);
+    ASSERT_OK_AND_EQ(node, NodeOfTask(pool.get(), hints));
+  }
+  ASSERT_OK_AND_ASSIGN(auto buffer, AllocateBuffer(1000));
+  ASSERT_EQ(-1, NumaNodeOf(*buffer));
+
+  ASSERT_OK(pool->Shutdown());
+}
+
+TEST(NumaNodeMemoryPool, Allocations) {
+  // Binding memory is a no-op on single node machines, but exercises the
+  // direct mappings of large allocations
+  for (bool bind_memory : {false, true}) {
+    SCOPED_TRACE(bind_memory);
+    NumaNodeMemoryPool pool(0, bind_memory);
+    constexpr int64_t kLarge = NumaNodeMemoryPool::kMinBindSize + 1;
+
+    uint8_t *small, *large;
+    ASSERT_OK(pool.Allocate(100, &small));
+    ASSERT_OK(pool.Allocate(kLarge, &large));
+    ASSERT_EQ(0, reinterpret_cast<uintptr_t>(large) % 64);
+    std::memset(small, 1, 100);
+    std::memset(large, 2, kLarge);
+    ASSERT_EQ(100 + kLarge, pool.bytes_allocated());
+
+    // Crossing the threshold in both directions
+    ASSERT_OK(pool.Reallocate(100, kLarge, &small));
+    ASSERT_EQ(1, small[99]);
+    ASSERT_OK(pool.Reallocate(kLarge, 50, &large));
+    ASSERT_EQ(2, large[49]);
+    ASSERT_OK(pool.Reallocate(kLarge, 2 * kLarge, &small));
+    ASSERT_EQ(1, small[0]);
+
+    pool.Free(small, 2 * kLarge);
+    pool.Free(large, 50);
+    ASSERT_EQ(0, pool.bytes_allocated());
+    ASSERT_EQ(2 * kLarge + 50, pool.max_memory());
+  }
+}
+
+#ifdef __linux__
+TEST(NumaThreadPool, Pinning) {
+  auto topology = NumaTopology::Detect();
+  ASSERT_OK_AND_ASSIGN(auto pool,
+                       NumaThreadPool::Make(topology, /*threads_per_node=*/1));
+  for (int node = 0; node < topology.num_nodes(); ++node) {
+    const auto& cpus = topology.node_cpus[node];
+    if (cpus.empty()) continue;
+    TaskHints hints;
+    hints.numa_node = node;
+    ASSERT_OK_AND_ASSIGN(auto fut, pool->Submit(hints, [] { return sched_getcpu(); }));
+    ASSERT_OK_AND_ASSIGN(int cpu, fut.result());
+    ASSERT_NE(std::find(cpus.begin(), cpus.end(), cpu), cpus.end())
+        << "task ran on CPU " << cpu << " outside of node " << node;
+  }
+  ASSERT_OK(pool->Shutdown());
+}
+#endif
+
+}  // namespace internal
+}  // namespace arrow
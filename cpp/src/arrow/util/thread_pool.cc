@@ -18,8 +18,10 @@
 #include "arrow/util/thread_pool.h"
 
 #include <algorithm>
+#include <atomic>
 #include <condition_variable>
 #include <deque>
+#include <functional>
 #include <list>
 #include <mutex>
 #include <string>
@@ -34,8 +36,165 @@ namespace internal {
 
 Executor::~Executor() = default;
 
+namespace {
+
+using Task = FnOnce<void()>;
+
+// Tasks are queued in bands according to TaskHints::priority: negative priorities
+// are more urgent than the default, and positive priorities less urgent.
+constexpr int kNumPriorityBands = 3;
+
+int PriorityBand(const TaskHints& hints) {
+  return hints.priority < 0 ? 0 : hints.priority == 0 ? 1 : 2;
+}
+
+// A Chase-Lev work-stealing deque of heap allocated tasks, with the memory orderings
+// of "Correct and Efficient Work-Stealing for Weak Memory Models" (Le et al., 2013).
+// The owning worker pushes and pops tasks at the bottom; other workers steal tasks
+// from the top.
+class WorkStealingDeque {
+ public:
+  WorkStealingDeque() {
+    buffers_.emplace_back(new Buffer(kInitialCapacity));
+    buffer_.store(buffers_.back().get());
+  }
+
+  ~WorkStealingDeque() {
+    Buffer* buffer = buffer_.load();
+    for (int64_t i = top_.load(); i < bottom_.load(); ++i) {
+      delete buffer->Get(i);
+    }
+  }
+
+  // Only called by the owner
+  void Push(Task* task) {
+    int64_t b = bottom_.load(std::memory_order_relaxed);
+    int64_t t = top_.load(std::memory_order_acquire);
+    Buffer* buffer = buffer_.load(std::memory_order_relaxed);
+    if (b - t > buffer->capacity - 1) {
+      buffer = Grow(buffer, t, b);
+    }
+    buffer->Put(b, task);
+    // A release store rather than the paper's release fence, which is equivalent
+    // but understood by ThreadSanitizer
+    bottom_.store(b + 1, std::memory_order_release);
+  }
+
+  // Only called by the owner
+  Task* Pop() {
+    int64_t b = bottom_.load(std::memory_order_relaxed) - 1;
+    Buffer* buffer = buffer_.load(std::memory_order_relaxed);
+    bottom_.store(b, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    int64_t t = top_.load(std::memory_order_relaxed);
+
+    if (t > b) {
+      // Empty
+      bottom_.store(b + 1, std::memory_order_relaxed);
+      return nullptr;
+    }
+
+    Task* task = buffer->Get(b);
+    if (t == b) {
+      // Last task; race thieves for it
+      if (!top_.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst,
+                                        std::memory_order_relaxed)) {
+        task = nullptr;
+      }
+      bottom_.store(b + 1, std::memory_order_relaxed);
+    }
+    return task;
+  }
+
+  // May be called by any thread.  May spuriously return null if it raced with
+  // another thief or with the owner.
+  Task* Steal() {
+    int64_t t = top_.load(std::memory_order_acquire);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    int64_t b = bottom_.load(std::memory_order_acquire);
+    if (t >= b) return nullptr;
+
+    Buffer* buffer = buffer_.load(std::memory_order_acquire);
+    Task* task = buffer->Get(t);
+    if (!top_.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst,
+                                      std::memory_order_relaxed)) {
+      return nullptr;
+    }
+    return task;
+  }
+
+  bool Empty() const { return bottom_.load() <= top_.load(); }
+
+ private:
+  static constexpr int64_t kInitialCapacity = 64;
+
+  struct Buffer {
+    explicit Buffer(int64_t capacity)
+        : capacity(capacity), slots(new std::atomic<Task*>[capacity]) {}
+
+    Task* Get(int64_t i) const {
+      return slots[i & (capacity - 1)].load(std::memory_order_relaxed);
+    }
+
+    void Put(int64_t i, Task* task) {
+      slots[i & (capacity - 1)].store(task, std::memory_order_relaxed);
+    }
+
+    const int64_t capacity;
+    std::unique_ptr<std::atomic<Task*>[]> slots;
+  };
+
+  Buffer* Grow(Buffer* old_buffer, int64_t t, int64_t b) {
+    buffers_.emplace_back(new Buffer(old_buffer->capacity * 2));
+    Buffer* buffer = buffers_.back().get();
+    for (int64_t i = t; i < b; ++i) {
+      buffer->Put(i, old_buffer->Get(i));
+    }
+    buffer_.store(buffer, std::memory_order_release);
+    return buffer;
+  }
+
+  std::atomic<int64_t> top_{0};
+  std::atomic<int64_t> bottom_{0};
+  std::atomic<Buffer*> buffer_{nullptr};
+  // Superseded buffers may still be read by thieves, so they are kept until
+  // destruction.  Only modified by the owner.
+  std::vector<std::unique_ptr<Buffer>> buffers_;
+};
+
+// The deques of a worker, one per priority band
+struct WorkerQueues {
+  WorkStealingDeque bands[kNumPriorityBands];
+  // Whether a worker currently owns these deques (protected by State::mutex_)
+  bool in_use = false;
+};
+
+// The pool and deques of the worker running on the current thread, if any
+struct CurrentWorker {
+  ThreadPool::State* state;
+  WorkerQueues* queues;
+};
+
+thread_local CurrentWorker current_worker = {nullptr, nullptr};
+
+}  // namespace
+
 struct ThreadPool::State {
-  State() = default;
+  State(Scheduling scheduling, std::function<void()> worker_init)
+      : worker_init_(std::move(worker_init)),
+        work_stealing_(scheduling == Scheduling::WORK_STEALING) {
+    for (auto& num_injected : num_injected_) {
+      num_injected.store(0);
+    }
+  }
+
+  ~State() {
+    for (auto& injected : injected_) {
+      for (Task* task : injected) {
+        delete task;
+      }
+    }
+  }
 
   // NOTE: in case locking becomes too expensive, we can investigate lock-free FIFOs
   // such as https://github.com/cameron314/concurrentqueue
@@ -47,7 +206,9 @@ struct ThreadPool::State {
   std::list<std::thread> workers_;
   // Trashcan for finished threads
   std::vector<std::thread> finished_workers_;
-  std::deque<FnOnce<void()>> pending_tasks_;
+  // Pending tasks, by priority band (FIFO scheduling)
+  std::deque<Task> pending_tasks_[kNumPriorityBands];
+  size_t num_pending_tasks_ = 0;
 
   // Desired number of threads
   int desired_capacity_ = 0;
@@ -58,8 +219,195 @@ struct ThreadPool::State {
   // Are we shutting down?
   bool please_shutdown_ = false;
   bool quick_shutdown_ = false;
+
+  // Called at the start of each worker thread, if set
+  const std::function<void()> worker_init_;
+
+  void PushPendingUnlocked(int band, Task task) {
+    pending_tasks_[band].push_back(std::move(task));
+    ++num_pending_tasks_;
+  }
+
+  Task PopPendingUnlocked() {
+    DCHECK_GT(num_pending_tasks_, 0);
+    for (auto& pending : pending_tasks_) {
+      if (pending.empty()) continue;
+      Task task = std::move(pending.front());
+      pending.pop_front();
+      --num_pending_tasks_;
+      return task;
+    }
+    return Task();
+  }
+
+  void ClearPendingUnlocked() {
+    for (auto& pending : pending_tasks_) {
+      pending.clear();
+    }
+    num_pending_tasks_ = 0;
+    for (int band = 0; band < kNumPriorityBands; ++band) {
+      for (Task* task : injected_[band]) {
+        delete task;
+      }
+      injected_[band].clear();
+      num_injected_[band].store(0);
+    }
+  }
+
+  // Work stealing scheduling
+
+  const bool work_stealing_;
+
+  // All deques ever allocated, owned or free (protected by mutex_)
+  std::vector<std::unique_ptr<WorkerQueues>> worker_queues_;
+  // Thieves iterate over a snapshot of worker_queues_ without locking.  A new snapshot
+  // is published whenever deques are allocated; older snapshots are kept until
+  // destruction.
+  std::vector<std::unique_ptr<std::vector<WorkerQueues*>>> worker_queues_snapshots_;
+  std::atomic<const std::vector<WorkerQueues*>*> worker_queues_snapshot_{nullptr};
+
+  // Tasks spawned from outside the pool, by priority band (protected by mutex_)
+  std::deque<Task*> injected_[kNumPriorityBands];
+  std::atomic<int64_t> num_injected_[kNumPriorityBands];
+
+  std::atomic<int> num_sleeping_{0};
+  // Mirror please_shutdown_ and quick_shutdown_ for lock-free checks
+  std::atomic<bool> stopping_{false};
+  std::atomic<bool> quick_stopping_{false};
+
+  // Take ownership of free deques, allocating them if necessary
+  WorkerQueues* AcquireWorkerQueuesUnlocked() {
+    for (const auto& queues : worker_queues_) {
+      if (!queues->in_use) {
+        queues->in_use = true;
+        return queues.get();
+      }
+    }
+
+    worker_queues_.emplace_back(new WorkerQueues);
+    worker_queues_.back()->in_use = true;
+
+    worker_queues_snapshots_.emplace_back(new std::vector<WorkerQueues*>);
+    for (const auto& queues : worker_queues_) {
+      worker_queues_snapshots_.back()->push_back(queues.get());
+    }
+    worker_queues_snapshot_.store(worker_queues_snapshots_.back().get(),
+                                  std::memory_order_release);
+    return worker_queues_.back().get();
+  }
+
+  // Take a task spawned from outside the pool.  A share of the remaining tasks is
+  // moved to the worker's own deque so that they can be run (or stolen) without
+  // locking.
+  Task* TakeInjected(int band, WorkerQueues* own) {
+    static constexpr size_t kMaxBatch = 32;
+
+    size_t num_moved;
+    Task* task;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      auto& injected = injected_[band];
+      if (injected.empty()) return nullptr;
+
+      task = injected.front();
+      injected.pop_front();
+
+      num_moved = std::min(kMaxBatch, injected.size() / workers_.size());
+      for (size_t i = 0; i < num_moved; ++i) {
+        own->bands[band].Push(injected.front());
+        injected.pop_front();
+      }
+      num_injected_[band].fetch_sub(static_cast<int64_t>(num_moved + 1));
+    }
+
+    if (num_moved > 0) {
+      WakeOne();
+    }
+    return task;
+  }
+
+  Task* Steal(int band, WorkerQueues* own, uint64_t* rng) {
+    const auto& queues = *worker_queues_snapshot_.load(std::memory_order_acquire);
+
+    // xorshift64
+    *rng ^= *rng << 13;
+    *rng ^= *rng >> 7;
+    *rng ^= *rng << 17;
+
+    const size_t start = static_cast<size_t>(*rng % queues.size());
+    for (size_t i = 0; i < queues.size(); ++i) {
+      WorkerQueues* victim = queues[(start + i) % queues.size()];
+      if (victim == own) continue;
+      if (Task* task = victim->bands[band].Steal()) {
+        return task;
+      }
+    }
+    return nullptr;
+  }
+
+  // Find the most urgent task available to a worker
+  Task* FindTask(WorkerQueues* own, uint64_t* rng) {
+    for (int band = 0; band < kNumPriorityBands; ++band) {
+      if (Task* task = own->bands[band].Pop()) {
+        return task;
+      }
+      if (num_injected_[band].load() > 0) {
+        if (Task* task = TakeInjected(band, own)) {
+          return task;
+        }
+      }
+      if (Task* task = Steal(band, own, rng)) {
+        return task;
+      }
+    }
+    return nullptr;
+  }
+
+  bool HasWork() const {
+    for (const auto& num_injected : num_injected_) {
+      if (num_injected.load() > 0) return true;
+    }
+    const auto* snapshot = worker_queues_snapshot_.load();
+    if (snapshot == nullptr) return false;
+    for (WorkerQueues* queues : *snapshot) {
+      for (const auto& deque : queues->bands) {
+        if (!deque.Empty()) return true;
+      }
+    }
+    return false;
+  }
+
+  // Wake a sleeping worker, if any, after a task was made available
+  void WakeOne() {
+    // Pairs with the increment of num_sleeping_ before a worker checks HasWork():
+    // either the worker sees the new task, or we see the worker asleep.
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (num_sleeping_.load() > 0) {
+      // Synchronize with a worker between checking HasWork() and waiting
+      { std::lock_guard<std::mutex> lock(mutex_); }
+      cv_.notify_one();
+    }
+  }
 };
 
+// Move a finished worker's thread object to the trashcan of finished workers.
+// This has two motivations:
+// 1) the thread object doesn't get destroyed before the worker loop finishes
+//    (but we could call thread::detach() instead)
+// 2) we can explicitly join() the trashcan threads to make sure all OS threads
+//    are exited before the ThreadPool is destroyed.  Otherwise subtle
+//    timing conditions can lead to false positives with Valgrind.
+static void RetireWorkerUnlocked(ThreadPool::State* state,
+                                 std::list<std::thread>::iterator it) {
+  DCHECK_EQ(std::this_thread::get_id(), it->get_id());
+  state->finished_workers_.push_back(std::move(*it));
+  state->workers_.erase(it);
+  if (state->please_shutdown_) {
+    // Notify the function waiting in Shutdown().
+    state->cv_shutdown_.notify_one();
+  }
+}
+
 // The worker loop is an independent function so that it can keep running
 // after the ThreadPool is destroyed.
 static void WorkerLoop(std::shared_ptr<ThreadPool::State> state,
@@ -82,7 +430,7 @@ static void WorkerLoop(std::shared_ptr<ThreadPool::State> state,
     // condition variable at the end of the loop.
 
     // Execute pending tasks if any
-    while (!state->pending_tasks_.empty() && !state->quick_shutdown_) {
+    while (state->num_pending_tasks_ > 0 && !state->quick_shutdown_) {
       // We check this opportunistically at each loop iteration since
       // it releases the lock below.
       if (should_secede()) {
@@ -91,8 +439,7 @@ static void WorkerLoop(std::shared_ptr<ThreadPool::State> state,
       --state->ready_count_;
       DCHECK_GE(state->ready_count_, 0);
       {
-        FnOnce<void()> task = std::move(state->pending_tasks_.front());
-        state->pending_tasks_.pop_front();
+        Task task = state->PopPendingUnlocked();
         lock.unlock();
         std::move(task)();
       }
@@ -109,24 +456,74 @@ static void WorkerLoop(std::shared_ptr<ThreadPool::State> state,
   --state->ready_count_;
   DCHECK_GE(state->ready_count_, 0);
 
-  // We're done.  Move our thread object to the trashcan of finished
-  // workers.  This has two motivations:
-  // 1) the thread object doesn't get destroyed before this function finishes
-  //    (but we could call thread::detach() instead)
-  // 2) we can explicitly join() the trashcan threads to make sure all OS threads
-  //    are exited before the ThreadPool is destroyed.  Otherwise subtle
-  //    timing conditions can lead to false positives with Valgrind.
-  DCHECK_EQ(std::this_thread::get_id(), it->get_id());
-  state->finished_workers_.push_back(std::move(*it));
-  state->workers_.erase(it);
-  if (state->please_shutdown_) {
-    // Notify the function waiting in Shutdown().
-    state->cv_shutdown_.notify_one();
+  // We're done.
+  RetireWorkerUnlocked(state.get(), it);
+}
+
+static void WorkStealingWorkerLoop(std::shared_ptr<ThreadPool::State> state,
+                                   std::list<std::thread>::iterator it,
+                                   WorkerQueues* own) {
+  current_worker = {state.get(), own};
+  uint64_t rng = std::hash<std::thread::id>{}(std::this_thread::get_id()) | 1;
+
+  std::unique_lock<std::mutex> lock(state->mutex_, std::defer_lock);
+  while (true) {
+    if (state->quick_stopping_.load(std::memory_order_relaxed)) {
+      lock.lock();
+      break;
+    }
+
+    if (Task* task = state->FindTask(own, &rng)) {
+      std::move(*task)();
+      delete task;
+      continue;
+    }
+
+    // No task was found, prepare to sleep
+    lock.lock();
+    if (state->quick_shutdown_ ||
+        state->workers_.size() > static_cast<size_t>(state->desired_capacity_)) {
+      break;
+    }
+    state->num_sleeping_.fetch_add(1);
+    if (state->HasWork()) {
+      state->num_sleeping_.fetch_sub(1);
+      lock.unlock();
+      continue;
+    }
+    if (state->please_shutdown_) {
+      state->num_sleeping_.fetch_sub(1);
+      break;
+    }
+    state->cv_.wait(lock);
+    state->num_sleeping_.fetch_sub(1);
+    lock.unlock();
   }
+
+  // Hand over any tasks left in our deques (there may be some if we're seceding)
+  current_worker = {nullptr, nullptr};
+  bool handed_over = false;
+  for (int band = 0; band < kNumPriorityBands; ++band) {
+    while (Task* task = own->bands[band].Pop()) {
+      if (state->quick_shutdown_) {
+        delete task;
+        continue;
+      }
+      state->injected_[band].push_back(task);
+      state->num_injected_[band].fetch_add(1);
+      handed_over = true;
+    }
+  }
+  own->in_use = false;
+  if (handed_over) {
+    state->cv_.notify_all();
+  }
+
+  RetireWorkerUnlocked(state.get(), it);
 }
 
-ThreadPool::ThreadPool()
-    : sp_state_(std::make_shared<ThreadPool::State>()),
+ThreadPool::ThreadPool(Scheduling scheduling, std::function<void()> worker_init)
+    : sp_state_(std::make_shared<ThreadPool::State>(scheduling, std::move(worker_init))),
       state_(sp_state_.get()),
       shutdown_on_destroy_(true) {
 #ifndef _WIN32
@@ -150,9 +547,13 @@ void ThreadPool::ProtectAgainstFork() {
     // existing ThreadPools.
     int capacity = state_->desired_capacity_;
 
-    auto new_state = std::make_shared<ThreadPool::State>();
+    auto new_state = std::make_shared<ThreadPool::State>(
+        state_->work_stealing_ ? Scheduling::WORK_STEALING : Scheduling::FIFO,
+        state_->worker_init_);
     new_state->please_shutdown_ = state_->please_shutdown_;
     new_state->quick_shutdown_ = state_->quick_shutdown_;
+    new_state->stopping_.store(state_->please_shutdown_);
+    new_state->quick_stopping_.store(state_->quick_shutdown_);
 
     pid_ = current_pid;
     sp_state_ = new_state;
@@ -179,8 +580,10 @@ Status ThreadPool::SetCapacity(int threads) {
 
   state_->desired_capacity_ = threads;
   // See if we need to increase or decrease the number of running threads
-  const int required = std::min(static_cast<int>(state_->pending_tasks_.size()),
-                                threads - static_cast<int>(state_->workers_.size()));
+  int required = threads - static_cast<int>(state_->workers_.size());
+  if (!state_->work_stealing_) {
+    required = std::min(static_cast<int>(state_->num_pending_tasks_), required);
+  }
   if (required > 0) {
     // Some tasks are pending, spawn the number of needed threads immediately
     LaunchWorkersUnlocked(required);
@@ -212,12 +615,15 @@ Status ThreadPool::Shutdown(bool wait) {
   }
   state_->please_shutdown_ = true;
   state_->quick_shutdown_ = !wait;
+  state_->stopping_.store(true);
+  state_->quick_stopping_.store(!wait);
   state_->cv_.notify_all();
   state_->cv_shutdown_.wait(lock, [this] { return state_->workers_.empty(); });
   if (!state_->quick_shutdown_) {
-    DCHECK_EQ(state_->pending_tasks_.size(), 0);
+    DCHECK_EQ(state_->num_pending_tasks_, 0);
+    DCHECK(!state_->work_stealing_ || !state_->HasWork());
   } else {
-    state_->pending_tasks_.clear();
+    state_->ClearPendingUnlocked();
   }
   CollectFinishedWorkersUnlocked();
   DCHECK_EQ(state_->ready_count_, 0);
@@ -238,38 +644,78 @@ void ThreadPool::LaunchWorkersUnlocked(int threads) {
   for (int i = 0; i < threads; i++) {
     state_->workers_.emplace_back();
     auto it = --(state_->workers_.end());
-    *it = std::thread([state, it] { WorkerLoop(state, it); });
+    if (state_->work_stealing_) {
+      WorkerQueues* queues = state_->AcquireWorkerQueuesUnlocked();
+      *it = std::thread([state, it, queues] {
+        if (state->worker_init_) state->worker_init_();
+        WorkStealingWorkerLoop(state, it, queues);
+      });
+    } else {
+      *it = std::thread([state, it] {
+        if (state->worker_init_) state->worker_init_();
+        WorkerLoop(state, it);
+      });
+    }
   }
 }
 
 Status ThreadPool::SpawnReal(TaskHints hints, FnOnce<void()> task) {
+  ProtectAgainstFork();
+  const int band = PriorityBand(hints);
+
+  if (state_->work_stealing_) {
+    if (current_worker.state == state_) {
+      // Spawned from one of our workers: push to its own deque without locking
+      if (state_->stopping_.load()) {
+        return Status::Invalid("operation forbidden during or after shutdown");
+      }
+      current_worker.queues->bands[band].Push(new Task(std::move(task)));
+    } else {
+      std::lock_guard<std::mutex> lock(state_->mutex_);
+      if (state_->please_shutdown_) {
+        return Status::Invalid("operation forbidden during or after shutdown");
+      }
+      CollectFinishedWorkersUnlocked();
+      state_->injected_[band].push_back(new Task(std::move(task)));
+      state_->num_injected_[band].fetch_add(1);
+    }
+    state_->WakeOne();
+    return Status::OK();
+  }
+
   {
-    ProtectAgainstFork();
     std::lock_guard<std::mutex> lock(state_->mutex_);
     if (state_->please_shutdown_) {
       return Status::Invalid("operation forbidden during or after shutdown");
     }
     CollectFinishedWorkersUnlocked();
     if (state_->desired_capacity_ > static_cast<int>(state_->workers_.size()) &&
-        state_->ready_count_ == 0) {
-      // Pool capacity is not full and no workers are ready to execute the task,
-      // spawn one more thread.
+        static_cast<size_t>(state_->ready_count_) <= state_->num_pending_tasks_) {
+      // Pool capacity is not full and all ready workers will be busy with already
+      // pending tasks, spawn one more thread.
       LaunchWorkersUnlocked(/*threads=*/1);
     }
-    state_->pending_tasks_.push_back(std::move(task));
+    state_->PushPendingUnlocked(band, std::move(task));
   }
   state_->cv_.notify_one();
   return Status::OK();
 }
 
-Result<std::shared_ptr<ThreadPool>> ThreadPool::Make(int threads) {
-  auto pool = std::shared_ptr<ThreadPool>(new ThreadPool());
+Result<std::shared_ptr<ThreadPool>> ThreadPool::Make(int threads, Scheduling scheduling) {
+  return Make(threads, scheduling, {});
+}
+
+Result<std::shared_ptr<ThreadPool>> ThreadPool::Make(int threads, Scheduling scheduling,
+                                                     std::function<void()> worker_init) {
+  auto pool =
+      std::shared_ptr<ThreadPool>(new ThreadPool(scheduling, std::move(worker_init)));
   RETURN_NOT_OK(pool->SetCapacity(threads));
   return pool;
 }
 
-Result<std::shared_ptr<ThreadPool>> ThreadPool::MakeEternal(int threads) {
-  ARROW_ASSIGN_OR_RAISE(auto pool, Make(threads));
+Result<std::shared_ptr<ThreadPool>> ThreadPool::MakeEternal(int threads,
+                                                            Scheduling scheduling) {
+  ARROW_ASSIGN_OR_RAISE(auto pool, Make(threads, scheduling));
   // On Windows, the ThreadPool destructor may be called after non-main threads
   // have been killed by the OS, and hang in a condition variable.
   // On Unix, we want to avoid leak reports by Valgrind.
@@ -321,7 +767,18 @@ int ThreadPool::DefaultCapacity() {
 
 // Helper for the singleton pattern
 std::shared_ptr<ThreadPool> ThreadPool::MakeCpuThreadPool() {
-  auto maybe_pool = ThreadPool::MakeEternal(ThreadPool::DefaultCapacity());
+  auto scheduling = Scheduling::FIFO;
+  auto maybe_env = GetEnvVar("ARROW_CPU_THREAD_POOL_SCHEDULING");
+  if (maybe_env.ok()) {
+    if (*maybe_env == "work_stealing") {
+      scheduling = Scheduling::WORK_STEALING;
+    } else if (*maybe_env != "fifo") {
+      ARROW_LOG(WARNING) << "Unrecognized ARROW_CPU_THREAD_POOL_SCHEDULING value '"
+                         << *maybe_env << "', using FIFO scheduling";
+    }
+  }
+
+  auto maybe_pool = ThreadPool::MakeEternal(ThreadPool::DefaultCapacity(), scheduling);
   if (!maybe_pool.ok()) {
     maybe_pool.status().Abort("Failed to create global CPU thread pool");
   }
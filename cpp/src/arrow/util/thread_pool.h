@@ -22,6 +22,7 @@
 #endif
 
 #include <cstdint>
+#include <functional>
 #include <memory>
 #include <type_traits>
 #include <utility>
@@ -59,9 +60,12 @@ ARROW_EXPORT Status SetCpuThreadPoolCapacity(int threads);
 namespace internal {
 
 // Hints about a task that may be used by an Executor.
-// They are ignored by the provided ThreadPool implementation.
+// The provided ThreadPool implementation only considers `priority`;
+// NumaThreadPool (see numa.h) also considers `numa_node`.
 struct TaskHints {
-  // The lower, the more urgent
+  // The lower, the more urgent.  ThreadPool runs tasks of negative priority
+  // before tasks of zero (the default) priority, and those before tasks of positive
+  // priority; tasks of equal sign are not reordered.
   int32_t priority = 0;
   // The IO transfer size in bytes
   int64_t io_size = -1;
@@ -69,6 +73,8 @@ struct TaskHints {
   int64_t cpu_cost = -1;
   // An application-specific ID
   int64_t external_id = -1;
+  // The NUMA node holding the data the task works on, if known (see NumaNodeOf())
+  int32_t numa_node = -1;
 };
 
 class ARROW_EXPORT Executor {
@@ -109,6 +115,25 @@ class ARROW_EXPORT Executor {
     return Submit(TaskHints{}, std::forward<Function>(func), std::forward<Args>(args)...);
   }
 
+  // Return a Future that completes with the result of `future`, but from a task
+  // spawned on this executor.  Callbacks and continuations added to the returned
+  // Future therefore run on this executor, rather than on the thread which completed
+  // `future` (e.g. an IO thread).  If the task can't be spawned, the returned Future
+  // fails with the corresponding error.
+  template <typename T>
+  Future<T> Transfer(Future<T> future) {
+    auto transferred = Future<T>::Make();
+    future.AddCallback([this, transferred](const Result<T>& result) mutable {
+      Status st = Spawn([transferred, result]() mutable {
+        transferred.MarkFinished(std::move(result));
+      });
+      if (!st.ok()) {
+        transferred.MarkFinished(std::move(st));
+      }
+    });
+    return transferred;
+  }
+
   // Return the level of parallelism (the number of tasks that may be executed
   // concurrently).  This may be an approximate number.
   virtual int GetCapacity() = 0;
@@ -122,16 +147,36 @@ class ARROW_EXPORT Executor {
   virtual Status SpawnReal(TaskHints hints, FnOnce<void()> task) = 0;
 };
 
-// An Executor implementation spawning tasks in FIFO manner on a fixed-size
-// pool of worker threads.
+// An Executor implementation spawning tasks on a fixed-size pool of worker
+// threads, in order of priority (see TaskHints).
 class ARROW_EXPORT ThreadPool : public Executor {
  public:
+  // How tasks of equal priority are distributed among worker threads
+  enum class Scheduling {
+    // Tasks are queued in FIFOs (one per priority band) protected by a mutex and
+    // shared by all workers.  Workers are started on demand.
+    FIFO,
+    // Each worker has its own lock-free deques.  Tasks spawned from a worker are
+    // pushed to its deques and run by it in LIFO order, unless stolen (in FIFO order)
+    // by an idle worker.  Tasks spawned from other threads are queued in a shared
+    // FIFO, from which workers take them in batches.  Workers are started eagerly.
+    // This reduces contention when many small tasks are spawned from within tasks.
+    WORK_STEALING,
+  };
+
   // Construct a thread pool with the given number of worker threads
-  static Result<std::shared_ptr<ThreadPool>> Make(int threads);
+  static Result<std::shared_ptr<ThreadPool>> Make(
+      int threads, Scheduling scheduling = Scheduling::FIFO);
+
+  // Like Make(), but `worker_init` is called at the start of each worker thread
+  // (e.g. to pin it to some CPUs).
+  static Result<std::shared_ptr<ThreadPool>> Make(int threads, Scheduling scheduling,
+                                                  std::function<void()> worker_init);
 
   // Like Make(), but takes care that the returned ThreadPool is compatible
   // with destruction late at process exit.
-  static Result<std::shared_ptr<ThreadPool>> MakeEternal(int threads);
+  static Result<std::shared_ptr<ThreadPool>> MakeEternal(
+      int threads, Scheduling scheduling = Scheduling::FIFO);
 
   // Destroy thread pool; the pool will first be shut down
   ~ThreadPool() override;
@@ -165,10 +210,12 @@ class ARROW_EXPORT ThreadPool : public Executor {
 
  protected:
   FRIEND_TEST(TestThreadPool, SetCapacity);
+  FRIEND_TEST(TestThreadPool, SpawnBurst);
+  FRIEND_TEST(TestWorkStealingThreadPool, SetCapacity);
   FRIEND_TEST(TestGlobalThreadPool, Capacity);
   friend ARROW_EXPORT ThreadPool* GetCpuThreadPool();
 
-  ThreadPool();
+  explicit ThreadPool(Scheduling scheduling, std::function<void()> worker_init = {});
 
   Status SpawnReal(TaskHints hints, FnOnce<void()> task) override;
 
@@ -192,6 +239,9 @@ class ARROW_EXPORT ThreadPool : public Executor {
 };
 
 // Return the process-global thread pool for CPU-bound tasks.
+//
+// It uses FIFO scheduling, unless the ARROW_CPU_THREAD_POOL_SCHEDULING environment
+// variable is set to "work_stealing" when it is first created.
 ARROW_EXPORT ThreadPool* GetCpuThreadPool();
 
 }  // namespace internal
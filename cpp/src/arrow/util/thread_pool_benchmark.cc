@@ -18,6 +18,8 @@
 #include "benchmark/benchmark.h"
 
 #include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <cstdint>
 #include <cstdlib>
 #include <functional>
@@ -25,6 +27,7 @@
 #include <limits>
 #include <memory>
 #include <random>
+#include <thread>
 #include <vector>
 
 #include "arrow/status.h"
@@ -135,6 +138,109 @@ static void ThreadPoolSubmit(benchmark::State& state) {  // NOLINT non-const ref
   state.SetItemsProcessed(state.iterations() * nspawns);
 }
 
+static ThreadPool::Scheduling SchedulingArg(int64_t arg) {
+  return arg == 0 ? ThreadPool::Scheduling::FIFO : ThreadPool::Scheduling::WORK_STEALING;
+}
+
+// Benchmark ThreadPool::Spawn from within tasks: each task spawns two children
+// until the tree has the requested number of tasks.  With FIFO scheduling, all
+// workers contend on the pool's mutex; with work stealing, children are pushed to
+// the spawning worker's own deque.
+static void ThreadPoolSpawnNested(benchmark::State& state) {  // NOLINT non-const ref
+  const auto nthreads = static_cast<int>(state.range(0));
+  const auto scheduling = SchedulingArg(state.range(1));
+  const auto workload_size = static_cast<int32_t>(state.range(2));
+
+  Workload workload(workload_size);
+  constexpr int32_t kDepth = 16;
+
+  for (auto _ : state) {
+    state.PauseTiming();
+    auto pool = *ThreadPool::Make(nthreads, scheduling);
+    std::atomic<int32_t> n_finished{0};
+    state.ResumeTiming();
+
+    std::function<void(int32_t)> task = [&](int32_t depth) {
+      workload();
+      if (depth < kDepth) {
+        ABORT_NOT_OK(pool->Spawn([&task, depth] { task(depth + 1); }));
+        ABORT_NOT_OK(pool->Spawn([&task, depth] { task(depth + 1); }));
+      }
+      n_finished.fetch_add(1);
+    };
+    ABORT_NOT_OK(pool->Spawn([&] { task(0); }));
+
+    // Tasks can't be spawned once shutdown has started, so wait for the whole tree
+    // before shutting down
+    while (n_finished.load() < (1 << (kDepth + 1)) - 1) {
+      std::this_thread::yield();
+    }
+    ABORT_NOT_OK(pool->Shutdown(true /* wait */));
+    state.PauseTiming();
+    pool.reset();
+    state.ResumeTiming();
+  }
+  state.SetItemsProcessed(state.iterations() * ((1 << (kDepth + 1)) - 1));
+}
+
+// Benchmark the latency of an urgent task submitted to a pool flooded with
+// low-priority tasks
+static void ThreadPoolPriorityLatency(
+    benchmark::State& state) {  // NOLINT non-const reference
+  const auto nthreads = static_cast<int>(state.range(0));
+  const auto scheduling = SchedulingArg(state.range(1));
+
+  Workload workload(10000);
+  constexpr int32_t kNumBackgroundTasks = 10000;
+
+  TaskHints background_hints;
+  background_hints.priority = 1;
+  TaskHints urgent_hints;
+  urgent_hints.priority = -1;
+
+  for (auto _ : state) {
+    state.PauseTiming();
+    auto pool = *ThreadPool::Make(nthreads, scheduling);
+    for (int32_t i = 0; i < kNumBackgroundTasks; ++i) {
+      ABORT_NOT_OK(pool->Spawn(background_hints, std::ref(workload)));
+    }
+    std::atomic<bool> done{false};
+    state.ResumeTiming();
+
+    ABORT_NOT_OK(pool->Spawn(urgent_hints, [&] { done.store(true); }));
+    while (!done.load()) {
+      std::this_thread::yield();
+    }
+
+    state.PauseTiming();
+    ABORT_NOT_OK(pool->Shutdown(false /* wait */));
+    pool.reset();
+    state.ResumeTiming();
+  }
+}
+
+static void ThreadPoolSpawnNested_Customize(benchmark::internal::Benchmark* b) {
+  for (const int32_t w : {100, 10000}) {
+    for (const int nthreads : {1, 2, 4, 8}) {
+      for (const int scheduling : {0, 1}) {
+        b->Args({nthreads, scheduling, w});
+      }
+    }
+  }
+  b->ArgNames({"threads", "work_stealing", "task_cost"});
+  b->UseRealTime();
+}
+
+static void ThreadPoolPriorityLatency_Customize(benchmark::internal::Benchmark* b) {
+  for (const int nthreads : {1, 4}) {
+    for (const int scheduling : {0, 1}) {
+      b->Args({nthreads, scheduling});
+    }
+  }
+  b->ArgNames({"threads", "work_stealing"});
+  b->UseRealTime();
+}
+
 // Benchmark serial TaskGroup
 static void SerialTaskGroup(benchmark::State& state) {  // NOLINT non-const reference
   const auto workload_size = static_cast<int32_t>(state.range(0));
@@ -226,6 +332,8 @@ BENCHMARK(SerialTaskGroup)->Apply(WorkloadCost_Customize);
 BENCHMARK(ThreadPoolSpawn)->Apply(ThreadPoolSpawn_Customize);
 BENCHMARK(ThreadedTaskGroup)->Apply(ThreadPoolSpawn_Customize);
 BENCHMARK(ThreadPoolSubmit)->Apply(ThreadPoolSpawn_Customize);
+BENCHMARK(ThreadPoolSpawnNested)->Apply(ThreadPoolSpawnNested_Customize);
+BENCHMARK(ThreadPoolPriorityLatency)->Apply(ThreadPoolPriorityLatency_Customize);
 
 }  // namespace internal
 }  // namespace arrow
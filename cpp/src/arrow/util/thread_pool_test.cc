@@ -21,10 +21,12 @@
 #endif
 
 #include <algorithm>
+#include <atomic>
 #include <cstdio>
 #include <cstdlib>
 #include <functional>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <thread>
 #include <vector>
@@ -133,7 +135,7 @@ class TestThreadPool : public ::testing::Test {
 
   std::shared_ptr<ThreadPool> MakeThreadPool() { return MakeThreadPool(4); }
 
-  std::shared_ptr<ThreadPool> MakeThreadPool(int threads) {
+  virtual std::shared_ptr<ThreadPool> MakeThreadPool(int threads) {
     return *ThreadPool::Make(threads);
   }
 
@@ -165,7 +167,18 @@ class TestThreadPool : public ::testing::Test {
   }
 };
 
-TEST_F(TestThreadPool, ConstructDestruct) {
+// Generic tests, run for each scheduling mode
+
+class TestThreadPoolScheduling
+    : public TestThreadPool,
+      public ::testing::WithParamInterface<ThreadPool::Scheduling> {
+ public:
+  std::shared_ptr<ThreadPool> MakeThreadPool(int threads) override {
+    return *ThreadPool::Make(threads, GetParam());
+  }
+};
+
+TEST_P(TestThreadPoolScheduling, ConstructDestruct) {
   // Stress shutdown-at-destruction logic
   for (int threads : {1, 2, 3, 8, 32, 70}) {
     auto pool = this->MakeThreadPool(threads);
@@ -174,22 +187,22 @@ TEST_F(TestThreadPool, ConstructDestruct) {
 
 // Correctness and stress tests using Spawn() and Shutdown()
 
-TEST_F(TestThreadPool, Spawn) {
+TEST_P(TestThreadPoolScheduling, Spawn) {
   auto pool = this->MakeThreadPool(3);
   SpawnAdds(pool.get(), 7, task_add<int>);
 }
 
-TEST_F(TestThreadPool, StressSpawn) {
+TEST_P(TestThreadPoolScheduling, StressSpawn) {
   auto pool = this->MakeThreadPool(30);
   SpawnAdds(pool.get(), 1000, task_add<int>);
 }
 
-TEST_F(TestThreadPool, StressSpawnThreaded) {
+TEST_P(TestThreadPoolScheduling, StressSpawnThreaded) {
   auto pool = this->MakeThreadPool(30);
   SpawnAddsThreaded(pool.get(), 20, 100, task_add<int>);
 }
 
-TEST_F(TestThreadPool, SpawnSlow) {
+TEST_P(TestThreadPoolScheduling, SpawnSlow) {
   // This checks that Shutdown() waits for all tasks to finish
   auto pool = this->MakeThreadPool(2);
   SpawnAdds(pool.get(), 7, [](int x, int y, int* out) {
@@ -197,21 +210,21 @@ TEST_F(TestThreadPool, SpawnSlow) {
   });
 }
 
-TEST_F(TestThreadPool, StressSpawnSlow) {
+TEST_P(TestThreadPoolScheduling, StressSpawnSlow) {
   auto pool = this->MakeThreadPool(30);
   SpawnAdds(pool.get(), 1000, [](int x, int y, int* out) {
     return task_slow_add(0.002 /* seconds */, x, y, out);
   });
 }
 
-TEST_F(TestThreadPool, StressSpawnSlowThreaded) {
+TEST_P(TestThreadPoolScheduling, StressSpawnSlowThreaded) {
   auto pool = this->MakeThreadPool(30);
   SpawnAddsThreaded(pool.get(), 20, 100, [](int x, int y, int* out) {
     return task_slow_add(0.002 /* seconds */, x, y, out);
   });
 }
 
-TEST_F(TestThreadPool, QuickShutdown) {
+TEST_P(TestThreadPoolScheduling, QuickShutdown) {
   AddTester add_tester(100);
   {
     auto pool = this->MakeThreadPool(3);
@@ -224,6 +237,115 @@ TEST_F(TestThreadPool, QuickShutdown) {
   add_tester.CheckNotAllComputed();
 }
 
+// Test Submit() functionality
+
+TEST_P(TestThreadPoolScheduling, Submit) {
+  auto pool = this->MakeThreadPool(3);
+  {
+    ASSERT_OK_AND_ASSIGN(Future<int> fut, pool->Submit(add<int>, 4, 5));
+    Result<int> res = fut.result();
+    ASSERT_OK_AND_EQ(9, res);
+  }
+  {
+    ASSERT_OK_AND_ASSIGN(Future<std::string> fut,
+                         pool->Submit(add<std::string>, "foo", "bar"));
+    ASSERT_OK_AND_EQ("foobar", fut.result());
+  }
+  {
+    ASSERT_OK_AND_ASSIGN(auto fut, pool->Submit(slow_add<int>, 0.01 /* seconds */, 4, 5));
+    ASSERT_OK_AND_EQ(9, fut.result());
+  }
+  {
+    // Reference passing
+    std::string s = "foo";
+    ASSERT_OK_AND_ASSIGN(auto fut,
+                         pool->Submit(inplace_add<std::string>, std::ref(s), "bar"));
+    ASSERT_OK_AND_EQ("foobar", fut.result());
+    ASSERT_EQ(s, "foobar");
+  }
+  {
+    // `void` return type
+    ASSERT_OK_AND_ASSIGN(auto fut, pool->Submit(SleepFor, 0.001));
+    ASSERT_OK(fut.status());
+  }
+}
+
+// Test TaskHints::priority
+
+// Spawn tasks of various priorities behind a task blocking the only worker, and
+// return the priorities in execution order.
+static std::vector<int> RunPrioritizedTasks(ThreadPool* pool) {
+  std::atomic<bool> started{false}, unblocked{false};
+  ARROW_EXPECT_OK(pool->Spawn([&] {
+    started = true;
+    busy_wait(10, [&] { return unblocked.load(); });
+  }));
+  busy_wait(10, [&] { return started.load(); });
+
+  std::mutex mutex;
+  std::vector<int> order;
+  for (int priority : {1, 0, -1, 1, -1, 0, 5, -5}) {
+    TaskHints hints;
+    hints.priority = priority;
+    ARROW_EXPECT_OK(pool->Spawn(hints, [&, priority] {
+      std::lock_guard<std::mutex> lock(mutex);
+      order.push_back(priority);
+    }));
+  }
+  unblocked = true;
+  ARROW_EXPECT_OK(pool->Shutdown());
+  return order;
+}
+
+static void AssertPrioritized(const std::vector<int>& order) {
+  ASSERT_EQ(order.size(), 8);
+  const auto band = [](int priority) { return priority < 0 ? 0 : priority == 0 ? 1 : 2; };
+  for (size_t i = 1; i < order.size(); ++i) {
+    ASSERT_LE(band(order[i - 1]), band(order[i]));
+  }
+}
+
+TEST_P(TestThreadPoolScheduling, Priority) {
+  auto pool = this->MakeThreadPool(1);
+  auto order = RunPrioritizedTasks(pool.get());
+  AssertPrioritized(order);
+  if (GetParam() == ThreadPool::Scheduling::FIFO) {
+    // Tasks of the same band run in submission order
+    ASSERT_EQ(order, std::vector<int>({-1, -1, -5, 0, 0, 1, 1, 5}));
+  }
+}
+
+TEST_P(TestThreadPoolScheduling, SpawnFromTasks) {
+  // Each task spawns two children until the given depth; with work stealing,
+  // tasks spawned by a worker go to its own deque, from where idle workers
+  // steal them.
+  constexpr int kDepth = 12;
+  auto pool = this->MakeThreadPool(4);
+  std::atomic<int> num_finished{0};
+
+  std::function<void(int)> task = [&](int depth) {
+    if (depth < kDepth) {
+      for (int i = 0; i < 2; ++i) {
+        ASSERT_OK(pool->Spawn([&task, depth] { task(depth + 1); }));
+      }
+    }
+    ++num_finished;
+  };
+  ASSERT_OK(pool->Spawn([&] { task(0); }));
+
+  const int expected = (1 << (kDepth + 1)) - 1;
+  busy_wait(10, [&] { return num_finished.load() == expected; });
+  ASSERT_EQ(num_finished.load(), expected);
+  ASSERT_OK(pool->Shutdown());
+}
+
+INSTANTIATE_TEST_SUITE_P(Fifo, TestThreadPoolScheduling,
+                         ::testing::Values(ThreadPool::Scheduling::FIFO));
+INSTANTIATE_TEST_SUITE_P(WorkStealing, TestThreadPoolScheduling,
+                         ::testing::Values(ThreadPool::Scheduling::WORK_STEALING));
+
+// Tests specific to FIFO scheduling
+
 TEST_F(TestThreadPool, SetCapacity) {
   auto pool = this->MakeThreadPool(5);
 
@@ -274,37 +396,71 @@ TEST_F(TestThreadPool, SetCapacity) {
   ASSERT_OK(pool->Shutdown());
 }
 
-// Test Submit() functionality
+TEST_F(TestThreadPool, SpawnBurst) {
+  constexpr int kCapacity = 8;
+  auto pool = this->MakeThreadPool(kCapacity);
 
-TEST_F(TestThreadPool, Submit) {
-  auto pool = this->MakeThreadPool(3);
-  {
-    ASSERT_OK_AND_ASSIGN(Future<int> fut, pool->Submit(add<int>, 4, 5));
-    Result<int> res = fut.result();
-    ASSERT_OK_AND_EQ(9, res);
-  }
-  {
-    ASSERT_OK_AND_ASSIGN(Future<std::string> fut,
-                         pool->Submit(add<std::string>, "foo", "bar"));
-    ASSERT_OK_AND_EQ("foobar", fut.result());
-  }
-  {
-    ASSERT_OK_AND_ASSIGN(auto fut, pool->Submit(slow_add<int>, 0.01 /* seconds */, 4, 5));
-    ASSERT_OK_AND_EQ(9, fut.result());
+  // Leave a single idle worker
+  ASSERT_OK_AND_ASSIGN(auto fut, pool->Submit(add<int>, 4, 5));
+  ASSERT_OK_AND_EQ(9, fut.result());
+  ASSERT_EQ(pool->GetActualCapacity(), 1);
+
+  // Ready workers can only take one task each, the pool should grow for the
+  // others of a burst even if those workers haven't woken up yet.
+  std::atomic<int> num_running{0};
+  for (int i = 0; i < kCapacity; ++i) {
+    ASSERT_OK(pool->Spawn([&] {
+      ++num_running;
+      busy_wait(10, [&] { return num_running.load() == kCapacity; });
+    }));
   }
-  {
-    // Reference passing
-    std::string s = "foo";
-    ASSERT_OK_AND_ASSIGN(auto fut,
-                         pool->Submit(inplace_add<std::string>, std::ref(s), "bar"));
-    ASSERT_OK_AND_EQ("foobar", fut.result());
-    ASSERT_EQ(s, "foobar");
+  ASSERT_EQ(pool->GetActualCapacity(), kCapacity);
+
+  // All tasks of the burst run concurrently
+  busy_wait(10, [&] { return num_running.load() == kCapacity; });
+  ASSERT_EQ(num_running.load(), kCapacity);
+  ASSERT_OK(pool->Shutdown());
+}
+
+// Tests specific to work stealing scheduling
+
+class TestWorkStealingThreadPool : public TestThreadPool {
+ public:
+  std::shared_ptr<ThreadPool> MakeThreadPool(int threads) override {
+    return *ThreadPool::Make(threads, ThreadPool::Scheduling::WORK_STEALING);
   }
-  {
-    // `void` return type
-    ASSERT_OK_AND_ASSIGN(auto fut, pool->Submit(SleepFor, 0.001));
-    ASSERT_OK(fut.status());
+};
+
+TEST_F(TestWorkStealingThreadPool, SetCapacity) {
+  auto pool = this->MakeThreadPool(5);
+
+  // Workers are launched eagerly
+  ASSERT_EQ(pool->GetCapacity(), 5);
+  ASSERT_EQ(pool->GetActualCapacity(), 5);
+
+  // Idle workers secede
+  ASSERT_OK(pool->SetCapacity(2));
+  ASSERT_EQ(pool->GetCapacity(), 2);
+  busy_wait(0.5, [&] { return pool->GetActualCapacity() == 2; });
+  ASSERT_EQ(pool->GetActualCapacity(), 2);
+
+  // Downsize while tasks are pending; tasks left by seceding workers are
+  // still executed
+  ASSERT_OK(pool->SetCapacity(5));
+  ASSERT_EQ(pool->GetActualCapacity(), 5);
+  std::atomic<int> num_finished{0};
+  for (int i = 0; i < 10; ++i) {
+    ASSERT_OK(pool->Spawn([&] {
+      SleepFor(0.05);
+      ++num_finished;
+    }));
   }
+  ASSERT_OK(pool->SetCapacity(2));
+  busy_wait(0.5, [&] { return pool->GetActualCapacity() == 2; });
+  ASSERT_EQ(pool->GetActualCapacity(), 2);
+
+  ASSERT_OK(pool->Shutdown());
+  ASSERT_EQ(num_finished.load(), 10);
 }
 
 // Test fork safety on Unix
@@ -20,12 +20,18 @@
 #include <mutex>
 #include <stdexcept>
 #include <utility>
+#include <vector>
 
 #include "arrow/result.h"
+#include "arrow/util/dispatch.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/utf8.h"
 #include "arrow/vendored/utfcpp/checked.h"
 
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
+#include "arrow/util/utf8_avx2.h"
+#endif
+
 // Can be defined by utfcpp
 #ifdef NOEXCEPT
 #undef NOEXCEPT
@@ -88,6 +94,33 @@ void InitializeUTF8() {
   std::call_once(utf8_initialized, internal::InitializeLargeTable);
 }
 
+namespace {
+
+bool ValidateUTF8Default(const uint8_t* data, int64_t size) {
+  return ValidateUTF8(data, size);
+}
+
+struct ValidateUTF8DynamicFunction {
+  using FunctionType = decltype(&ValidateUTF8Default);
+
+  static std::vector<std::pair<::arrow::internal::DispatchLevel, FunctionType>>
+  implementations() {
+    return {
+      { ::arrow::internal::DispatchLevel::NONE, ValidateUTF8Default }
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
+      , { ::arrow::internal::DispatchLevel::AVX2, internal::ValidateUTF8Avx2 }
+#endif
+    };
+  }
+};
+
+}  // namespace
+
+bool ValidateUTF8Buffer(const uint8_t* data, int64_t size) {
+  static ::arrow::internal::DynamicDispatch<ValidateUTF8DynamicFunction> dispatch;
+  return dispatch.func(data, size);
+}
+
 static const uint8_t kBOM[] = {0xEF, 0xBB, 0xBF};
 
 Result<const uint8_t*> SkipUTF8BOM(const uint8_t* data, int64_t size) {
@@ -211,6 +211,14 @@ inline bool ValidateUTF8(const util::string_view& str) {
   return ValidateUTF8(data, length);
 }
 
+/// \brief Validate a UTF8 buffer, dispatching at runtime to a SIMD
+/// implementation if the CPU supports one.
+///
+/// This is meant for large inputs such as a whole string array data buffer;
+/// on short strings, prefer the inline ValidateUTF8().
+/// InitializeUTF8() must have been called beforehand.
+ARROW_EXPORT bool ValidateUTF8Buffer(const uint8_t* data, int64_t size);
+
 inline bool ValidateAsciiSw(const uint8_t* data, int64_t len) {
   uint8_t orall = 0;
 
@@ -0,0 +1,217 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Vectorized UTF8 validation, after the "lookup" algorithm described in
+// John Keiser, Daniel Lemire, "Validating UTF-8 In Less Than One Instruction
+// Per Byte", Software: Practice and Experience 51 (5), 2021.
+//
+// Each input byte is classified, together with the byte preceding it, using
+// three 16-entry table lookups (on the high nibble of the previous byte, the
+// low nibble of the previous byte and the high nibble of the current byte).
+// The AND of the three lookups is non-zero iff the two-byte sequence is
+// invalid.  Three- and four-byte sequences additionally require that the
+// bytes two and three positions after a lead byte be continuation bytes.
+
+#include <immintrin.h>
+
+#include <cstring>
+
+#include "arrow/util/utf8_avx2.h"
+
+namespace arrow {
+namespace util {
+namespace internal {
+
+namespace {
+
+// Error bits of the special case lookups
+constexpr uint8_t kTooShort = 1 << 0;   // 11______ 0_______ / 11______ 11______
+constexpr uint8_t kTooLong = 1 << 1;    // 0_______ 10______
+constexpr uint8_t kOverlong3 = 1 << 2;  // 11100000 100_____
+constexpr uint8_t kTooLarge = 1 << 3;   // 11110100 1001____ / 11110100 101_____ ...
+constexpr uint8_t kSurrogate = 1 << 4;  // 11101101 101_____
+constexpr uint8_t kOverlong2 = 1 << 5;  // 1100000_ 10______
+constexpr uint8_t kTooLarge1000 = 1 << 6;  // 11110101 1000____ / 1111011_ 1000____ ...
+constexpr uint8_t kOverlong4 = 1 << 6;     // 11110000 1000____
+constexpr uint8_t kTwoConts = 1 << 7;      // 10______ 10______
+constexpr uint8_t kCarry = kTooShort | kTooLong | kTwoConts;
+
+inline __m256i Lookup16(__m256i table, __m256i nibbles) {
+  return _mm256_shuffle_epi8(table, nibbles);
+}
+
+inline __m256i HighNibbles(__m256i v) {
+  return _mm256_and_si256(_mm256_srli_epi16(v, 4), _mm256_set1_epi8(0x0f));
+}
+
+// The 32 bytes ending N bytes before the end of `input`
+template <int N>
+inline __m256i Prev(__m256i input, __m256i prev_input) {
+  return _mm256_alignr_epi8(input, _mm256_permute2x128_si256(prev_input, input, 0x21),
+                            16 - N);
+}
+
+#define BROADCAST16(...) _mm256_setr_epi8(__VA_ARGS__, __VA_ARGS__)
+
+inline __m256i CheckSpecialCases(__m256i input, __m256i prev1) {
+  const __m256i byte_1_high_table = BROADCAST16(
+      // 0_______ ________ <ASCII in byte 1>
+      kTooLong, kTooLong, kTooLong, kTooLong, kTooLong, kTooLong, kTooLong, kTooLong,
+      // 10______ ________ <continuation in byte 1>
+      kTwoConts, kTwoConts, kTwoConts, kTwoConts,
+      // 1100____ ________ <two byte lead in byte 1>
+      kTooShort | kOverlong2,
+      // 1101____ ________ <two byte lead in byte 1>
+      kTooShort,
+      // 1110____ ________ <three byte lead in byte 1>
+      kTooShort | kOverlong3 | kSurrogate,
+      // 1111____ ________ <four+ byte lead in byte 1>
+      kTooShort | kTooLarge | kTooLarge1000 | kOverlong4);
+  const __m256i byte_1_low_table = BROADCAST16(
+      // ____0000 ________
+      kCarry | kOverlong3 | kOverlong2 | kOverlong4,
+      // ____0001 ________
+      kCarry | kOverlong2,
+      // ____001_ ________
+      kCarry, kCarry,
+      // ____0100 ________
+      kCarry | kTooLarge,
+      // ____0101 ________
+      kCarry | kTooLarge | kTooLarge1000,
+      // ____011_ ________
+      kCarry | kTooLarge | kTooLarge1000, kCarry | kTooLarge | kTooLarge1000,
+      // ____1___ ________
+      kCarry | kTooLarge | kTooLarge1000, kCarry | kTooLarge | kTooLarge1000,
+      kCarry | kTooLarge | kTooLarge1000, kCarry | kTooLarge | kTooLarge1000,
+      kCarry | kTooLarge | kTooLarge1000,
+      // ____1101 ________
+      kCarry | kTooLarge | kTooLarge1000 | kSurrogate,
+      kCarry | kTooLarge | kTooLarge1000, kCarry | kTooLarge | kTooLarge1000);
+  const __m256i byte_2_high_table = BROADCAST16(
+      // ________ 0_______ <ASCII in byte 2>
+      kTooShort, kTooShort, kTooShort, kTooShort, kTooShort, kTooShort, kTooShort,
+      kTooShort,
+      // ________ 1000____
+      kTooLong | kOverlong2 | kTwoConts | kOverlong3 | kTooLarge1000 | kOverlong4,
+      // ________ 1001____
+      kTooLong | kOverlong2 | kTwoConts | kOverlong3 | kTooLarge,
+      // ________ 101_____
+      kTooLong | kOverlong2 | kTwoConts | kSurrogate | kTooLarge,
+      kTooLong | kOverlong2 | kTwoConts | kSurrogate | kTooLarge,
+      // ________ 11______ <lead byte in byte 2>
+      kTooShort, kTooShort, kTooShort, kTooShort);
+
+  const __m256i byte_1_high = Lookup16(byte_1_high_table, HighNibbles(prev1));
+  const __m256i byte_1_low =
+      Lookup16(byte_1_low_table, _mm256_and_si256(prev1, _mm256_set1_epi8(0x0f)));
+  const __m256i byte_2_high = Lookup16(byte_2_high_table, HighNibbles(input));
+  return _mm256_and_si256(_mm256_and_si256(byte_1_high, byte_1_low), byte_2_high);
+}
+
+#undef BROADCAST16
+
+inline __m256i CheckMultibyteLengths(__m256i input, __m256i prev_input,
+                                     __m256i special_cases) {
+  const __m256i prev2 = Prev<2>(input, prev_input);
+  const __m256i prev3 = Prev<3>(input, prev_input);
+  // Only 111_____ (resp. 1111____) bytes give a result >= 0x80
+  const __m256i is_third_byte =
+      _mm256_subs_epu8(prev2, _mm256_set1_epi8(static_cast<char>(0xe0 - 0x80)));
+  const __m256i is_fourth_byte =
+      _mm256_subs_epu8(prev3, _mm256_set1_epi8(static_cast<char>(0xf0 - 0x80)));
+  const __m256i must_be_continuation =
+      _mm256_and_si256(_mm256_or_si256(is_third_byte, is_fourth_byte),
+                       _mm256_set1_epi8(static_cast<char>(0x80)));
+  // A continuation byte following another continuation byte is only valid
+  // (cancelling out the kTwoConts bit) when it is expected
+  return _mm256_xor_si256(must_be_continuation, special_cases);
+}
+
+// Non-zero if the block ends with an incomplete multi-byte sequence
+inline __m256i IsIncomplete(__m256i input) {
+  const __m256i max_value = _mm256_setr_epi8(
+      -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+      -1, -1, -1, -1, -1, -1, -1, -1, -1, static_cast<char>(0xf0 - 1),
+      static_cast<char>(0xe0 - 1), static_cast<char>(0xc0 - 1));
+  return _mm256_subs_epu8(input, max_value);
+}
+
+class UTF8Checker {
+ public:
+  void CheckBlock(__m256i input) {
+    const __m256i prev1 = Prev<1>(input, prev_input_);
+    const __m256i special_cases = CheckSpecialCases(input, prev1);
+    error_ = _mm256_or_si256(error_,
+                             CheckMultibyteLengths(input, prev_input_, special_cases));
+    prev_input_ = input;
+  }
+
+  // Check 64 bytes at a time, skipping most work on pure ASCII data
+  void CheckBlocks(__m256i input1, __m256i input2) {
+    if (_mm256_movemask_epi8(_mm256_or_si256(input1, input2)) == 0) {
+      // Only need to check that no sequence was left unfinished
+      error_ = _mm256_or_si256(error_, prev_incomplete_);
+      prev_incomplete_ = _mm256_setzero_si256();
+      prev_input_ = input2;
+    } else {
+      CheckBlock(input1);
+      CheckBlock(input2);
+      prev_incomplete_ = IsIncomplete(input2);
+    }
+  }
+
+  bool HasErrors() const { return !_mm256_testz_si256(error_, error_); }
+
+  bool Finish() {
+    error_ = _mm256_or_si256(error_, prev_incomplete_);
+    return !HasErrors();
+  }
+
+ private:
+  __m256i error_ = _mm256_setzero_si256();
+  __m256i prev_input_ = _mm256_setzero_si256();
+  __m256i prev_incomplete_ = _mm256_setzero_si256();
+};
+
+}  // namespace
+
+bool ValidateUTF8Avx2(const uint8_t* data, int64_t size) {
+  UTF8Checker checker;
+  int64_t num_blocks = 0;
+  while (size >= 64) {
+    checker.CheckBlocks(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(data)),
+                        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + 32)));
+    data += 64;
+    size -= 64;
+    // Bail out early on invalid data, without testing at every iteration
+    if (++num_blocks % 16 == 0 && checker.HasErrors()) {
+      return false;
+    }
+  }
+  if (size > 0) {
+    // Pad the tail with ASCII zeros
+    alignas(32) uint8_t tail[64] = {};
+    std::memcpy(tail, data, static_cast<size_t>(size));
+    checker.CheckBlocks(_mm256_load_si256(reinterpret_cast<const __m256i*>(tail)),
+                        _mm256_load_si256(reinterpret_cast<const __m256i*>(tail + 32)));
+  }
+  return checker.Finish();
+}
+
+}  // namespace internal
+}  // namespace util
+}  // namespace arrow
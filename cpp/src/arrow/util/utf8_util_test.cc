@@ -98,8 +98,10 @@ class UTF8ValidationTest : public UTF8Test {};
 
 class ASCIIValidationTest : public UTF8Test {};
 
+// Check both the inline and the (possibly SIMD) out-of-line validation
 ::testing::AssertionResult IsValidUTF8(const std::string& s) {
-  if (ValidateUTF8(reinterpret_cast<const uint8_t*>(s.data()), s.size())) {
+  const auto data = reinterpret_cast<const uint8_t*>(s.data());
+  if (ValidateUTF8(data, s.size()) && ValidateUTF8Buffer(data, s.size())) {
     return ::testing::AssertionSuccess();
   } else {
     std::string h = HexEncode(reinterpret_cast<const uint8_t*>(s.data()),
@@ -110,7 +112,8 @@ class ASCIIValidationTest : public UTF8Test {};
 }
 
 ::testing::AssertionResult IsInvalidUTF8(const std::string& s) {
-  if (!ValidateUTF8(reinterpret_cast<const uint8_t*>(s.data()), s.size())) {
+  const auto data = reinterpret_cast<const uint8_t*>(s.data());
+  if (!ValidateUTF8(data, s.size()) && !ValidateUTF8Buffer(data, s.size())) {
     return ::testing::AssertionSuccess();
   } else {
     std::string h = HexEncode(reinterpret_cast<const uint8_t*>(s.data()),
@@ -934,6 +934,7 @@ Status FileReaderImpl::GetRecordBatchReader(const std::vector<int>& row_groups,
   ::arrow::Iterator<RecordBatchIterator> batches = ::arrow::MakeFunctionIterator(
       [readers, batch_schema, num_rows,
        this]() mutable -> ::arrow::Result<RecordBatchIterator> {
+        RETURN_NOT_OK(reader_properties_.stop_token().Poll());
         ::arrow::ChunkedArrayVector columns(readers.size());
 
         // don't reserve more rows than necessary
@@ -999,6 +1000,7 @@ Status FileReaderImpl::ReadRowGroups(const std::vector<int>& row_groups,
   ::arrow::ChunkedArrayVector columns(readers.size());
   RETURN_NOT_OK(::arrow::internal::OptionalParallelFor(
       reader_properties_.use_threads(), static_cast<int>(readers.size()), [&](int i) {
+        RETURN_NOT_OK(reader_properties_.stop_token().Poll());
         return ReadColumn(static_cast<int>(i), row_groups, readers[i].get(), &columns[i]);
       }));
 
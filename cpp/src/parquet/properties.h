@@ -25,6 +25,7 @@
 
 #include "arrow/io/caching.h"
 #include "arrow/type.h"
+#include "arrow/util/cancel.h"
 #include "arrow/util/compression.h"
 #include "parquet/encryption.h"
 #include "parquet/exception.h"
@@ -620,6 +621,14 @@ class PARQUET_EXPORT ArrowReaderProperties {
 
   ::arrow::io::AsyncContext async_context() const { return async_context_; }
 
+  /// Set a token polled between row groups and record batches; once a stop was
+  /// requested, reading fails with the error given to StopSource::RequestStop().
+  void set_stop_token(::arrow::StopToken stop_token) {
+    stop_token_ = std::move(stop_token);
+  }
+
+  const ::arrow::StopToken& stop_token() const { return stop_token_; }
+
  private:
   bool use_threads_;
   std::unordered_set<int> read_dict_indices_;
@@ -627,6 +636,7 @@ class PARQUET_EXPORT ArrowReaderProperties {
   bool pre_buffer_;
   ::arrow::io::AsyncContext async_context_;
   ::arrow::io::CacheOptions cache_options_;
+  ::arrow::StopToken stop_token_;
 };
 
 /// EXPERIMENTAL: Constructs the default ArrowReaderProperties